@@ -0,0 +1,7 @@
+#!/bin/bash
+
+for benchmark in ${@:-benchmarks/*.cpp}; do
+	name=$(basename "$benchmark" .cpp)
+
+	${CXX:-clang-18} -O2 -std=c++23 -Isrc -o "bin/bench-$name" "benchmarks/$name.cpp" -lstdc++ -lpthread && "bin/bench-$name"
+done
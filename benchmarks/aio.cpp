@@ -0,0 +1,61 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "runtime/aio.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void append(std::unique_ptr<Backend> backend, const char *path, int lines) {
+	AsyncFiles files(std::move(backend));
+	std::shared_ptr<Completion> last;
+
+	for (int i = 0; i < lines; i++) {
+		last = files.append(path, "entry " + std::to_string(i) + "\n");
+	}
+
+	files.wait(*last);
+}
+
+int main() {
+	const int N = 200000;
+	const char *path = "/tmp/pint-bench-aio";
+
+	::unlink(path);
+
+	double reopened = measure([&] {
+		for (int i = 0; i < N; i++) {
+			int fd = ::open(path, O_WRONLY | O_APPEND | O_CREAT, 0644);
+			std::string entry = "entry " + std::to_string(i) + "\n";
+
+			::write(fd, entry.data(), entry.size());
+			::close(fd);
+		}
+	});
+
+	double threads = measure([&] {
+		append(std::make_unique<ThreadBackend>(), path, N);
+	});
+
+	printf("open/write/close %.0fms, thread backend %.0fms", reopened, threads);
+
+	#if PINT_IO_URING
+		if (UringBackend::create()) {
+			printf(", io_uring %.0fms", measure([&] {
+				append(UringBackend::create(), path, N);
+			}));
+		}
+	#endif
+
+	printf("\n");
+	::unlink(path);
+}
@@ -0,0 +1,32 @@
+#include <chrono>
+#include <cstdio>
+
+#include "runtime/bitset.h"
+
+using namespace pint;
+
+int main() {
+	const std::size_t N = 1 << 27;
+	Bits<> x(N), y(N);
+	std::size_t count = 0;
+
+	for (std::size_t i = 0; i < N; i += 3) {
+		x.set(i);
+	}
+
+	for (std::size_t i = 0; i < N; i += 5) {
+		y.set(i);
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (int round = 0; round < 20; round++) {
+		x &= y;
+		x |= y;
+		count += x.count();
+	}
+
+	double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	printf("%zu bits set, and/or/count %.1fms, %.1f GB/s\n", count, ms, 20.0 * 3 * (N / 8) / ms / 1e6);
+}
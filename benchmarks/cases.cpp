@@ -0,0 +1,82 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "cases.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int WORDS  = 40;
+	const int ROUNDS = 50;
+	const std::size_t N = 1 << 16;
+	std::vector<std::string> words;
+	auto branches = std::make_shared<ListNode>();
+
+	for (int i = 0; i < WORDS; i++) {
+		words.push_back("header-name-" + std::to_string(i * 37));
+
+		auto values = std::make_shared<ListNode>();
+
+		values->list.push_back(std::make_shared<LiteralNode>(LiteralNode::Kind::STRING, words.back()));
+		branches->list.push_back(std::make_shared<WhenNode>(values, std::make_shared<ListNode>()));
+	}
+
+	auto match = std::make_shared<CaseNode>(std::make_shared<IdentifierNode>("x"), branches);
+
+	Cases().run(match);
+
+	std::vector<std::string_view> keys(match->keys.begin(), match->keys.end());
+	std::vector<std::string> input;
+	volatile long sink;
+
+	for (std::size_t i = 0; i < N; i++) {
+		input.push_back(i % 5 ? words[(i * 7) % WORDS] : "other-" + std::to_string(i));
+	}
+
+	double hashed = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < ROUNDS; round++) {
+			for (auto &value: input) {
+				sum += dispatch::lookup(keys, match->table, match->seed, value, WORDS);
+			}
+		}
+
+		sink = sum;
+	});
+
+	double chained = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < ROUNDS; round++) {
+			for (auto &value: input) {
+				int branch = WORDS;
+
+				for (int i = 0; i < WORDS; i++) {
+					if (value == words[i]) {
+						branch = i;
+						break;
+					}
+				}
+
+				sum += branch;
+			}
+		}
+
+		sink = sum;
+	});
+
+	printf("%d strings: perfect hash %.1f ns, chain %.1f ns\n", WORDS, hashed * 1e6 / (ROUNDS * N), chained * 1e6 / (ROUNDS * N));
+}
@@ -0,0 +1,82 @@
+#include <chrono>
+#include <cstdio>
+
+#include "runtime/class.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Counter: Instance {
+	long count = 0;
+
+	Counter(const ClassType &type): Instance(type) {}
+};
+
+__attribute__((noinline)) static void once(Instance &self, long by) {
+	static_cast<Counter &>(self).count += by;
+}
+
+__attribute__((noinline)) static void twice(Instance &self, long by) {
+	static_cast<Counter &>(self).count += 2 * by;
+}
+
+int main() {
+	static const InterfaceType INCREMENT = {"Increment"}, FIRST = {"First"}, SECOND = {"Second"}, THIRD = {"Third"};
+	static const Method ONCE[]  = {reinterpret_cast<Method>(once)};
+	static const Method TWICE[] = {nullptr, reinterpret_cast<Method>(twice)};
+	static const Method ONCE_ITABLE[]  = {ONCE[0]};
+	static const Method TWICE_ITABLE[] = {TWICE[1]};
+	static const Itable ONCE_USES[]  = {{&FIRST, ONCE_ITABLE}, {&SECOND, ONCE_ITABLE}, {&THIRD, ONCE_ITABLE}, {&INCREMENT, ONCE_ITABLE}};
+	static const Itable TWICE_USES[] = {{&FIRST, TWICE_ITABLE}, {&SECOND, TWICE_ITABLE}, {&THIRD, TWICE_ITABLE}, {&INCREMENT, TWICE_ITABLE}};
+	static const ClassType A = {"A", ONCE, ONCE_USES, 4}, B = {"B", TWICE, TWICE_USES, 4};
+	const long R = 50000000;
+	Counter a(A), b(B);
+	Instance *receivers[2] = {&a, &b};
+	Instance *receiver = &a;
+	ItableCache cache(INCREMENT);
+
+	asm volatile("" : : "r"(receiver) : "memory");
+
+	double direct = measure([&] {
+		for (long i = 0; i < R; i++) {
+			once(*receiver, i);
+		}
+	});
+
+	double vtable = measure([&] {
+		for (long i = 0; i < R; i++) {
+			receiver->invoke<void>(0, i);
+		}
+	});
+
+	double cached = measure([&] {
+		for (long i = 0; i < R; i++) {
+			cache.invoke<void>(*receiver, 0, i);
+		}
+	});
+
+	double alternating = measure([&] {
+		for (long i = 0; i < R; i++) {
+			cache.invoke<void>(*receivers[i & 1], 0, i);
+		}
+	});
+
+	double searched = measure([&] {
+		for (long i = 0; i < R; i++) {
+			auto methods = receivers[i & 1]->getType().itable(INCREMENT);
+
+			reinterpret_cast<void (*)(Instance &, long)>(methods[0])(*receivers[i & 1], i);
+		}
+	});
+
+	printf("direct %.2f ns, vtable %.2f, itable cached %.2f, cached alternating %.2f, searched %.2f\n", direct * 1e6 / R, vtable * 1e6 / R, cached * 1e6 / R, alternating * 1e6 / R, searched * 1e6 / R);
+	printf("%ld\n", a.count + b.count);
+}
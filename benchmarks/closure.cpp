@@ -0,0 +1,85 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "runtime/closure.h"
+
+using namespace pint;
+
+static long allocations = 0;
+
+void *operator new(std::size_t size) {
+	allocations++;
+
+	if (void *memory = std::malloc(size)) {
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * rot13 calling its local `shift` as emitted when shift stays in the frame, and as a heap
+ * closure when it escapes.
+ */
+template <typename Shift>
+static std::string encode(const std::string &text, const Shift &shift) {
+	std::string out(text.size(), '\0');
+
+	for (std::size_t i = 0; i < text.size(); i++) {
+		char c = text[i];
+
+		out[i] = c >= 'a' && c <= 'z' ? shift(c, 'a') : c >= 'A' && c <= 'Z' ? shift(c, 'A') : c;
+	}
+
+	return out;
+}
+
+int main() {
+	const int R = 2000;
+	const std::size_t N = 4096;
+	auto shift = [](char c, char basis) {
+		return char((c - basis + 13) % 26 + basis);
+	};
+	std::string text;
+	volatile long sink;
+
+	for (std::size_t i = 0; i < N; i++) {
+		text += char(32 + (i * 7919u) % 95);
+	}
+
+	long before = allocations;
+	double direct = measure([&] {
+		for (int round = 0; round < R; round++) {
+			sink = encode(text, shift)[round % N];
+		}
+	});
+	long between = allocations;
+	double heap = measure([&] {
+		for (int round = 0; round < R; round++) {
+			sink = encode(text, Closure<char(char, char)>::own(shift))[round % N];
+		}
+	});
+
+	printf("direct %.3f ns per char, %.2f allocations per call\n", direct * 1e6 / (R * N), double(between - before) / R);
+	printf("heap closure %.3f ns per char, %.2f allocations per call\n", heap * 1e6 / (R * N), double(allocations - between) / R);
+}
@@ -0,0 +1,34 @@
+#include <chrono>
+#include <cstdio>
+
+#include "runtime/string.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int N = 100000;
+	String<> rebuilt, appended;
+
+	double rebuilding = measure([&] {
+		for (int i = 0; i < N; i++) {
+			rebuilt = rebuilt + String<>("part");
+		}
+	});
+
+	double appending = measure([&] {
+		for (int i = 0; i < N; i++) {
+			appended += String<>("part");
+		}
+	});
+
+	printf("s = s + p %.1fms, lowered s += p %.1fms, same %d\n", rebuilding, appending, rebuilt == appended);
+}
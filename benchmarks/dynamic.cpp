@@ -0,0 +1,63 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "runtime/dynamic.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const long N = 200000000;
+	volatile long sink;
+
+	double dynamicInteger = measure([&] {
+		Dynamic sum = Dynamic::fromInteger(0);
+
+		for (long i = 0; i < N; i++) {
+			sum = sum + Dynamic::fromInteger(i & 7) * Dynamic::fromInteger(3);
+		}
+
+		sink = sum.toInteger();
+	});
+
+	double nativeInteger = measure([&] {
+		int64_t sum = 0;
+
+		for (long i = 0; i < N; i++) {
+			sum = sum + (i & 7) * 3;
+		}
+
+		sink = sum;
+	});
+
+	double dynamicReal = measure([&] {
+		Dynamic sum = Dynamic::fromReal(0);
+
+		for (long i = 0; i < N; i++) {
+			sum = sum + Dynamic::fromReal(double(i & 7)) * Dynamic::fromReal(0.5);
+		}
+
+		sink = long(sum.toReal());
+	});
+
+	double nativeReal = measure([&] {
+		float sum = 0;
+
+		for (long i = 0; i < N; i++) {
+			sum = sum + float(i & 7) * 0.5f;
+		}
+
+		sink = long(sum);
+	});
+
+	printf("dynamic integer %.0fms, native integer %.0fms, dynamic real %.0fms, native real %.0fms\n", dynamicInteger, nativeInteger, dynamicReal, nativeReal);
+}
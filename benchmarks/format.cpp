@@ -0,0 +1,60 @@
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+
+#include "runtime/format.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int N = 1 << 20;
+	String<8> path("/etc/app/config.jin");
+	volatile long sink;
+
+	double specialized = measure([&] {
+		long units = 0;
+
+		for (int i = 0; i < N; i++) {
+			auto text = format::Builder(18 + format::estimate(path, {'s'}) + format::estimate(i, {'d'}))
+				.text("storage/logs/").put(path, {'s'}).text(".").put(i, {'d'}).text(".log").done();
+
+			units += text.units();
+		}
+
+		sink = units;
+	});
+
+	double runtime = measure([&] {
+		long units = 0;
+
+		for (int i = 0; i < N; i++) {
+			units += format::format("storage/logs/%s.%d.log", path, i).units();
+		}
+
+		sink = units;
+	});
+
+	double stream = measure([&] {
+		long units = 0;
+
+		for (int i = 0; i < N; i++) {
+			std::ostringstream out;
+
+			out << "storage/logs/" << path.view() << "." << i << ".log";
+			units += out.str().size();
+		}
+
+		sink = units;
+	});
+
+	printf("specialized %.2f ns, runtime pattern %.2f ns, ostringstream %.2f ns\n", specialized * 1e6 / N, runtime * 1e6 / N, stream * 1e6 / N);
+}
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "runtime/dynamic.h"
+#include "runtime/record.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * `find` of a `Repository<Person>` instance, over records it knows are people, against the
+ * boxed instance shared by every argument, which checks each element it is given.
+ */
+int main() {
+	static const RecordType PERSON = {"Person", 8, 8};
+	const int N = 1024;
+	const int R = 20000;
+	std::vector<Record *> typed;
+	std::vector<Dynamic> boxed;
+	volatile long sink;
+
+	for (int i = 0; i < N; i++) {
+		auto record = Record::make(PERSON);
+
+		record->field<int64_t>(0) = i;
+		typed.push_back(record);
+		boxed.push_back(Dynamic::fromPointer(record));
+	}
+
+	auto specialized = [&](int64_t key) -> Record * {
+		for (auto record: typed) {
+			if (record->field<int64_t>(0) == key) {
+				return record;
+			}
+		}
+
+		return nullptr;
+	};
+	auto shared = [&](int64_t key) -> Record * {
+		for (auto &value: boxed) {
+			auto record = static_cast<const Record *>(value.toPointer());
+
+			if (record->is(PERSON) && record->field<int64_t>(0) == key) {
+				return const_cast<Record *>(record);
+			}
+		}
+
+		return nullptr;
+	};
+
+	double fast = measure([&] {
+		for (int round = 0; round < R; round++) {
+			sink = specialized(N - 1 - (round & 1)) != nullptr;
+		}
+	});
+
+	double slow = measure([&] {
+		for (int round = 0; round < R; round++) {
+			sink = shared(N - 1 - (round & 1)) != nullptr;
+		}
+	});
+
+	printf("find over %d records: %.1f ns specialized, %.1f ns boxed\n", N, fast * 1e6 / R, slow * 1e6 / R);
+
+	for (auto record: typed) {
+		delete record;
+	}
+}
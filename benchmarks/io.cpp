@@ -0,0 +1,55 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "runtime/io.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int N = 1000000;
+	std::string x = "42";
+	int fd = ::open("/dev/null", O_WRONLY);
+
+	double joined = measure([&] {
+		for (int i = 0; i < N; i++) {
+			std::string line = "x is equal to " + x + "\n";
+
+			::write(fd, line.data(), line.size());
+		}
+	});
+
+	double buffered = measure([&] {
+		Output output(fd, Output::Mode::FULL);
+
+		for (int i = 0; i < N; i++) {
+			std::string_view parts[] = {"x is equal to ", x};
+
+			output.writeLn(parts);
+		}
+	});
+
+	double lines = measure([&] {
+		Output output(fd, Output::Mode::LINE);
+
+		for (int i = 0; i < N; i++) {
+			std::string_view parts[] = {"x is equal to ", x};
+
+			output.writeLn(parts);
+		}
+	});
+
+	printf("write per line %.0fms, buffered %.0fms, line mode writev %.0fms\n", joined, buffered, lines);
+}
@@ -0,0 +1,55 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	static constexpr std::string_view NAMES[] = {"INFO", "WARNING", "ERROR", "FATAL", "PANIC", "CRITICAL"};
+	static const int TABLE[] = {1, 3, 2, 3, 1, 0};
+	const std::size_t N = 1 << 20;
+	std::vector<uint8_t> codes(N);
+	std::vector<std::string> names(N);
+	volatile long sink;
+
+	for (std::size_t i = 0; i < N; i++) {
+		codes[i] = (i * 2654435761u >> 7) % 6;
+		names[i] = NAMES[codes[i]];
+	}
+
+	double table = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < 20; round++) {
+			for (auto code: codes) {
+				sum += TABLE[code];
+			}
+		}
+
+		sink = sum;
+	});
+
+	double chain = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < 20; round++) {
+			for (auto &name: names) {
+				sum += name == "CRITICAL" ? 0 : name == "INFO" || name == "PANIC" ? 1 : name == "ERROR" ? 2 : 3;
+			}
+		}
+
+		sink = sum;
+	});
+
+	printf("table over codes %.2f ns, chain over names %.2f ns\n", table * 1e6 / (20.0 * N), chain * 1e6 / (20.0 * N));
+}
@@ -0,0 +1,177 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "runtime/array.h"
+#include "runtime/object.h"
+#include "runtime/string.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * The generic iteration loops fall back to, an iterator object giving Dynamic values.
+ */
+struct Iterator {
+	virtual ~Iterator() {}
+	virtual bool next(Dynamic &value) = 0;
+};
+
+struct ArrayIterator: Iterator {
+	const Array<int64_t> &array;
+	std::size_t at = 0;
+
+	ArrayIterator(const Array<int64_t> &array): array(array) {}
+
+	bool next(Dynamic &value) override {
+		if (at >= array.span()) {
+			return false;
+		}
+
+		value = Dynamic::fromInteger(array[at++]);
+
+		return true;
+	}
+};
+
+struct StringIterator: Iterator {
+	std::string_view string;
+	std::size_t at = 0;
+
+	StringIterator(std::string_view string): string(string) {}
+
+	bool next(Dynamic &value) override {
+		if (at >= string.size()) {
+			return false;
+		}
+
+		value = Dynamic::fromChar(utf::decode(string.data(), at));
+
+		return true;
+	}
+};
+
+struct ObjectIterator: Iterator {
+	const Object &object;
+	std::vector<const Symbol *> keys;
+	std::size_t at = 0;
+
+	ObjectIterator(const Object &object): object(object), keys(object.getShape()->keys()) {}
+
+	bool next(Dynamic &value) override {
+		if (at >= keys.size()) {
+			return false;
+		}
+
+		value = object.get(keys[at++]);
+
+		return true;
+	}
+};
+
+int main() {
+	const std::size_t N = 1 << 20;
+	const int R = 20;
+	const int OBJECTS = 1000000;
+	Array<int64_t> array(N);
+	std::string text;
+	Object object;
+	volatile long sink;
+
+	for (std::size_t i = 0; i < N; i++) {
+		array[i] = i;
+	}
+
+	for (std::size_t i = 0; i < N / 8; i++) {
+		text += i % 16 ? "abcdefg " : "abcdé€g ";
+	}
+
+	for (int i = 0; i < 16; i++) {
+		object.set(Symbol::intern("k" + std::to_string(i)), Dynamic::fromInteger(i));
+	}
+
+	String<8> string{std::string_view(text)};
+
+	auto run = [&](auto body) {
+		return measure([&] {
+			long sum = 0;
+
+			body(sum);
+
+			sink = sum;
+		});
+	};
+
+	double indexed = run([&](long &sum) {
+		for (int round = 0; round < R; round++) {
+			for (std::size_t i = 0; i < array.span(); i++) {
+				sum += array[i];
+			}
+		}
+	});
+
+	double arrays = run([&](long &sum) {
+		for (int round = 0; round < R; round++) {
+			std::unique_ptr<Iterator> iterator(new ArrayIterator(array));
+			Dynamic value;
+
+			while (iterator->next(value)) {
+				sum += value.toInteger();
+			}
+		}
+	});
+
+	double each = run([&](long &sum) {
+		for (int round = 0; round < R; round++) {
+			string.each([&](char32_t code) {
+				sum += code;
+			});
+		}
+	});
+
+	double strings = run([&](long &sum) {
+		for (int round = 0; round < R; round++) {
+			std::unique_ptr<Iterator> iterator(new StringIterator(string.view()));
+			Dynamic value;
+
+			while (iterator->next(value)) {
+				sum += value.toChar();
+			}
+		}
+	});
+
+	double slots = run([&](long &sum) {
+		for (int round = 0; round < OBJECTS; round++) {
+			object.each([&](const Symbol *, const Dynamic &value) {
+				sum += value.toInteger();
+			});
+		}
+	});
+
+	double objects = run([&](long &sum) {
+		for (int round = 0; round < OBJECTS; round++) {
+			std::unique_ptr<Iterator> iterator(new ObjectIterator(object));
+			Dynamic value;
+
+			while (iterator->next(value)) {
+				sum += value.toInteger();
+			}
+		}
+	});
+
+	printf("array  %.2f ns per element lowered, %.2f through an iterator\n", indexed * 1e6 / (R * N), arrays * 1e6 / (R * N));
+	printf("string %.2f ns per unit lowered, %.2f through an iterator\n", each * 1e6 / (R * text.size()), strings * 1e6 / (R * text.size()));
+	printf("object %.2f ns per property lowered, %.2f through an iterator\n", slots * 1e6 / (OBJECTS * 16.0), objects * 1e6 / (OBJECTS * 16.0));
+}
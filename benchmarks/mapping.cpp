@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "runtime/dynamic.h"
+#include "runtime/map.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * The element function as called when it is not inlined.
+ */
+__attribute__((noinline)) static char32_t encode(char32_t c) {
+	auto shift = [](char32_t c, char32_t basis) {
+		return (c - basis + 13) % 26 + basis;
+	};
+
+	return 'a' <= c && c <= 'z' ? shift(c, 'a') : 'A' <= c && c <= 'Z' ? shift(c, 'A') : c;
+}
+
+int main() {
+	const std::size_t N = 1 << 20;
+	const int R = 20;
+	std::string text;
+	Array<int64_t> xs(N);
+	volatile long sink;
+
+	for (std::size_t i = 0; i < N; i++) {
+		text += char(32 + (i * 7919u) % 95);
+		xs[i] = i;
+	}
+
+	String<8> message{std::string_view(text)};
+	CharMap rot13(encode);
+
+	double table = measure([&] {
+		for (int round = 0; round < R; round++) {
+			sink = rot13(message).view()[round];
+		}
+	});
+
+	double called = measure([&] {
+		for (int round = 0; round < R; round++) {
+			std::string out;
+
+			out.reserve(text.size());
+			message.each([&](char32_t c) {
+				utf::encode(encode(c), out);
+			});
+
+			sink = out[round];
+		}
+	});
+
+	double inlined = measure([&] {
+		for (int round = 0; round < R; round++) {
+			sink = map(xs, [](int64_t x) {
+				return x + 1;
+			})[round];
+		}
+	});
+
+	double dynamic = measure([&] {
+		for (int round = 0; round < R; round++) {
+			Array<Dynamic> out(xs.span());
+
+			for (std::size_t i = 0; i < xs.span(); i++) {
+				out[i] = Dynamic::fromInteger(xs[i]) + Dynamic::fromInteger(1);
+			}
+
+			sink = out[round].toInteger();
+		}
+	});
+
+	printf("msg[encode] %.3f ns per byte tabulated, %.3f calling per code point\n", table * 1e6 / (R * N), called * 1e6 / (R * N));
+	printf("xs.map(x + 1) %.3f ns per element inlined, %.3f on dynamic values\n", inlined * 1e6 / (R * N), dynamic * 1e6 / (R * N));
+}
@@ -0,0 +1,64 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "runtime/object.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int R = 20000;
+	auto left  = Symbol::intern("left");
+	auto right = Symbol::intern("right");
+	std::vector<Object> objects(1000);
+	std::vector<std::unordered_map<std::string, Dynamic>> maps(1000);
+	volatile long sink;
+
+	for (auto &object: objects) {
+		object.set(left, Dynamic::fromInteger(1));
+		object.set(right, Dynamic::fromInteger(2));
+	}
+
+	for (auto &map: maps) {
+		map["left"]  = Dynamic::fromInteger(1);
+		map["right"] = Dynamic::fromInteger(2);
+	}
+
+	double cached = measure([&] {
+		InlineCache site(right);
+		long sum = 0;
+
+		for (int round = 0; round < R; round++) {
+			for (auto &object: objects) {
+				sum += site.get(object).toInteger();
+			}
+		}
+
+		sink = sum;
+	});
+
+	double hashed = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < R; round++) {
+			for (auto &map: maps) {
+				sum += map.find("right")->second.toInteger();
+			}
+		}
+
+		sink = sum;
+	});
+
+	printf("inline cache %.2f ns/read, hash map %.2f ns/read\n", cached * 1e6 / (R * 1000.0), hashed * 1e6 / (R * 1000.0));
+}
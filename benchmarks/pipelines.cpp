@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "runtime/map.h"
+#include "runtime/pipeline.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const std::size_t N = 1 << 20;
+	const int R = 20;
+	Array<int64_t> xs(N);
+	volatile long sink;
+
+	for (std::size_t i = 0; i < N; i++) {
+		xs[i] = i;
+	}
+
+	auto triple = [](int64_t x) {
+		return x * 3;
+	};
+	auto even = [](int64_t x) {
+		return x % 2 == 0;
+	};
+	auto next = [](int64_t x) {
+		return x + 1;
+	};
+	auto add = [](int64_t a, int64_t x) {
+		return a + x;
+	};
+
+	double eager = measure([&] {
+		for (int round = 0; round < R; round++) {
+			auto tripled = map(xs, triple);
+			Array<int64_t> evens;
+			int64_t sum = 0;
+
+			for (std::size_t i = 0; i < tripled.span(); i++) {
+				if (even(tripled[i])) {
+					evens.push(tripled[i]);
+				}
+			}
+
+			auto result = map(evens, next);
+
+			for (std::size_t i = 0; i < result.span(); i++) {
+				sum = add(sum, result[i]);
+			}
+
+			sink = sum;
+		}
+	});
+
+	double reduced = measure([&] {
+		for (int round = 0; round < R; round++) {
+			sink = lazy(xs).map(triple).filter(even).map(next).reduce(add, int64_t(0));
+		}
+	});
+
+	double collected = measure([&] {
+		for (int round = 0; round < R; round++) {
+			sink = lazy(xs).map(triple).filter(even).map(next).collect()[round];
+		}
+	});
+
+	printf("map, filter, map, reduce: %.3f ns per element eager, %.3f fused, %.3f fused and collected\n", eager * 1e6 / (R * N), reduced * 1e6 / (R * N), collected * 1e6 / (R * N));
+}
@@ -0,0 +1,88 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <new>
+#include <vector>
+
+#include "runtime/object.h"
+#include "runtime/record.h"
+
+using namespace pint;
+
+static RecordType entry = {"Entry", 24, 8, nullptr, [](std::byte *fields) {
+	new (fields) int64_t(0);
+	new (fields + 8) int64_t(42);
+	new (fields + 16) int8_t(3);
+}};
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int N = 1000, R = 20000;
+	auto created = Symbol::intern("created");
+	InlineCache when(Symbol::intern("when"));
+	std::vector<Record *> records;
+	std::vector<Object *> objects;
+	volatile long sink;
+
+	double makeRecords = measure([&] {
+		for (int i = 0; i < N * 100; i++) {
+			auto record = Record::make(entry);
+
+			record->retain();
+			record->release();
+		}
+	});
+
+	double makeObjects = measure([&] {
+		for (int i = 0; i < N * 100; i++) {
+			auto object = new Object();
+
+			when.set(*object, Dynamic::fromInteger(42));
+			object->set(created, Dynamic::fromInteger(0));
+
+			delete object;
+		}
+	});
+
+	for (int i = 0; i < N; i++) {
+		auto object = new Object();
+
+		when.set(*object, Dynamic::fromInteger(42));
+		records.push_back(Record::make(entry));
+		objects.push_back(object);
+	}
+
+	double readRecords = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < R; round++) {
+			for (auto record: records) {
+				sum += record->field<int64_t>(8);
+			}
+		}
+
+		sink = sum;
+	});
+
+	double readObjects = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < R; round++) {
+			for (auto object: objects) {
+				sum += when.get(*object).toInteger();
+			}
+		}
+
+		sink = sum;
+	});
+
+	printf("create record %.1f ns, object %.1f ns; read record %.2f ns, object %.2f ns\n", makeRecords * 1e6 / (N * 100), makeObjects * 1e6 / (N * 100), readRecords * 1e6 / (N * R), readObjects * 1e6 / (N * R));
+}
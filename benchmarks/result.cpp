@@ -0,0 +1,61 @@
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+#include "runtime/result.h"
+
+using namespace pint;
+
+struct Box {
+	virtual ~Box() {}
+};
+
+struct IntegerBox: Box {
+	int value;
+
+	IntegerBox(int value): value(value) {}
+};
+
+__attribute__((noinline)) static Result<int> unboxed(int value) {
+	if (value < 0) {
+		return new Error("Could not open");
+	}
+
+	return value * 2;
+}
+
+__attribute__((noinline)) static std::shared_ptr<Box> boxed(int value) {
+	return std::make_shared<IntegerBox>(value * 2);
+}
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int N = 100000000;
+	volatile long sink = 0;
+
+	double results = measure([&] {
+		for (int i = 0; i < N; i++) {
+			if (auto result = unboxed(i)) {
+				sink = sink + result.get();
+			}
+		}
+	});
+
+	double boxes = measure([&] {
+		for (int i = 0; i < N / 10; i++) {
+			if (auto box = dynamic_cast<IntegerBox *>(boxed(i).get())) {
+				sink = sink + box->value;
+			}
+		}
+	});
+
+	printf("Result %.2f ns/call, boxed and dynamic_cast %.2f ns/call\n", results * 1e6 / N, boxes * 1e6 / (N / 10));
+}
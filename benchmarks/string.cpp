@@ -0,0 +1,50 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "runtime/string.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	std::string text;
+	volatile std::size_t sink;
+
+	for (int i = 0; i < 1000000; i++) {
+		text += i % 50 ? "abcdefghijklmnopqrstuvwxyz" : "ééé✓";
+	}
+
+	double scanned = measure([&] {
+		std::size_t span = 0;
+
+		for (int round = 0; round < 20; round++) {
+			span += utf::scan(text.data(), text.size()).span;
+			span += utf::validate(text.data(), text.size());
+		}
+
+		sink = span;
+	});
+
+	double decoded = measure([&] {
+		std::size_t span = 0;
+
+		for (int round = 0; round < 20; round++) {
+			for (std::size_t offset = 0; offset < text.size(); span++) {
+				utf::decode(text.data(), offset);
+			}
+		}
+
+		sink = span;
+	});
+
+	printf("scan and validate %.2f GB/s, decode loop %.2f GB/s\n", 20.0 * text.size() / scanned / 1e6, 20.0 * text.size() / decoded / 1e6);
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "runtime/object.h"
+
+using namespace pint;
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int R = 200000;
+	Object object;
+	std::vector<Dynamic> names;
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, Dynamic> map;
+	volatile long sink;
+
+	for (int i = 0; i < 64; i++) {
+		strings.push_back("p" + std::to_string(i));
+		names.push_back(Dynamic::fromString(strings.back()));
+		object.set(Symbol::intern(strings.back()), Dynamic::fromInteger(i));
+		map[strings.back()] = Dynamic::fromInteger(i);
+	}
+
+	double cached = measure([&] {
+		DynamicCache site;
+		long sum = 0;
+
+		for (int round = 0; round < R; round++) {
+			for (auto &name: names) {
+				sum += site.get(object, name).toInteger();
+			}
+		}
+
+		sink = sum;
+	});
+
+	double interned = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < R; round++) {
+			for (auto &name: names) {
+				sum += object.get(Symbol::of(name)).toInteger();
+			}
+		}
+
+		sink = sum;
+	});
+
+	double hashed = measure([&] {
+		long sum = 0;
+
+		for (int round = 0; round < R; round++) {
+			for (auto &name: strings) {
+				sum += map.find(name)->second.toInteger();
+			}
+		}
+
+		sink = sum;
+	});
+
+	double hot = measure([&] {
+		DynamicCache site;
+		long sum = 0;
+
+		for (int round = 0; round < R * 64; round++) {
+			sum += site.get(object, names[round & 3]).toInteger();
+		}
+
+		sink = sum;
+	});
+
+	double reads = R * 64.0 / 1e6;
+
+	printf("reflective site %.1f ns, intern and find %.1f ns, string map %.1f ns, hot site %.1f ns\n", cached / reads, interned / reads, hashed / reads, hot / reads);
+}
@@ -0,0 +1,51 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "runtime/variadic.h"
+
+using namespace pint;
+
+static std::size_t total = 0;
+
+__attribute__((noinline)) static void stack(Variadic<std::string_view> parts) {
+	for (auto &part: parts) {
+		total += part.size();
+	}
+}
+
+__attribute__((noinline)) static void heap(std::vector<std::string_view> parts) {
+	for (auto &part: parts) {
+		total += part.size();
+	}
+}
+
+template <typename F>
+static double measure(F f) {
+	auto start = std::chrono::steady_clock::now();
+
+	f();
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+	const int N = 20000000;
+	std::string x = "42";
+
+	double spans = measure([&] {
+		for (int i = 0; i < N; i++) {
+			stack({"x is equal to ", x});
+		}
+	});
+
+	double vectors = measure([&] {
+		for (int i = 0; i < N; i++) {
+			heap({"x is equal to ", x});
+		}
+	});
+
+	printf("stack span %.0fms, heap vector %.0fms (%zu units)\n", spans, vectors, total);
+}
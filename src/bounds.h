@@ -0,0 +1,857 @@
+#ifndef __PINT_BOUNDS_H
+#define __PINT_BOUNDS_H
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Removes span checks from index expressions which cannot leave the span of their array,
+	 * and overflow checks from arithmetic on sized integers which cannot leave their size:
+	 *
+	 * - indexes whose range of values lies within a fixed span, `arr[i - 1]` for an `arr`
+	 *   of span 5 inside `for var i = 1 to 5`
+	 * - `arr[x]` inside `for var x of arr`, provided the loop neither assigns nor redeclares
+	 *   `x` or `arr` and cannot change the span of `arr`, which any call may do unless
+	 *   `arr` is a fresh local of a function, neither a parameter nor initialized from
+	 *   another value it might share, and no other function mentions it
+	 * - `+`, `-` and `*` whose range of results fits the widest size of their operands
+	 *
+	 * Ranges are worked out walking the statements in order, from the sizes of the declared
+	 * types, the values of initializers and assignments, the bounds of `for ... to` loops and
+	 * the guards of `if` and `case`.  Variables assigned in a loop are taken to have any value
+	 * of their type within and after it, as is a loop variable the loop assigns, and those
+	 * assigned by any function other than the one declaring them, as a closure may run at
+	 * any time, always are.
+	 */
+	class BoundsCheck {
+		public:
+			/**
+			 * Checks removed within one function.
+			 */
+			struct Removed {
+				std::size_t spans = 0;
+				std::size_t overflows = 0;
+			};
+
+			/**
+			 * Returns the number of checks that were removed.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				types.clear();
+				indexes.clear();
+				scope.clear();
+				ranges.clear();
+				unstable.clear();
+				shared.clear();
+				enclosed.clear();
+				report.clear();
+				function.clear();
+				removed = 0;
+				nesting = 0;
+
+				captured(node);
+				visit(node);
+
+				return removed;
+			}
+
+			/**
+			 * The checks removed by the last run per function, by the name of the function or
+			 * of the variable it is bound to, with "" for those outside any function.
+			 */
+			const std::map<std::string, Removed> &getReport() const {
+				return report;
+			}
+
+		private:
+			struct Range {
+				int64_t low = INT64_MIN;
+				int64_t high = INT64_MAX;
+			};
+
+			/**
+			 * Declared types, the array each `for ... of` variable is an index of and the
+			 * declaration each name refers to, the VarNode or the loop variable, per scope.
+			 */
+			std::map<std::string, std::shared_ptr<TypeNode>> types;
+			std::map<std::string, std::string> indexes;
+			std::map<std::string, const Node *> scope;
+
+			/**
+			 * What each declaration is known to hold at the point reached.
+			 */
+			std::map<const Node *, Range> ranges;
+			std::set<std::string> unstable;
+
+			/**
+			 * The names functions mention without declaring them, the declarations inside a
+			 * function of arrays of their own and how many function literals the statements
+			 * reached are inside.
+			 */
+			std::set<std::string> shared;
+			std::set<const Node *> enclosed;
+			std::size_t nesting = 0;
+
+			std::map<std::string, Removed> report;
+			std::string function;
+			std::size_t removed = 0;
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					auto outer = function;
+
+					if (as(FunctionNode, var->value)) {
+						function = var->name->name;
+					}
+
+					visit(var->value);
+					declare(var);
+
+					function = outer;
+
+				} else if (auto literal = as(FunctionNode, node)) {
+					auto outerTypes   = types;
+					auto outerIndexes = indexes;
+					auto outerScope   = scope;
+					auto outerRanges  = std::move(ranges);
+					auto outer        = function;
+
+					ranges.clear();
+
+					if (literal->name) {
+						function = literal->name->name;
+					}
+
+					if (literal->params) {
+						for (auto &param: literal->params->list) {
+							if (auto var = as(VarNode, param)) {
+								declare(var);
+							}
+						}
+					}
+
+					nesting++;
+					visit(literal->body);
+					nesting--;
+
+					types    = outerTypes;
+					indexes  = outerIndexes;
+					scope    = outerScope;
+					ranges   = std::move(outerRanges);
+					function = outer;
+
+				} else if (auto loop = as(ForNode, node)) {
+					visit(loop->subject);
+					visit(loop->limit);
+
+					auto outerTypes   = types;
+					auto outerIndexes = indexes;
+					auto outerScope   = scope;
+					auto subject      = as(IdentifierNode, loop->subject);
+					auto name         = loop->variable->name;
+					auto bounds       = Range();
+
+					if (loop->kind == ForNode::Kind::TO && !assigns(loop->body, name)) {
+						bounds = {range(loop->subject).low, range(loop->limit).high};
+					} else if (loop->kind == ForNode::Kind::OF && subject && span(subject->name) && !assigns(loop->body, name)) {
+						bounds = {0, int64_t(span(subject->name)) - 1};
+					}
+
+					forget(loop->body);
+
+					types.erase(name);
+					indexes.erase(name);
+					scope[name] = loop->variable.get();
+					ranges[loop->variable.get()] = bounds;
+
+					if (loop->kind == ForNode::Kind::OF && subject && isArray(subject->name) && !rebinds(loop->body, name) && !rebinds(loop->body, subject->name)) {
+						if (span(subject->name) || !resizes(loop->body, subject->name, !confined(subject->name))) {
+							indexes[name] = subject->name;
+						}
+					}
+
+					visit(loop->body);
+					forget(loop->body);
+
+					types   = outerTypes;
+					indexes = outerIndexes;
+					scope   = outerScope;
+
+				} else if (auto branch = as(IfNode, node)) {
+					visit(branch->condition);
+
+					auto before = ranges;
+
+					guard(branch->condition, true);
+					visit(branch->then);
+
+					auto then = ranges;
+
+					ranges = before;
+
+					guard(branch->condition, false);
+					visit(branch->otherwise);
+					join(then);
+
+				} else if (auto match = as(CaseNode, node)) {
+					visit(match->subject);
+
+					auto before  = ranges;
+					auto after   = ranges;
+					auto last    = ranges;
+					auto subject = as(IdentifierNode, match->subject);
+					bool falling = false;
+
+					for (auto &item: match->branches->list) {
+						auto when = as(WhenNode, item);
+
+						if (!when) {
+							visit(item);
+							continue;
+						}
+
+						ranges = before;
+
+						if (falling) {
+							join(last);
+						} else if (subject) {
+							refine(subject->name, values(*when));
+						}
+
+						visit(when->body);
+
+						last   = ranges;
+						ranges = after;
+
+						join(last);
+
+						after   = ranges;
+						falling = when->fallthrough;
+					}
+
+					ranges = after;
+
+				} else if (auto assign = as(AssignNode, node)) {
+					visit(assign->value);
+
+					for (auto &target: assign->targets->list) {
+						auto identifier = as(IdentifierNode, target);
+
+						if (!identifier) {
+							visit(target);
+							continue;
+						}
+
+						auto key = declaration(identifier->name);
+
+						if (!key) {
+							continue;
+						}
+
+						auto value = range(assign->value);
+
+						if (assign->op != "=") {
+							value = arithmetic(assign->op.substr(0, assign->op.size() - 1), range(target), value);
+						}
+
+						ranges[key] = intersect(value, declared(key));
+					}
+
+				} else if (auto append = as(AppendNode, node)) {
+					visit(append->parts);
+					forget(append);
+
+				} else if (auto binary = as(BinaryNode, node)) {
+					visit(binary->left);
+					visit(binary->right);
+
+					if (binary->checked && fits(binary)) {
+						binary->checked = false;
+						report[function].overflows++;
+						removed++;
+					}
+
+				} else if (auto index = as(IndexNode, node)) {
+					visit(index->target);
+					visit(index->index);
+
+					if (index->checked && inSpan(*index)) {
+						index->checked = false;
+						report[function].spans++;
+						removed++;
+					}
+
+				} else if (auto list = as(ListNode, node)) {
+					auto outerTypes   = types;
+					auto outerIndexes = indexes;
+					auto outerScope   = scope;
+
+					for (auto &child: list->children()) {
+						visit(child);
+					}
+
+					types   = outerTypes;
+					indexes = outerIndexes;
+					scope   = outerScope;
+
+				} else {
+					for (auto &child: node->children()) {
+						visit(child);
+					}
+				}
+			}
+
+			void declare(std::shared_ptr<VarNode> var) {
+				types[var->name->name] = var->type;
+				scope[var->name->name] = var.get();
+				indexes.erase(var->name->name);
+
+				if (nesting && (!var->value || as(ArrayNode, var->value))) {
+					enclosed.insert(var.get());
+				}
+
+				ranges[var.get()] = var->value ? intersect(range(var->value), declared(var.get())) : declared(var.get());
+			}
+
+			const Node *declaration(const std::string &name) {
+				auto found = scope.find(name);
+
+				return found != scope.end() ? found->second : nullptr;
+			}
+
+			/**
+			 * The values a declaration can hold given its type, any for a loop variable.
+			 */
+			static Range declared(const Node *key) {
+				auto var = dynamic_cast<const VarNode *>(key);
+
+				if (!var) {
+					return {};
+				}
+
+				return limits(var->type).value_or(Range());
+			}
+
+			/**
+			 * The values an integer or cardinal of fixed size holds.
+			 */
+			static std::optional<Range> limits(std::shared_ptr<TypeNode> type) {
+				if (!type || type->isArray() || !type->fixedSize || !type->size || type->size > 64) {
+					return std::nullopt;
+				}
+
+				auto bits = type->size;
+
+				if (type->name == "integer") {
+					return bits == 64 ? Range() : Range{-(int64_t(1) << (bits - 1)), (int64_t(1) << (bits - 1)) - 1};
+				}
+
+				if (type->name == "cardinal" && bits < 63) {
+					return Range{0, (int64_t(1) << bits) - 1};
+				}
+
+				return std::nullopt;
+			}
+
+			/**
+			 * The type arithmetic on node is done in, given by its widest operand of sized
+			 * integer type.  Literals and loop variables take the type of the other operand, or
+			 * integer(32).
+			 */
+			std::optional<std::shared_ptr<TypeNode>> typeOf(std::shared_ptr<Node> node) {
+				if (as(LiteralNode, node)) {
+					return std::shared_ptr<TypeNode>();
+				}
+
+				if (auto cast = as(CastNode, node)) {
+					return limits(cast->type) ? std::optional(cast->type) : std::nullopt;
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					auto key = declaration(identifier->name);
+
+					if (key && !dynamic_cast<const VarNode *>(key)) {
+						return std::shared_ptr<TypeNode>();
+					}
+
+					auto found = types.find(identifier->name);
+
+					if (found == types.end() || !limits(found->second)) {
+						return std::nullopt;
+					}
+
+					return found->second;
+				}
+
+				if (auto binary = as(BinaryNode, node)) {
+					auto left  = typeOf(binary->left);
+					auto right = typeOf(binary->right);
+
+					if (!left || !right) {
+						return std::nullopt;
+					}
+
+					if (!*left || !*right) {
+						return *left ? *left : *right;
+					}
+
+					if ((*left)->name != (*right)->name) {
+						return std::nullopt;
+					}
+
+					return (*left)->size >= (*right)->size ? *left : *right;
+				}
+
+				return std::nullopt;
+			}
+
+			bool fits(std::shared_ptr<BinaryNode> binary) {
+				if (binary->op != "+" && binary->op != "-" && binary->op != "*") {
+					return false;
+				}
+
+				auto type = typeOf(binary);
+
+				if (!type) {
+					return false;
+				}
+
+				auto bounds = *type ? *limits(*type) : Range{INT32_MIN, INT32_MAX};
+				auto result = range(binary);
+
+				if (result.low == INT64_MIN && result.high == INT64_MAX) {
+					return false;
+				}
+
+				return result.low >= bounds.low && result.high <= bounds.high;
+			}
+
+			Range range(std::shared_ptr<Node> node) {
+				if (auto literal = as(LiteralNode, node)) {
+					int64_t value = 0;
+					auto end      = literal->text.data() + literal->text.size();
+
+					if (literal->kind == LiteralNode::Kind::INTEGER && std::from_chars(literal->text.data(), end, value).ptr == end) {
+						return {value, value};
+					}
+
+					return {};
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					return valueOf(identifier->name);
+				}
+
+				if (auto binary = as(BinaryNode, node)) {
+					return arithmetic(binary->op, range(binary->left), range(binary->right));
+				}
+
+				if (auto cast = as(CastNode, node)) {
+					return intersect(range(cast->value), limits(cast->type).value_or(Range()));
+				}
+
+				return {};
+			}
+
+			Range valueOf(const std::string &name) {
+				auto key = declaration(name);
+
+				if (!key) {
+					return {};
+				}
+
+				if (unstable.count(name)) {
+					return declared(key);
+				}
+
+				auto found = ranges.find(key);
+
+				return found != ranges.end() ? found->second : declared(key);
+			}
+
+			/**
+			 * The range of results, any value when one may not fit in 64 bits.
+			 */
+			static Range arithmetic(const std::string &op, Range a, Range b) {
+				if (op == "%" && b.low == b.high && b.low > 0) {
+					return {a.low >= 0 ? 0 : 1 - b.low, b.low - 1};
+				}
+
+				if (op != "+" && op != "-" && op != "*") {
+					return {};
+				}
+
+				__int128 x[] = {a.low, a.high};
+				__int128 y[] = {b.low, b.high};
+				__int128 low = 0, high = 0;
+				bool first = true;
+
+				for (auto i: x) {
+					for (auto j: y) {
+						__int128 value = op == "+" ? i + j : op == "-" ? i - j : i * j;
+
+						low   = first ? value : std::min(low, value);
+						high  = first ? value : std::max(high, value);
+						first = false;
+					}
+				}
+
+				if (low < INT64_MIN || high > INT64_MAX) {
+					return {};
+				}
+
+				return {int64_t(low), int64_t(high)};
+			}
+
+			static Range intersect(Range a, Range b) {
+				return {std::max(a.low, b.low), std::min(a.high, b.high)};
+			}
+
+			/**
+			 * Widens what is known to what holds here or at the end of the other path.
+			 */
+			void join(const std::map<const Node *, Range> &other) {
+				for (auto &[key, value]: ranges) {
+					if (auto found = other.find(key); found != other.end()) {
+						value = {std::min(value.low, found->second.low), std::max(value.high, found->second.high)};
+					}
+				}
+			}
+
+			void refine(const std::string &name, Range bound) {
+				auto key = declaration(name);
+
+				if (key && !unstable.count(name)) {
+					ranges[key] = intersect(valueOf(name), bound);
+				}
+			}
+
+			/**
+			 * Narrows the ranges to where the condition holds, or fails to.
+			 */
+			void guard(std::shared_ptr<Node> condition, bool holds) {
+				auto binary = as(BinaryNode, condition);
+
+				if (!binary) {
+					return;
+				}
+
+				if ((binary->op == "and" && holds) || (binary->op == "or" && !holds)) {
+					guard(binary->left, holds);
+					guard(binary->right, holds);
+
+					return;
+				}
+
+				static const std::map<std::string, std::string> mirrored = {
+					{"<", ">"}, {">", "<"}, {"<=", ">="}, {">=", "<="}, {"=", "="}, {"<>", "<>"}
+				};
+
+				auto mirror = mirrored.find(binary->op);
+
+				if (mirror == mirrored.end()) {
+					return;
+				}
+
+				if (auto left = as(IdentifierNode, binary->left)) {
+					compare(left->name, binary->op, range(binary->right), holds);
+				}
+
+				if (auto right = as(IdentifierNode, binary->right)) {
+					compare(right->name, mirror->second, range(binary->left), holds);
+				}
+			}
+
+			void compare(const std::string &name, std::string op, Range other, bool holds) {
+				static const std::map<std::string, std::string> negated = {
+					{"<", ">="}, {">", "<="}, {"<=", ">"}, {">=", "<"}, {"=", "<>"}, {"<>", "="}
+				};
+
+				if (!holds) {
+					op = negated.at(op);
+				}
+
+				if (op == "<" && other.high > INT64_MIN) {
+					refine(name, {INT64_MIN, other.high - 1});
+				} else if (op == "<=") {
+					refine(name, {INT64_MIN, other.high});
+				} else if (op == ">" && other.low < INT64_MAX) {
+					refine(name, {other.low + 1, INT64_MAX});
+				} else if (op == ">=") {
+					refine(name, {other.low, INT64_MAX});
+				} else if (op == "=") {
+					refine(name, other);
+				}
+			}
+
+			/**
+			 * The values a branch of a case is taken for.
+			 */
+			Range values(const WhenNode &when) {
+				if (!when.values || when.values->list.empty()) {
+					return {};
+				}
+
+				Range result = {INT64_MAX, INT64_MIN};
+
+				for (auto &value: when.values->list) {
+					Range bound;
+
+					if (auto span = as(RangeNode, value)) {
+						bound = {range(span->low).low, range(span->high).high};
+					} else {
+						bound = range(value);
+					}
+
+					result = {std::min(result.low, bound.low), std::max(result.high, bound.high)};
+				}
+
+				return result;
+			}
+
+			/**
+			 * Gives every variable assigned within node any value of its type.
+			 */
+			void forget(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				for (auto &name: written(node)) {
+					if (auto key = declaration(name)) {
+						ranges[key] = declared(key);
+					}
+				}
+
+				for (auto &child: node->children()) {
+					forget(child);
+				}
+			}
+
+			/**
+			 * The names node writes, by assignment or, once lowered, by appending in place.
+			 */
+			static std::vector<std::string> written(std::shared_ptr<Node> node) {
+				std::vector<std::string> names;
+
+				if (auto assign = as(AssignNode, node)) {
+					for (auto &target: assign->targets->list) {
+						if (auto identifier = as(IdentifierNode, target)) {
+							names.push_back(identifier->name);
+						}
+					}
+				} else if (auto append = as(AppendNode, node)) {
+					names.push_back(append->target->name);
+				}
+
+				return names;
+			}
+
+			static bool assigns(std::shared_ptr<Node> node, const std::string &name) {
+				if (!node) {
+					return false;
+				}
+
+				auto names = written(node);
+
+				if (std::find(names.begin(), names.end(), name) != names.end()) {
+					return true;
+				}
+
+				for (auto &child: node->children()) {
+					if (assigns(child, name)) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			/**
+			 * Whether node assigns name or declares another by that name, including the
+			 * parameters and loop variables of anything nested.
+			 */
+			static bool rebinds(std::shared_ptr<Node> node, const std::string &name) {
+				return assigns(node, name) || declares(node, name);
+			}
+
+			static bool declares(std::shared_ptr<Node> node, const std::string &name) {
+				if (!node) {
+					return false;
+				}
+
+				if (auto var = as(VarNode, node); var && var->name->name == name) {
+					return true;
+				}
+
+				if (auto loop = as(ForNode, node); loop && loop->variable->name == name) {
+					return true;
+				}
+
+				for (auto &child: node->children()) {
+					if (declares(child, name)) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			/**
+			 * Finds the names functions assign without declaring them, which may change
+			 * whenever the function is called.
+			 */
+			void captured(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto literal = as(FunctionNode, node)) {
+					std::set<std::string> locals;
+
+					if (literal->params) {
+						for (auto &param: literal->params->list) {
+							if (auto var = as(VarNode, param)) {
+								locals.insert(var->name->name);
+							}
+						}
+					}
+
+					declared(literal->body, locals);
+					assigned(literal->body, locals);
+					mentioned(literal->body, locals);
+				}
+
+				for (auto &child: node->children()) {
+					captured(child);
+				}
+			}
+
+			static void declared(std::shared_ptr<Node> node, std::set<std::string> &locals) {
+				if (!node || as(FunctionNode, node)) {
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					locals.insert(var->name->name);
+				} else if (auto loop = as(ForNode, node)) {
+					locals.insert(loop->variable->name);
+				}
+
+				for (auto &child: node->children()) {
+					declared(child, locals);
+				}
+			}
+
+			void assigned(std::shared_ptr<Node> node, const std::set<std::string> &locals) {
+				if (!node) {
+					return;
+				}
+
+				for (auto &name: written(node)) {
+					if (!locals.count(name)) {
+						unstable.insert(name);
+					}
+				}
+
+				for (auto &child: node->children()) {
+					assigned(child, locals);
+				}
+			}
+
+			void mentioned(std::shared_ptr<Node> node, const std::set<std::string> &locals) {
+				if (!node) {
+					return;
+				}
+
+				if (auto identifier = as(IdentifierNode, node); identifier && !locals.count(identifier->name)) {
+					shared.insert(identifier->name);
+				}
+
+				for (auto &child: node->children()) {
+					mentioned(child, locals);
+				}
+			}
+
+			/**
+			 * Whether name is declared inside a function and no other function can reach it,
+			 * so that only the statements in view can change it.
+			 */
+			bool confined(const std::string &name) {
+				return enclosed.count(declaration(name)) && !shared.count(name);
+			}
+
+			bool inSpan(const IndexNode &index) {
+				auto target = as(IdentifierNode, index.target);
+
+				if (!target || !isArray(target->name)) {
+					return false;
+				}
+
+				if (auto variable = as(IdentifierNode, index.index)) {
+					if (indexes.count(variable->name) && indexes[variable->name] == target->name) {
+						return true;
+					}
+				}
+
+				auto values = range(index.index);
+
+				return span(target->name) && values.low >= 0 && uint64_t(values.high) < span(target->name);
+			}
+
+			bool isArray(const std::string &name) {
+				return types.count(name) && types[name] && types[name]->isArray();
+			}
+
+			std::size_t span(const std::string &name) {
+				return isArray(name) ? types[name]->span : 0;
+			}
+
+			/**
+			 * Conservatively, anything but indexing into the array may change its span, and so
+			 * may any call, function or method, when calls is set.
+			 */
+			static bool resizes(std::shared_ptr<Node> node, const std::string &name, bool calls) {
+				if (!node) {
+					return false;
+				}
+
+				if (calls && as(CallNode, node)) {
+					return true;
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					return identifier->name == name;
+				}
+
+				if (auto index = as(IndexNode, node)) {
+					if (auto target = as(IdentifierNode, index->target); target && target->name == name) {
+						return resizes(index->index, name, calls);
+					}
+				}
+
+				for (auto &child: node->children()) {
+					if (resizes(child, name, calls)) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+	};
+}
+
+#endif
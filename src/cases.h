@@ -0,0 +1,297 @@
+#ifndef __PINT_CASES_H
+#define __PINT_CASES_H
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tree.h"
+#include "runtime/dispatch.h"
+
+namespace pint {
+	/**
+	 * Chooses how each case dispatches, by the kind and density of its constant values:
+	 *
+	 * - integers and label values, single or in ranges, get a jump table when dense enough
+	 *   and a binary search over the sorted ranges otherwise
+	 * - strings get a perfect hash, so a lookup is one hash and one comparison
+	 *
+	 * Any other value keeps the chain of comparisons.  Where values overlap the first branch
+	 * wins, as in the chain, and a branch ending in `continue` still falls through to the next,
+	 * which only depends on the order branches are emitted in.
+	 */
+	class Cases {
+		public:
+			/**
+			 * At least this many values for a table, below it comparisons are as fast.
+			 */
+			static constexpr std::size_t MINIMUM = 3;
+
+			/**
+			 * At most this many table entries per value, and at most LARGEST entries.
+			 */
+			static constexpr std::size_t DENSITY = 4;
+			static constexpr std::size_t LARGEST = 0x10000;
+
+			/**
+			 * Seeds tried for a perfect hash before doubling its table.
+			 */
+			static constexpr uint64_t SEEDS = 256;
+
+			/**
+			 * Returns the number of cases not left as a chain.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				lowered = 0;
+
+				visit(node);
+
+				return lowered;
+			}
+
+		private:
+			std::size_t lowered = 0;
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto match = as(CaseNode, node)) {
+					lower(*match);
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			void lower(CaseNode &match) {
+				std::vector<CaseNode::Range> ranges;
+				std::vector<std::pair<std::string, int>> strings;
+				std::vector<std::shared_ptr<Node>> values;
+				std::optional<std::string> family;
+				bool dynamic = false;
+
+				match.fallback = -1;
+
+				for (std::size_t i = 0; i < match.branches->list.size(); i++) {
+					auto when = as(WhenNode, match.branches->list[i]);
+
+					when->fallthrough = when->body && !when->body->list.empty() && as(ContinueNode, when->body->list.back());
+
+					if (!when->values || when->values->list.empty()) {
+						if (match.fallback < 0) {
+							match.fallback = int(i);
+						}
+
+						continue;
+					}
+
+					values.clear();
+					flatten(when->values, values);
+
+					for (auto &value: values) {
+						if (auto literal = as(LiteralNode, value); literal && literal->kind == LiteralNode::Kind::STRING) {
+							strings.push_back({literal->text, int(i)});
+						} else if (auto range = this->range(value, family)) {
+							cover(ranges, {range->first, range->second, int(i)});
+						} else {
+							dynamic = true;
+						}
+					}
+				}
+
+				if (dynamic || (!ranges.empty() && !strings.empty())) {
+					return;
+				}
+
+				if (strings.size() >= MINIMUM) {
+					hash(match, strings);
+				} else if (ranges.size() >= MINIMUM) {
+					search(match, ranges);
+				}
+			}
+
+			static void flatten(std::shared_ptr<ListNode> list, std::vector<std::shared_ptr<Node>> &values) {
+				for (auto &value: list->list) {
+					if (auto set = as(ListNode, value)) {
+						flatten(set, values);
+					} else {
+						values.push_back(value);
+					}
+				}
+			}
+
+			/**
+			 * The integers a value covers.  Family is the label family of the values so far, or
+			 * empty for integers, and they cannot be mixed.
+			 */
+			static std::optional<std::pair<long, long>> range(std::shared_ptr<Node> value, std::optional<std::string> &family) {
+				if (auto range = as(RangeNode, value)) {
+					auto low  = constant(range->low, family);
+					auto high = constant(range->high, family);
+
+					if (!low || !high || *low > *high) {
+						return std::nullopt;
+					}
+
+					return std::make_pair(*low, *high);
+				}
+
+				if (auto single = constant(value, family)) {
+					return std::make_pair(*single, *single);
+				}
+
+				return std::nullopt;
+			}
+
+			static std::optional<long> constant(std::shared_ptr<Node> value, std::optional<std::string> &family) {
+				if (auto label = as(LabelValueNode, value)) {
+					if (label->code < 0 || (family && *family != label->family)) {
+						return std::nullopt;
+					}
+
+					family = label->family;
+
+					return label->code;
+				}
+
+				if (auto literal = as(LiteralNode, value); literal && literal->kind == LiteralNode::Kind::INTEGER) {
+					long result = 0;
+					auto end    = literal->text.data() + literal->text.size();
+
+					if ((family && !family->empty()) || std::from_chars(literal->text.data(), end, result).ptr != end) {
+						return std::nullopt;
+					}
+
+					family = "";
+
+					return result;
+				}
+
+				return std::nullopt;
+			}
+
+			/**
+			 * Adds the part of range not covered by an earlier branch, keeping ranges sorted.
+			 */
+			static void cover(std::vector<CaseNode::Range> &ranges, CaseNode::Range range) {
+				std::vector<CaseNode::Range> parts;
+				long next = range.low;
+				bool done = false;
+
+				for (auto &other: ranges) {
+					if (other.high < next || other.low > range.high) {
+						continue;
+					}
+
+					if (other.low > next) {
+						parts.push_back({next, other.low - 1, range.branch});
+					}
+
+					if (other.high >= range.high) {
+						done = true;
+						break;
+					}
+
+					next = other.high + 1;
+				}
+
+				if (!done) {
+					parts.push_back({next, range.high, range.branch});
+				}
+
+				ranges.insert(ranges.end(), parts.begin(), parts.end());
+
+				std::sort(ranges.begin(), ranges.end(), [](auto &a, auto &b) {
+					return a.low < b.low;
+				});
+			}
+
+			void search(CaseNode &match, std::vector<CaseNode::Range> &ranges) {
+				std::vector<CaseNode::Range> merged;
+				std::size_t covered = 0;
+
+				for (auto &range: ranges) {
+					covered += std::size_t(range.high - range.low) + 1;
+
+					if (!merged.empty() && merged.back().branch == range.branch && merged.back().high + 1 == range.low) {
+						merged.back().high = range.high;
+					} else {
+						merged.push_back(range);
+					}
+				}
+
+				std::size_t span = std::size_t(ranges.back().high - ranges.front().low) + 1;
+
+				if (span <= LARGEST && span <= covered * DENSITY) {
+					match.dispatch = CaseNode::Dispatch::TABLE;
+					match.first    = ranges.front().low;
+					match.table.assign(span, match.fallback);
+
+					for (auto &range: ranges) {
+						for (long value = range.low; value <= range.high; value++) {
+							match.table[value - match.first] = range.branch;
+						}
+					}
+				} else {
+					match.dispatch = CaseNode::Dispatch::SEARCH;
+					match.ranges   = merged;
+				}
+
+				lowered++;
+			}
+
+			/**
+			 * Searches for a seed under which every string gets its own slot, in a table of at
+			 * least twice as many slots as strings.
+			 */
+			void hash(CaseNode &match, std::vector<std::pair<std::string, int>> &strings) {
+				std::vector<std::pair<std::string, int>> unique;
+
+				for (auto &string: strings) {
+					if (std::none_of(unique.begin(), unique.end(), [&](auto &other) { return other.first == string.first; })) {
+						unique.push_back(string);
+					}
+				}
+
+				for (std::size_t size = std::bit_ceil(unique.size() * 2); ; size *= 2) {
+					for (uint64_t seed = 0; seed < SEEDS; seed++) {
+						std::vector<int> table(size, -1);
+						std::vector<std::string> keys(size);
+						bool perfect = true;
+
+						for (auto &[key, branch]: unique) {
+							std::size_t slot = dispatch::hash(key, seed) & (size - 1);
+
+							if (table[slot] >= 0) {
+								perfect = false;
+								break;
+							}
+
+							table[slot] = branch;
+							keys[slot]  = key;
+						}
+
+						if (perfect) {
+							match.dispatch = CaseNode::Dispatch::HASH;
+							match.seed     = seed;
+							match.table    = std::move(table);
+							match.keys     = std::move(keys);
+
+							lowered++;
+
+							return;
+						}
+					}
+				}
+			}
+	};
+}
+
+#endif
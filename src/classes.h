@@ -0,0 +1,382 @@
+#ifndef __PINT_CLASSES_H
+#define __PINT_CLASSES_H
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Lays out the methods of classes, interfaces and implementations in vtables, see
+	 * ClassNode, and chooses how each method call on a receiver of known type is made.
+	 *
+	 * Classes cannot be extended, so a call on a class is always direct.  A call on an
+	 * interface or an implementation, `this` within one or a `T of Repository`, goes through
+	 * an itable with a per-site cache, see ItableCache, since a unit compiled later may add
+	 * classes using it.
+	 *
+	 * Only when the tree is the closed set of every unit of the program does whole-program
+	 * class hierarchy analysis look at the classes using it: the call is direct when there is
+	 * a single function behind it among them, and a call on an implementation goes through
+	 * the vtable when the method has the same slot in every such class, as it has when they
+	 * all use the implementation first.
+	 */
+	class Classes {
+		public:
+			/**
+			 * Direct calls to callees of at most this many nodes are inlined.
+			 */
+			static constexpr std::size_t INLINE = 32;
+
+			/**
+			 * Closed is set when the tree holds every unit of the program.
+			 */
+			Classes(bool closed = false) {
+				this->closed = closed;
+			}
+
+			/**
+			 * Returns the number of method calls made direct.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				forms.clear();
+				done.clear();
+				users.clear();
+				types.clear();
+				bounds.clear();
+				self = nullptr;
+				direct = 0;
+
+				collect(node);
+
+				for (auto &[name, form]: forms) {
+					layout(form.get());
+				}
+
+				for (auto &[name, form]: forms) {
+					if (form->kind == ClassNode::Kind::CLASS) {
+						for (auto &[used, slots]: form->itables) {
+							users[used].push_back(form.get());
+						}
+					}
+				}
+
+				visit(node);
+
+				return direct;
+			}
+
+		private:
+			std::map<std::string, std::shared_ptr<ClassNode>> forms;
+			std::map<ClassNode *, bool> done;
+			std::map<std::string, std::vector<ClassNode *>> users;
+			std::map<std::string, std::shared_ptr<TypeNode>> types;
+			std::map<std::string, std::string> bounds;
+			ClassNode *self = nullptr;
+			std::size_t direct = 0;
+			bool closed;
+
+			void collect(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto form = as(ClassNode, node)) {
+					forms[form->name->name] = form;
+				}
+
+				for (auto &child: node->children()) {
+					collect(child);
+				}
+			}
+
+			ClassNode *find(std::shared_ptr<Node> base) {
+				std::string name;
+
+				if (auto identifier = as(IdentifierNode, base)) {
+					name = identifier->name;
+				} else if (auto type = as(TypeNode, base)) {
+					name = type->name;
+				}
+
+				auto found = forms.find(name);
+
+				return found != forms.end() ? found->second.get() : nullptr;
+			}
+
+			void layout(ClassNode *form) {
+				if (auto found = done.find(form); found != done.end()) {
+					if (!found->second) {
+						throw std::runtime_error(form->name->name + " uses itself");
+					}
+
+					return;
+				}
+
+				done[form] = false;
+
+				std::vector<ClassNode *> bases;
+
+				if (form->bases) {
+					for (auto &item: form->bases->list) {
+						if (auto base = find(item)) {
+							layout(base);
+							bases.push_back(base);
+						}
+					}
+				}
+
+				form->vtable.clear();
+				form->itables.clear();
+
+				auto first = std::find_if(bases.begin(), bases.end(), [](auto base) {
+					return base->kind == ClassNode::Kind::IMPLEMENTATION;
+				});
+
+				if (form->kind != ClassNode::Kind::INTERFACE && first != bases.end()) {
+					form->vtable = (*first)->vtable;
+				}
+
+				for (auto base: bases) {
+					for (auto &method: base->vtable) {
+						add(*form, method);
+					}
+				}
+
+				if (form->body) {
+					for (auto &item: form->body->list) {
+						auto var = as(VarNode, item);
+
+						if (var && (form->kind == ClassNode::Kind::INTERFACE || as(FunctionNode, var->value))) {
+							add(*form, {var->name->name, as(FunctionNode, var->value)});
+						}
+					}
+				}
+
+				for (auto base: bases) {
+					itable(*form, *base);
+
+					for (auto &[used, slots]: base->itables) {
+						itable(*form, *forms[used]);
+					}
+				}
+
+				done[form] = true;
+			}
+
+			/**
+			 * Adds a method, or overrides the one in the same slot.  Methods an interface only
+			 * declares never replace a function.
+			 */
+			static void add(ClassNode &form, ClassNode::Method method) {
+				for (auto &existing: form.vtable) {
+					if (existing.name == method.name) {
+						if (method.function) {
+							existing.function = method.function;
+						}
+
+						return;
+					}
+				}
+
+				form.vtable.push_back(method);
+			}
+
+			static void itable(ClassNode &form, const ClassNode &used) {
+				std::vector<int> slots;
+
+				for (auto &method: used.vtable) {
+					int slot = slotOf(form, method.name);
+
+					if (form.kind == ClassNode::Kind::CLASS && !form.vtable[slot].function) {
+						throw std::runtime_error("Class " + form.name->name + " does not implement " + used.name->name + "." + method.name);
+					}
+
+					slots.push_back(slot);
+				}
+
+				form.itables[used.name->name] = slots;
+			}
+
+			static int slotOf(const ClassNode &form, const std::string &name) {
+				for (std::size_t i = 0; i < form.vtable.size(); i++) {
+					if (form.vtable[i].name == name) {
+						return int(i);
+					}
+				}
+
+				return -1;
+			}
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto form = as(ClassNode, node)) {
+					auto outer = bounds;
+					auto owner = self;
+
+					self = form.get();
+
+					if (form->parameters) {
+						for (auto &item: form->parameters->list) {
+							auto parameter = as(VarNode, item);
+
+							if (parameter->type) {
+								bounds[parameter->name->name] = parameter->type->name;
+							}
+						}
+					}
+
+					visit(form->body);
+
+					self   = owner;
+					bounds = outer;
+
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					visit(var->value);
+
+					types[var->name->name] = var->type;
+
+					return;
+				}
+
+				if (as(FunctionNode, node)) {
+					auto outer = types;
+
+					for (auto &child: node->children()) {
+						visit(child);
+					}
+
+					types = outer;
+
+					return;
+				}
+
+				if (auto call = as(CallNode, node)) {
+					if (auto member = as(MemberNode, call->target)) {
+						if (auto receiver = this->receiver(member->target)) {
+							dispatch(*call, *receiver, member->name->name);
+						}
+					}
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			/**
+			 * The class, interface or implementation a receiver is known to be.
+			 */
+			ClassNode *receiver(std::shared_ptr<Node> target) {
+				auto identifier = as(IdentifierNode, target);
+
+				if (!identifier) {
+					return nullptr;
+				}
+
+				if (identifier->name == "this") {
+					return self;
+				}
+
+				auto found = types.find(identifier->name);
+
+				if (found == types.end() || !found->second) {
+					return nullptr;
+				}
+
+				auto name  = found->second->name;
+				auto bound = bounds.find(name);
+
+				if (bound != bounds.end()) {
+					name = bound->second;
+				}
+
+				auto form = forms.find(name);
+
+				return form != forms.end() ? form->second.get() : nullptr;
+			}
+
+			void dispatch(CallNode &call, ClassNode &receiver, const std::string &name) {
+				int slot = slotOf(receiver, name);
+
+				if (slot < 0) {
+					return;
+				}
+
+				if (receiver.kind == ClassNode::Kind::CLASS) {
+					devirtualize(call, receiver.vtable[slot].function);
+
+					return;
+				}
+
+				if (!closed) {
+					call.dispatch = CallNode::Dispatch::INTERFACE;
+					call.slot     = slot;
+
+					return;
+				}
+
+				std::set<FunctionNode *> targets;
+				std::shared_ptr<FunctionNode> target;
+				bool prefix = true;
+
+				for (auto user: users[receiver.name->name]) {
+					int at = user->itables[receiver.name->name][slot];
+
+					target = user->vtable[at].function;
+					prefix = prefix && at == slot;
+
+					targets.insert(target.get());
+				}
+
+				if (targets.size() == 1) {
+					devirtualize(call, target);
+				} else if (receiver.kind == ClassNode::Kind::IMPLEMENTATION && prefix && !targets.empty()) {
+					call.dispatch = CallNode::Dispatch::VIRTUAL;
+					call.slot     = slot;
+				} else {
+					call.dispatch = CallNode::Dispatch::INTERFACE;
+					call.slot     = slot;
+				}
+			}
+
+			void devirtualize(CallNode &call, std::shared_ptr<FunctionNode> callee) {
+				if (!callee) {
+					return;
+				}
+
+				std::size_t nodes = 0;
+
+				call.dispatch = CallNode::Dispatch::DIRECT;
+				call.callee   = callee;
+				call.inlined  = count(callee, nodes) <= INLINE;
+
+				direct++;
+			}
+
+			static std::size_t count(std::shared_ptr<Node> node, std::size_t &nodes) {
+				if (node && nodes <= INLINE) {
+					nodes++;
+
+					for (auto &child: node->children()) {
+						count(child, nodes);
+					}
+				}
+
+				return nodes;
+			}
+	};
+}
+
+#endif
@@ -1,5 +1,20 @@
 #include "tree.h"
 #include "parser.h"
+#include "bounds.h"
+#include "cases.h"
+#include "classes.h"
+#include "concat.h"
+#include "constants.h"
+#include "escape.h"
+#include "formats.h"
+#include "generics.h"
+#include "inference.h"
+#include "labels.h"
+#include "loops.h"
+#include "mapping.h"
+#include "pipelines.h"
+#include "records.h"
+#include "sites.h"
 
 namespace pint {
 	class Compiler {
@@ -12,7 +27,24 @@ namespace pint {
 			 *
 			 */
 			void parse(const std::string &code) {
-				parser->parse(code);
+				tree = parser->parse(code);
+
+				Constants().run(tree);
+				Inference().run(tree);
+				Formats().run(tree);
+				VariadicEscape().run(tree);
+				ClosureEscape().run(tree);
+				Generics().run(tree);
+				Records().run(tree);
+				Classes().run(tree);
+				Labels().run(tree);
+				Cases().run(tree);
+				BoundsCheck().run(tree);
+				Concatenation().run(tree);
+				Loops().run(tree);
+				Mapping().run(tree);
+				Pipelines().run(tree);
+				CacheSites().run(tree);
 			}
 
 
@@ -22,6 +54,11 @@ namespace pint {
 			 */
 			std::unique_ptr<syntax::parser> parser;
 
+			/**
+			 * The syntax tree of the last parsed code.
+			 */
+			std::shared_ptr<Node> tree;
+
 			/**
 			 *
 			 */
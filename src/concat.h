@@ -0,0 +1,175 @@
+#ifndef __PINT_CONCAT_H
+#define __PINT_CONCAT_H
+
+#include <map>
+#include <string>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Lowers accumulation by concatenation, `x = x + a + b` and `x += a`, to an in-place append of
+	 * each part.  Appending in order is exactly the left-associative evaluation of the original
+	 * expression, but the target grows in place with amortized O(1) appends instead of building
+	 * a new value on every iteration.  This includes the implicit `return` variable.
+	 *
+	 * Only targets declared with a static string type, `string` or `char(N)[]`, are lowered, as
+	 * `+` on anything else may be arithmetic.
+	 */
+	class Concatenation {
+		public:
+			/**
+			 * Returns the number of assignments that were lowered.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				lowered = 0;
+
+				visit(node);
+
+				return lowered;
+			}
+
+		private:
+			std::map<std::string, std::shared_ptr<TypeNode>> types;
+			std::size_t lowered = 0;
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					visit(var->value);
+
+					types[var->name->name] = var->type;
+
+					return;
+				}
+
+				if (auto function = as(FunctionNode, node)) {
+					auto outer = types;
+
+					types["return"] = function->type;
+
+					visit(function->params);
+					visit(function->body);
+
+					types = outer;
+
+					return;
+				}
+
+				if (auto loop = as(ForNode, node)) {
+					auto outer = types;
+
+					visit(loop->subject);
+					visit(loop->limit);
+
+					types.erase(loop->variable->name);
+					visit(loop->body);
+
+					types = outer;
+
+					return;
+				}
+
+				if (auto list = as(ListNode, node)) {
+					for (auto &item: list->list) {
+						if (auto assign = as(AssignNode, item)) {
+							if (auto append = lower(*assign)) {
+								item = append;
+								lowered++;
+							}
+						}
+
+						visit(item);
+					}
+
+					return;
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			bool isString(const std::string &name) const {
+				auto found = types.find(name);
+
+				if (found == types.end() || !found->second || !found->second->fixedType) {
+					return false;
+				}
+
+				auto &type = *found->second;
+
+				if (type.isArray()) {
+					return type.span == 0 && type.element->name == "char";
+				}
+
+				return type.name == "string";
+			}
+
+			std::shared_ptr<AppendNode> lower(const AssignNode &assign) {
+				if (assign.targets->list.size() != 1) {
+					return nullptr;
+				}
+
+				auto target = as(IdentifierNode, assign.targets->list.front());
+				auto parts  = std::make_shared<ListNode>();
+
+				if (!target || !isString(target->name)) {
+					return nullptr;
+				}
+
+				if (assign.op == "+=") {
+					parts->list.push_back(assign.value);
+
+				} else if (assign.op == "=") {
+					std::shared_ptr<Node> operand = assign.value;
+
+					while (auto binary = as(BinaryNode, operand)) {
+						if (binary->op != "+") {
+							return nullptr;
+						}
+
+						parts->list.insert(parts->list.begin(), binary->right);
+						operand = binary->left;
+					}
+
+					auto first = as(IdentifierNode, operand);
+
+					if (parts->list.empty() || !first || first->name != target->name) {
+						return nullptr;
+					}
+
+					if (parts->list.size() > 1 && mentions(parts, target->name)) {
+						return nullptr;
+					}
+
+				} else {
+					return nullptr;
+				}
+
+				return std::make_shared<AppendNode>(target, parts);
+			}
+
+			/**
+			 * Later parts must not see the earlier appends, so the target may not be read by them.
+			 */
+			static bool mentions(std::shared_ptr<Node> node, const std::string &name) {
+				if (auto identifier = as(IdentifierNode, node)) {
+					return identifier->name == name;
+				}
+
+				for (auto &child: node->children()) {
+					if (child && mentions(child, name)) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,668 @@
+#ifndef __PINT_CONSTANTS_H
+#define __PINT_CONSTANTS_H
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "tree.h"
+#include "runtime/format.h"
+
+namespace pint {
+	/**
+	 * Folds constant expressions over the whole program.  A `set` is assigned once, so every
+	 * use of one whose value folds to a literal, or a literal cast such as `10:char(8)`, is
+	 * replaced by a copy of it, which is emitted as an immediate, or as read-only data for
+	 * strings, instead of a load from a global.  This includes the unit-qualified uses from
+	 * other units, `io.EOL`, and constant sizes, `char(WIDTH)`.
+	 *
+	 * Arithmetic, comparisons and concatenation of literals are folded, as is `format` on a
+	 * literal pattern whose arguments are all literals.  Anything that could fail at runtime,
+	 * an overflow, a division that is not exact or an unknown format, is left as it is.  The
+	 * value of a constant declared as an integer or cardinal keeps its type, and arithmetic on
+	 * it overflows past the widest of its operands' types, `set A: integer(8) = 127; A + 1`,
+	 * and past 64 bits on literals alone.
+	 */
+	class Constants {
+		public:
+			/**
+			 * Returns the number of expressions folded.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				globals.clear();
+				locals.clear();
+				shadowed.clear();
+				types.clear();
+				unit.clear();
+				functions = 0;
+				folded    = 0;
+
+				collect(node);
+
+				unit.clear();
+				fold(node);
+
+				return folded;
+			}
+
+		private:
+			/**
+			 * A `set` outside any function, folded the first time it is used.
+			 */
+			struct Global {
+				VarNode *var;
+				std::string unit;
+				bool pending = false;
+				bool done = false;
+			};
+
+			std::map<std::string, Global> globals;
+			std::map<std::string, std::shared_ptr<Node>> locals;
+			std::set<std::string> shadowed;
+			std::map<std::shared_ptr<Node>, std::shared_ptr<TypeNode>> types;
+			std::string unit;
+			std::size_t functions = 0;
+			std::size_t folded = 0;
+
+			void collect(std::shared_ptr<Node> node) {
+				if (auto list = as(ListNode, node)) {
+					auto outer = unit;
+
+					for (auto &item: list->list) {
+						if (auto declaration = as(UnitNode, item)) {
+							unit = declaration->name();
+						} else if (auto var = as(VarNode, item); var && var->constant) {
+							globals[unit + "." + var->name->name] = {var.get(), unit};
+						} else {
+							collect(item);
+						}
+					}
+
+					unit = outer;
+				}
+			}
+
+			static bool constant(std::shared_ptr<Node> node) {
+				if (auto cast = as(CastNode, node)) {
+					return as(LiteralNode, cast->value) != nullptr;
+				}
+
+				return as(LiteralNode, node) != nullptr;
+			}
+
+			static std::shared_ptr<Node> copy(std::shared_ptr<Node> node) {
+				if (auto cast = as(CastNode, node)) {
+					return std::make_shared<CastNode>(copy(cast->value), cast->type);
+				}
+
+				auto literal = as(LiteralNode, node);
+
+				return std::make_shared<LiteralNode>(literal->kind, literal->text);
+			}
+
+			/**
+			 * A copy of the value of a constant, of the same type.
+			 */
+			std::shared_ptr<Node> use(std::shared_ptr<Node> value) {
+				auto result = copy(value);
+
+				if (auto type = types.find(value); type != types.end()) {
+					types[result] = type->second;
+				}
+
+				return result;
+			}
+
+			/**
+			 * Records the type of a constant declared as an integer or cardinal.
+			 */
+			void typed(const VarNode &var) {
+				auto &type = var.type;
+
+				if (var.constant && as(LiteralNode, var.value) && type && !type->isArray() && (type->name == "integer" || type->name == "cardinal") && (!type->fixedSize || type->size)) {
+					types[var.value] = type;
+				}
+			}
+
+			/**
+			 * The constant value of a name, qualified with its unit or not, if it has one.
+			 */
+			std::shared_ptr<Node> resolve(const std::string &name) {
+				if (auto local = locals.find(name); local != locals.end()) {
+					return local->second;
+				}
+
+				if (shadowed.count(name)) {
+					return nullptr;
+				}
+
+				auto found = globals.find(name.find('.') == std::string::npos ? unit + "." + name : name);
+
+				if (found == globals.end()) {
+					return nullptr;
+				}
+
+				auto &global = found->second;
+
+				if (!global.done && !global.pending) {
+					auto outerUnit     = unit;
+					auto outerLocals   = std::move(locals);
+					auto outerShadowed = std::move(shadowed);
+
+					global.pending = true;
+					unit           = global.unit;
+					locals.clear();
+					shadowed.clear();
+
+					global.var->setValue(fold(global.var->value));
+					typed(*global.var);
+
+					unit           = outerUnit;
+					locals         = std::move(outerLocals);
+					shadowed       = std::move(outerShadowed);
+					global.pending = false;
+					global.done    = true;
+				}
+
+				return global.done && constant(global.var->value) ? global.var->value : nullptr;
+			}
+
+			/**
+			 * Declares a local, which hides any constant of the same name unless it is one.
+			 */
+			void declare(const std::string &name, std::shared_ptr<Node> value) {
+				if (value) {
+					locals[name] = value;
+					shadowed.erase(name);
+				} else {
+					locals.erase(name);
+					shadowed.insert(name);
+				}
+			}
+
+			void size(std::shared_ptr<TypeNode> type) {
+				if (!type) {
+					return;
+				}
+
+				size(type->element);
+
+				auto literal = as(LiteralNode, fold(type->expression));
+
+				if (literal && literal->kind == LiteralNode::Kind::INTEGER) {
+					type->setSize(std::stoul(literal->text));
+					type->expression = nullptr;
+				}
+			}
+
+			/**
+			 * Returns what node folds to, folding what it contains in place.
+			 */
+			std::shared_ptr<Node> fold(std::shared_ptr<Node> node) {
+				if (!node) {
+					return node;
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					if (auto value = resolve(identifier->name)) {
+						folded++;
+
+						return use(value);
+					}
+
+					return node;
+				}
+
+				if (auto member = as(MemberNode, node)) {
+					auto target = as(IdentifierNode, member->target);
+
+					if (target && !locals.count(target->name) && !shadowed.count(target->name)) {
+						if (auto value = resolve(target->name + "." + member->name->name)) {
+							folded++;
+
+							return use(value);
+						}
+					}
+
+					member->target = fold(member->target);
+
+					return node;
+				}
+
+				if (auto list = as(ListNode, node)) {
+					auto outer = unit;
+
+					for (auto &item: list->list) {
+						if (auto declaration = as(UnitNode, item)) {
+							unit = declaration->name();
+						}
+
+						item = fold(item);
+					}
+
+					unit = outer;
+
+					return node;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					size(var->type);
+					var->setValue(fold(var->value));
+					typed(*var);
+
+					if (functions > 0) {
+						declare(var->name->name, var->constant && constant(var->value) ? var->value : nullptr);
+					}
+
+					return node;
+				}
+
+				if (auto function = as(FunctionNode, node)) {
+					auto outerLocals   = locals;
+					auto outerShadowed = shadowed;
+
+					functions++;
+					size(function->type);
+
+					if (function->params) {
+						for (auto &param: function->params->list) {
+							auto var = as(VarNode, param);
+
+							size(var->type);
+							var->setValue(fold(var->value));
+							declare(var->name->name, nullptr);
+						}
+					}
+
+					fold(function->body);
+					functions--;
+
+					locals   = outerLocals;
+					shadowed = outerShadowed;
+
+					return node;
+				}
+
+				if (auto loop = as(ForNode, node)) {
+					loop->subject = fold(loop->subject);
+					loop->limit   = fold(loop->limit);
+
+					declare(loop->variable->name, nullptr);
+					fold(loop->body);
+
+					return node;
+				}
+
+				if (auto binary = as(BinaryNode, node)) {
+					binary->left  = fold(binary->left);
+					binary->right = fold(binary->right);
+
+					if (auto result = evaluate(*binary)) {
+						folded++;
+
+						return result;
+					}
+
+					return node;
+				}
+
+				if (auto cast = as(CastNode, node)) {
+					size(cast->type);
+					cast->value = fold(cast->value);
+
+					return node;
+				}
+
+				if (auto call = as(CallNode, node)) {
+					if (!as(IdentifierNode, call->target)) {
+						call->target = fold(call->target);
+					}
+
+					fold(call->args);
+
+					if (auto result = format(*call)) {
+						folded++;
+
+						return result;
+					}
+
+					return node;
+				}
+
+				if (auto index = as(IndexNode, node)) {
+					index->target = fold(index->target);
+					index->index  = fold(index->index);
+
+					return node;
+				}
+
+				if (auto assign = as(AssignNode, node)) {
+					for (auto &target: assign->targets->list) {
+						if (!as(IdentifierNode, target)) {
+							target = fold(target);
+						}
+					}
+
+					assign->value = fold(assign->value);
+
+					return node;
+				}
+
+				if (auto result = as(ReturnNode, node)) {
+					result->value = fold(result->value);
+
+					return node;
+				}
+
+				if (auto branch = as(IfNode, node)) {
+					branch->condition = fold(branch->condition);
+
+					fold(branch->then);
+					fold(branch->otherwise);
+
+					return node;
+				}
+
+				if (auto range = as(RangeNode, node)) {
+					range->low  = fold(range->low);
+					range->high = fold(range->high);
+
+					return node;
+				}
+
+				if (auto match = as(CaseNode, node)) {
+					match->subject = fold(match->subject);
+				}
+
+				if (auto append = as(AppendNode, node)) {
+					fold(append->parts);
+
+					return node;
+				}
+
+				for (auto &child: node->children()) {
+					fold(child);
+				}
+
+				return node;
+			}
+
+			static std::optional<int64_t> integer(const LiteralNode &literal) {
+				int64_t value = 0;
+				auto end      = literal.text.data() + literal.text.size();
+
+				if (literal.kind != LiteralNode::Kind::INTEGER || std::from_chars(literal.text.data(), end, value).ptr != end) {
+					return std::nullopt;
+				}
+
+				return value;
+			}
+
+			static std::optional<double> real(const LiteralNode &literal) {
+				if (literal.kind == LiteralNode::Kind::INTEGER) {
+					if (auto value = integer(literal)) {
+						return double(*value);
+					}
+				}
+
+				if (literal.kind != LiteralNode::Kind::REAL) {
+					return std::nullopt;
+				}
+
+				return std::stod(literal.text);
+			}
+
+			static std::shared_ptr<Node> boolean(bool value) {
+				return std::make_shared<LiteralNode>(LiteralNode::Kind::BOOLEAN, value ? "true" : "false");
+			}
+
+			template <typename T>
+			static std::shared_ptr<Node> compare(const std::string &op, const T &a, const T &b) {
+				if (op == "=") return boolean(a == b);
+				if (op == "<>") return boolean(a != b);
+				if (op == "<") return boolean(a < b);
+				if (op == ">") return boolean(a > b);
+				if (op == "<=") return boolean(a <= b);
+				if (op == ">=") return boolean(a >= b);
+
+				return nullptr;
+			}
+
+			/**
+			 * The result of an integer operation, unless it overflows or is inexact.
+			 */
+			static std::optional<int64_t> arithmetic(const std::string &op, int64_t a, int64_t b) {
+				int64_t result = 0;
+
+				if (op == "+" && !__builtin_add_overflow(a, b, &result)) {
+					return result;
+				}
+
+				if (op == "-" && !__builtin_sub_overflow(a, b, &result)) {
+					return result;
+				}
+
+				if (op == "*" && !__builtin_mul_overflow(a, b, &result)) {
+					return result;
+				}
+
+				if ((op != "/" && op != "%") || b == 0 || (a == INT64_MIN && b == -1)) {
+					return std::nullopt;
+				}
+
+				if (op == "%") {
+					return a % b;
+				}
+
+				if (a % b != 0) {
+					return std::nullopt;
+				}
+
+				return a / b;
+			}
+
+			/**
+			 * The widest type of the operands of binary, if either has one.
+			 */
+			std::shared_ptr<TypeNode> widest(const BinaryNode &binary) {
+				std::shared_ptr<TypeNode> result;
+
+				for (auto &operand: {binary.left, binary.right}) {
+					auto found = types.find(operand);
+
+					if (found != types.end() && (!result || bits(*found->second) > bits(*result))) {
+						result = found->second;
+					}
+				}
+
+				return result;
+			}
+
+			static bool fits(int64_t value, const TypeNode &type) {
+				auto size = bits(type);
+
+				if (type.name == "cardinal") {
+					return value >= 0 && (size >= 63 || value < (int64_t(1) << size));
+				}
+
+				return size >= 64 || (value >= -(int64_t(1) << (size - 1)) && value < (int64_t(1) << (size - 1)));
+			}
+
+			static std::size_t bits(const TypeNode &type) {
+				return type.fixedSize ? type.size : 32;
+			}
+
+			std::shared_ptr<Node> evaluate(const BinaryNode &binary) {
+				auto left  = as(LiteralNode, binary.left);
+				auto right = as(LiteralNode, binary.right);
+				auto &op   = binary.op;
+
+				if (!left || !right) {
+					return nullptr;
+				}
+
+				if (left->kind == LiteralNode::Kind::STRING && right->kind == LiteralNode::Kind::STRING) {
+					if (op == "+") {
+						return std::make_shared<LiteralNode>(LiteralNode::Kind::STRING, left->text + right->text);
+					}
+
+					return compare(op, left->text, right->text);
+				}
+
+				auto a = integer(*left);
+				auto b = integer(*right);
+
+				if (a && b) {
+					auto type = widest(binary);
+
+					if (auto result = arithmetic(op, *a, *b); result && (!type || fits(*result, *type))) {
+						auto literal = std::make_shared<LiteralNode>(LiteralNode::Kind::INTEGER, std::to_string(*result));
+
+						if (type) {
+							types[literal] = type;
+						}
+
+						return literal;
+					}
+
+					return compare(op, *a, *b);
+				}
+
+				auto x = real(*left);
+				auto y = real(*right);
+
+				if (x && y) {
+					double result;
+
+					if (op == "+") {
+						result = *x + *y;
+					} else if (op == "-") {
+						result = *x - *y;
+					} else if (op == "*") {
+						result = *x * *y;
+					} else if (op == "/" && *y != 0) {
+						result = *x / *y;
+					} else {
+						return compare(op, *x, *y);
+					}
+
+					if (!std::isfinite(result)) {
+						return nullptr;
+					}
+
+					char text[32];
+					auto end = std::to_chars(text, text + sizeof(text), result).ptr;
+
+					std::string digits(text, end);
+
+					if (digits.find_first_of(".e") == std::string::npos) {
+						digits += ".0";
+					}
+
+					return std::make_shared<LiteralNode>(LiteralNode::Kind::REAL, digits);
+				}
+
+				return nullptr;
+			}
+
+			/**
+			 * `'...'.format(...)` on literals, read with format::spec and written with a
+			 * format::Builder like at runtime, so folding cannot change what is written.  A
+			 * specifier not taking its literal, `%d` on a real, is left to runtime.
+			 */
+			static std::shared_ptr<Node> format(const CallNode &call) {
+				auto member  = as(MemberNode, call.target);
+				auto pattern = member ? as(LiteralNode, member->target) : nullptr;
+
+				if (!pattern || pattern->kind != LiteralNode::Kind::STRING || member->name->name != "format" || !call.args) {
+					return nullptr;
+				}
+
+				auto &args = call.args->list;
+				std::string_view text = pattern->text;
+				format::Builder builder(text.size());
+				std::size_t next = 0;
+				std::size_t from = 0;
+
+				try {
+					for (std::size_t at = text.find('%'); at != std::string_view::npos; at = text.find('%', from)) {
+						builder.text(text.substr(from, at - from));
+
+						from = at + 1;
+
+						auto spec = format::spec(text, from);
+
+						if (spec.kind == '%') {
+							builder.text("%");
+							continue;
+						}
+
+						auto arg = next < args.size() ? as(LiteralNode, args[next++]) : nullptr;
+
+						if (!arg || !put(builder, *arg, spec)) {
+							return nullptr;
+						}
+					}
+				} catch (const std::invalid_argument &) {
+					return nullptr;
+				}
+
+				if (next != args.size()) {
+					return nullptr;
+				}
+
+				return std::make_shared<LiteralNode>(LiteralNode::Kind::STRING, std::string(builder.text(text.substr(from)).done().view()));
+			}
+
+			/**
+			 * Writes the literal as the value it stands for, unless the specifier does not take it.
+			 */
+			static bool put(format::Builder &builder, const LiteralNode &literal, format::Spec spec) {
+				switch (literal.kind) {
+					case LiteralNode::Kind::INTEGER:
+						if (auto value = integer(literal)) {
+							builder.put(*value, spec);
+
+							return true;
+						}
+
+						return false;
+
+					case LiteralNode::Kind::REAL:
+						if (spec.kind == 'd') {
+							return false;
+						}
+
+						builder.put(*real(literal), spec);
+
+						return true;
+
+					case LiteralNode::Kind::STRING:
+						if (spec.kind != 's') {
+							return false;
+						}
+
+						builder.put(std::string_view(literal.text), spec);
+
+						return true;
+
+					default:
+						if (spec.kind != 's') {
+							return false;
+						}
+
+						builder.put(literal.text == "true", spec);
+
+						return true;
+				}
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,430 @@
+#ifndef __PINT_ESCAPE_H
+#define __PINT_ESCAPE_H
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Finds the variadic parameters (`...parts`) whose list never escapes the call.  Those are
+	 * passed as a Variadic, a span over the caller's stack, and only the others are copied to
+	 * the heap on entry.
+	 *
+	 * A list does not escape when it is only iterated (`for var part in parts`), indexed or has
+	 * its length read.  Any other use, including capture by a nested function, is an escape.
+	 */
+	class VariadicEscape {
+		public:
+			/**
+			 * Returns the number of variadic parameters which were found not to escape.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				contained = 0;
+
+				visit(node);
+
+				return contained;
+			}
+
+		private:
+			std::size_t contained = 0;
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto function = as(FunctionNode, node); function && function->params) {
+					for (auto &item: function->params->list) {
+						auto param = as(VarNode, item);
+
+						if (param && param->variadic) {
+							param->escapes = escapes(function->body, param->name->name);
+
+							if (!param->escapes) {
+								contained++;
+							}
+						}
+					}
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			static bool escapes(std::shared_ptr<Node> node, const std::string &name) {
+				if (!node) {
+					return false;
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					return identifier->name == name;
+				}
+
+				if (auto function = as(FunctionNode, node)) {
+					return !declares(function->params, name) && mentions(function->body, name);
+				}
+
+				if (auto list = as(ListNode, node)) {
+					for (auto &item: list->list) {
+						if (escapes(item, name)) {
+							return true;
+						}
+
+						if (auto var = as(VarNode, item); var && var->name->name == name) {
+							return false;
+						}
+					}
+
+					return false;
+				}
+
+				if (auto loop = as(ForNode, node)) {
+					auto subject = as(IdentifierNode, loop->subject);
+
+					if (!(subject && subject->name == name && loop->kind != ForNode::Kind::TO) && escapes(loop->subject, name)) {
+						return true;
+					}
+
+					if (escapes(loop->limit, name)) {
+						return true;
+					}
+
+					return loop->variable->name != name && escapes(loop->body, name);
+				}
+
+				if (auto index = as(IndexNode, node)) {
+					auto target = as(IdentifierNode, index->target);
+
+					if (target && target->name == name) {
+						return escapes(index->index, name);
+					}
+				}
+
+				if (auto member = as(MemberNode, node)) {
+					auto target = as(IdentifierNode, member->target);
+
+					if (target && target->name == name) {
+						return member->name->name != "length";
+					}
+				}
+
+				for (auto &child: node->children()) {
+					if (escapes(child, name)) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			static bool declares(std::shared_ptr<ListNode> params, const std::string &name) {
+				if (!params) {
+					return false;
+				}
+
+				return std::any_of(params->list.begin(), params->list.end(), [&](auto &item) {
+					auto param = as(VarNode, item);
+
+					return param && param->name->name == name;
+				});
+			}
+
+			/**
+			 * Whether a nested function captures the list, whatever it does with it, since the
+			 * function may outlive the call.
+			 */
+			static bool mentions(std::shared_ptr<Node> node, const std::string &name) {
+				if (!node) {
+					return false;
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					return identifier->name == name;
+				}
+
+				for (auto &child: node->children()) {
+					if (mentions(child, name)) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+	};
+
+	/**
+	 * Decides where every function literal keeps the locals it captures, see
+	 * FunctionNode::Environment.  Captures are names resolved to a parameter or local of an
+	 * enclosing function, names declared outside every function are globals.
+	 *
+	 * A literal escapes when it is returned, stored, passed to a call or captured by a function
+	 * which escapes.  One which is only called, directly or through the local it is bound to,
+	 * or applied by `map`, `filter` or `reduce` on an array or a string, cannot outlive the
+	 * frame declaring it: its captures stay in that frame and calls through the local go
+	 * straight to the function.  A named function can be referenced anywhere in its scope, so
+	 * one capturing locals is taken to escape.
+	 */
+	class ClosureEscape {
+		public:
+			/**
+			 * Returns the number of functions which need no heap environment.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				frames.assign(1, Frame());
+				literals.clear();
+				uses.clear();
+
+				visit(node);
+
+				for (bool changed = true; changed; ) {
+					changed = false;
+
+					for (auto &[function, literal]: literals) {
+						if (!literal.escapes && escapes(literal)) {
+							literal.escapes = changed = true;
+						}
+					}
+				}
+
+				std::size_t contained = 0;
+
+				for (auto &[function, literal]: literals) {
+					if (function->captures.empty()) {
+						function->environment = FunctionNode::Environment::NONE;
+					} else {
+						function->environment = literal.escapes ? FunctionNode::Environment::HEAP : FunctionNode::Environment::STACK;
+					}
+
+					if (literal.var) {
+						literal.var->escapes = literal.escapes;
+					}
+
+					if (function->environment != FunctionNode::Environment::HEAP) {
+						contained++;
+					}
+				}
+
+				return contained;
+			}
+
+		private:
+			/**
+			 * The function being walked with its parameters and locals.  The first frame
+			 * holds the globals.
+			 */
+			struct Frame {
+				FunctionNode *function = nullptr;
+				std::map<std::string, VarNode *> locals;
+			};
+
+			/**
+			 * The local a literal is bound to, if any, and whether it escapes so far.
+			 */
+			struct Literal {
+				VarNode *var = nullptr;
+				bool escapes = false;
+			};
+
+			/**
+			 * A use of a local bound to a literal, with the functions between its declaration
+			 * and the use, which hold it in their environments.
+			 */
+			struct Use {
+				bool call;
+				std::vector<FunctionNode *> through;
+			};
+
+			std::vector<Frame> frames;
+			std::map<FunctionNode *, Literal> literals;
+			std::map<VarNode *, std::vector<Use>> uses;
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto function = as(FunctionNode, node)) {
+					literal(function, nullptr, true);
+
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					if (auto function = as(FunctionNode, var->value); function && frames.size() > 1) {
+						literal(function, var.get(), false);
+						uses[var.get()];
+					} else {
+						visit(var->value);
+					}
+
+					frames.back().locals[var->name->name] = var.get();
+
+					return;
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					reference(identifier->name, false);
+
+					return;
+				}
+
+				if (auto member = as(MemberNode, node)) {
+					visit(member->target);
+
+					return;
+				}
+
+				if (auto call = as(CallNode, node)) {
+					auto member  = as(MemberNode, call->target);
+					bool applies = member && (member->name->name == "map" || member->name->name == "filter" || member->name->name == "reduce") && sequence(member->target);
+
+					callee(call->target, true);
+
+					if (call->args) {
+						for (auto &arg: call->args->list) {
+							callee(arg, applies);
+						}
+					}
+
+					return;
+				}
+
+				if (auto loop = as(ForNode, node)) {
+					visit(loop->subject);
+					visit(loop->limit);
+
+					frames.back().locals[loop->variable->name] = nullptr;
+
+					visit(loop->body);
+
+					return;
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			/**
+			 * A node which is called, when called is set, or otherwise just a value.
+			 */
+			void callee(std::shared_ptr<Node> node, bool called) {
+				if (auto function = as(FunctionNode, node); function && called) {
+					literal(function, nullptr, false);
+				} else if (auto name = as(IdentifierNode, node); name && called) {
+					reference(name->name, true);
+				} else {
+					visit(node);
+				}
+			}
+
+			/**
+			 * Whether receiver is an array or a string, or a `map` or `filter` of one, whose
+			 * methods only call the function they are given.  Any other may keep it.
+			 */
+			bool sequence(std::shared_ptr<Node> receiver) {
+				if (auto call = as(CallNode, receiver)) {
+					auto member = as(MemberNode, call->target);
+
+					return member && (member->name->name == "map" || member->name->name == "filter") && sequence(member->target);
+				}
+
+				if (auto literal = as(LiteralNode, receiver)) {
+					return literal->kind == LiteralNode::Kind::STRING;
+				}
+
+				if (as(ArrayNode, receiver)) {
+					return true;
+				}
+
+				auto identifier = as(IdentifierNode, receiver);
+
+				for (std::size_t i = frames.size(); identifier && i-- > 0; ) {
+					auto found = frames[i].locals.find(identifier->name);
+
+					if (found != frames[i].locals.end()) {
+						auto type = found->second ? found->second->type : nullptr;
+
+						return type && type->fixedType && (type->isArray() || type->name == "string");
+					}
+				}
+
+				return false;
+			}
+
+			void literal(std::shared_ptr<FunctionNode> function, VarNode *var, bool escapes) {
+				function->captures.clear();
+
+				literals[function.get()] = {var, escapes || function->name};
+
+				frames.push_back({function.get(), {}});
+
+				visit(function->params);
+				visit(function->body);
+
+				frames.pop_back();
+			}
+
+			/**
+			 * Resolves name from the innermost frame out, adding it to the captures of every
+			 * function between its declaration and here.
+			 */
+			void reference(const std::string &name, bool call) {
+				for (std::size_t i = frames.size() - 1; i > 0; i--) {
+					auto found = frames[i].locals.find(name);
+
+					if (found == frames[i].locals.end()) {
+						continue;
+					}
+
+					Use use = {call, {}};
+
+					for (std::size_t j = i + 1; j < frames.size(); j++) {
+						auto &captures = frames[j].function->captures;
+
+						if (std::find(captures.begin(), captures.end(), name) == captures.end()) {
+							captures.push_back(name);
+						}
+
+						use.through.push_back(frames[j].function);
+					}
+
+					if (auto bound = uses.find(found->second); bound != uses.end()) {
+						bound->second.push_back(use);
+					}
+
+					return;
+				}
+			}
+
+			bool escapes(const Literal &literal) {
+				if (!literal.var) {
+					return false;
+				}
+
+				for (auto &use: uses[literal.var]) {
+					if (!use.call) {
+						return true;
+					}
+
+					for (auto function: use.through) {
+						auto found = literals.find(function);
+
+						if (found != literals.end() && found->second.escapes) {
+							return true;
+						}
+					}
+				}
+
+				return false;
+			}
+	};
+}
+
+#endif
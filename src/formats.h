@@ -0,0 +1,101 @@
+#ifndef __PINT_FORMATS_H
+#define __PINT_FORMATS_H
+
+#include <stdexcept>
+#include <string>
+
+#include "tree.h"
+#include "runtime/format.h"
+
+namespace pint {
+	/**
+	 * Parses the pattern of every `'<pattern>'.format(...)` on a literal when compiling, so
+	 * the call is emitted as a format::Builder writing each piece of text and each argument in
+	 * turn into a result reserved once, instead of parsing the pattern on every call.  Calls
+	 * whose arguments are all literals are already folded by Constants.
+	 *
+	 * A literal pattern with an unknown specifier, or taking more or fewer arguments than it
+	 * is given, does not compile.
+	 */
+	class Formats {
+		public:
+			/**
+			 * Returns the number of calls which were specialized.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				specialized = 0;
+
+				visit(node);
+
+				return specialized;
+			}
+
+		private:
+			std::size_t specialized = 0;
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto call = as(CallNode, node)) {
+					auto member  = as(MemberNode, call->target);
+					auto pattern = member ? as(LiteralNode, member->target) : nullptr;
+
+					if (pattern && pattern->kind == LiteralNode::Kind::STRING && member->name->name == "format") {
+						parse(*call, pattern->text);
+					}
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			void parse(CallNode &call, const std::string &pattern) {
+				std::size_t given = call.args ? call.args->list.size() : 0;
+				std::size_t units = 0;
+				std::string text;
+
+				call.pieces.clear();
+
+				for (std::size_t at = 0; at < pattern.size(); ) {
+					if (pattern[at] != '%') {
+						text += pattern[at++];
+						continue;
+					}
+
+					auto spec = read(pattern, ++at);
+
+					if (spec.kind == '%') {
+						text += '%';
+						continue;
+					}
+
+					call.pieces.push_back({text, spec.kind, spec.precision});
+					units += text.size();
+					text.clear();
+				}
+
+				if (call.pieces.size() != given) {
+					throw std::runtime_error("'" + pattern + "' takes " + std::to_string(call.pieces.size()) + " arguments, not " + std::to_string(given));
+				}
+
+				call.tail      = text;
+				call.units     = units + text.size();
+				call.formatted = true;
+
+				specialized++;
+			}
+
+			static format::Spec read(const std::string &pattern, std::size_t &at) {
+				try {
+					return format::spec(pattern, at);
+				} catch (const std::invalid_argument &error) {
+					throw std::runtime_error(error.what() + (" in '" + pattern + "'"));
+				}
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef __PINT_GENERICS_H
+#define __PINT_GENERICS_H
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Monomorphizes generic classes, interfaces and implementations: every distinct list of
+	 * concrete type arguments, `Repository<Person>`, gets an instance of its own, compiled
+	 * with the parameters replaced so its members need no dynamic type checks.  Uses inside
+	 * a generic, `List<T>` within `Tree<T>`, are instantiated for every instance of it.
+	 *
+	 * Identical argument lists share one instance.  Past `instances` per generic, the least
+	 * used ones, and any nested deeper than DEPTH, are boxed instead: they share one copy of
+	 * the code taking every parameter as a Dynamic, which bounds code size when instance
+	 * counts would explode, e.g. through polymorphic recursion.
+	 */
+	class Generics {
+		public:
+			static constexpr std::size_t INSTANCES = 16;
+			static constexpr std::size_t DEPTH = 8;
+
+			Generics(std::size_t instances = INSTANCES) {
+				this->instances = instances;
+			}
+
+			/**
+			 * Returns the number of instances which were specialized.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				generics.clear();
+
+				collect(node);
+				visit(node, {}, 0);
+
+				std::size_t specialized = 0;
+
+				for (auto &[name, generic]: generics) {
+					budget(*generic);
+
+					for (auto &instance: generic->instances) {
+						if (!instance.boxed) {
+							specialized++;
+						}
+					}
+				}
+
+				return specialized;
+			}
+
+		private:
+			using Bindings = std::map<std::string, std::shared_ptr<TypeNode>>;
+
+			std::size_t instances;
+			std::map<std::string, std::shared_ptr<ClassNode>> generics;
+
+			void collect(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto form = as(ClassNode, node); form && form->isGeneric()) {
+					form->instances.clear();
+					generics[form->name->name] = form;
+				}
+
+				for (auto &child: node->children()) {
+					collect(child);
+				}
+			}
+
+			/**
+			 * Instantiates what the types in node use.  Bindings are the arguments of the
+			 * instance whose body is walked, empty outside generics.
+			 */
+			void visit(std::shared_ptr<Node> node, const Bindings &bindings, std::size_t depth) {
+				if (!node) {
+					return;
+				}
+
+				if (auto form = as(ClassNode, node)) {
+					if (form->isGeneric() && bindings.empty()) {
+						return;
+					}
+
+					if (form->bases) {
+						for (auto &base: form->bases->list) {
+							use(as(TypeNode, base), bindings, depth);
+						}
+					}
+				}
+
+				if (auto var = as(VarNode, node)) {
+					use(var->type, bindings, depth);
+				}
+
+				if (auto function = as(FunctionNode, node)) {
+					use(function->type, bindings, depth);
+				}
+
+				for (auto &child: node->children()) {
+					visit(child, bindings, depth);
+				}
+			}
+
+			/**
+			 * Instantiates the generics type names, recording the instance on it when it is
+			 * outside any generic.
+			 */
+			void use(std::shared_ptr<TypeNode> type, const Bindings &bindings, std::size_t depth) {
+				if (!type) {
+					return;
+				}
+
+				use(type->element, bindings, depth);
+
+				if (!type->arguments) {
+					return;
+				}
+
+				std::vector<std::shared_ptr<TypeNode>> arguments;
+
+				for (auto &item: type->arguments->list) {
+					auto argument = as(TypeNode, item);
+
+					use(argument, bindings, depth);
+					arguments.push_back(substitute(argument, bindings));
+				}
+
+				auto found = generics.find(type->name);
+
+				if (found == generics.end()) {
+					return;
+				}
+
+				int instance = instantiate(*found->second, arguments, depth);
+
+				if (bindings.empty()) {
+					type->instance = instance;
+				}
+			}
+
+			int instantiate(ClassNode &generic, const std::vector<std::shared_ptr<TypeNode>> &arguments, std::size_t depth) {
+				auto &parameters = generic.parameters->list;
+
+				if (arguments.size() != parameters.size()) {
+					throw std::runtime_error("Generic " + generic.name->name + " takes " + std::to_string(parameters.size()) + " type arguments");
+				}
+
+				std::string key = generic.name->name + "<";
+
+				for (std::size_t i = 0; i < arguments.size(); i++) {
+					key += (i ? ", " : "") + name(arguments[i]);
+				}
+
+				key += ">";
+
+				for (std::size_t i = 0; i < generic.instances.size(); i++) {
+					if (generic.instances[i].key == key) {
+						generic.instances[i].uses++;
+
+						return int(i);
+					}
+				}
+
+				int index = int(generic.instances.size());
+
+				generic.instances.push_back({key, arguments, 1, depth >= DEPTH});
+
+				if (depth < DEPTH) {
+					Bindings bindings;
+
+					for (std::size_t i = 0; i < parameters.size(); i++) {
+						bindings[as(VarNode, parameters[i])->name->name] = arguments[i];
+					}
+
+					if (generic.bases) {
+						for (auto &base: generic.bases->list) {
+							use(as(TypeNode, base), bindings, depth + 1);
+						}
+					}
+
+					visit(generic.body, bindings, depth + 1);
+				}
+
+				return index;
+			}
+
+			/**
+			 * Keeps the most used instances specialized, boxing the rest.
+			 */
+			void budget(ClassNode &generic) {
+				std::vector<std::size_t> order(generic.instances.size());
+
+				std::iota(order.begin(), order.end(), 0);
+				std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) {
+					return generic.instances[a].uses > generic.instances[b].uses;
+				});
+
+				for (std::size_t rank = instances; rank < order.size(); rank++) {
+					generic.instances[order[rank]].boxed = true;
+				}
+			}
+
+			static std::shared_ptr<TypeNode> substitute(std::shared_ptr<TypeNode> type, const Bindings &bindings) {
+				if (!type || bindings.empty()) {
+					return type;
+				}
+
+				if (type->element) {
+					return std::make_shared<TypeNode>(substitute(type->element, bindings), type->span);
+				}
+
+				if (type->arguments) {
+					auto generic = std::make_shared<TypeNode>(type->name);
+
+					generic->arguments = std::make_shared<ListNode>();
+
+					for (auto &argument: type->arguments->list) {
+						generic->arguments->list.push_back(substitute(as(TypeNode, argument), bindings));
+					}
+
+					return generic;
+				}
+
+				auto found = bindings.find(type->name);
+
+				return found != bindings.end() ? found->second : type;
+			}
+
+			/**
+			 * The canonical spelling of a type argument, equal for equal types.
+			 */
+			static std::string name(std::shared_ptr<TypeNode> type) {
+				if (!type || (!type->fixedType && !type->element)) {
+					return "dynamic";
+				}
+
+				if (type->element) {
+					return name(type->element) + "[" + (type->span ? std::to_string(type->span) : "") + "]";
+				}
+
+				std::string result = type->name;
+
+				if (type->fixedSize) {
+					result += "(" + (type->size ? std::to_string(type->size) : "") + ")";
+				}
+
+				if (type->arguments) {
+					result += "<";
+
+					for (std::size_t i = 0; i < type->arguments->list.size(); i++) {
+						result += (i ? ", " : "") + name(as(TypeNode, type->arguments->list[i]));
+					}
+
+					result += ">";
+				}
+
+				return result;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,441 @@
+#ifndef __PINT_INFERENCE_H
+#define __PINT_INFERENCE_H
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Works out the type, and the size where it is implicit too, of every variable declared
+	 * with an implicit fixed type, `var b:;` or `var c: ();`, so it can be emitted unboxed.
+	 *
+	 * The type is the one of the first value it is given, from its initializer or, walking the
+	 * statements in order, from an assignment, or else from a use giving it to a variable of
+	 * static type.  Every later assignment must agree.  An implicit fixed size is the widest
+	 * size given on initialization, and a later assignment of a wider value does not compile.
+	 * An implicit dynamic size keeps fixedSize unset but starts at the widest size any
+	 * assignment gives it.  Since a loop may assign a variable from one assigned later in its
+	 * body, the walk is repeated until nothing changes.
+	 *
+	 * A variable given values of different types, or of a type only known at runtime, stays
+	 * dynamic along with the ones declared so, `var a;`, see getDynamic.
+	 *
+	 * String literals are strings, `','` as much as `', '`, except that a single character
+	 * which fits is a char when assigned to a variable already holding chars.
+	 */
+	class Inference {
+		public:
+			/**
+			 * Returns the number of variables which stayed dynamic.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				variables.clear();
+				declared.clear();
+				dynamic.clear();
+				final = false;
+
+				do {
+					changed = false;
+					scope.clear();
+					visit(node);
+				} while (changed);
+
+				final = true;
+				scope.clear();
+				visit(node);
+
+				for (auto &[var, variable]: variables) {
+					if (!variable.conflict && variable.type) {
+						apply(*var->type, *variable.type);
+					}
+				}
+
+				for (auto var: declared) {
+					if (!isStatic(var->type)) {
+						dynamic.push_back(var);
+					}
+				}
+
+				return dynamic.size();
+			}
+
+			/**
+			 * The variables left dynamic by the last run, in declaration order.
+			 */
+			const std::vector<VarNode *> &getDynamic() const {
+				return dynamic;
+			}
+
+		private:
+			/**
+			 * A size of 0 is the default size of the type.
+			 */
+			struct Type {
+				std::string name;
+				std::size_t size = 0;
+			};
+
+			/**
+			 * Initializer is the declaration, assignment or use which gave the first value.
+			 */
+			struct Variable {
+				std::optional<Type> type;
+				const Node *initializer = nullptr;
+				bool conflict = false;
+			};
+
+			std::map<VarNode *, Variable> variables;
+			std::map<std::string, VarNode *> scope;
+			std::vector<VarNode *> declared;
+			std::vector<VarNode *> dynamic;
+			bool changed = false;
+			bool final = false;
+
+			static std::size_t defaultSize(const std::string &name) {
+				if (name == "integer" || name == "cardinal" || name == "real") {
+					return 32;
+				}
+
+				if (name == "char" || name == "string") {
+					return 8;
+				}
+
+				return name == "boolean" ? 1 : 0;
+			}
+
+			static std::size_t width(const Type &type) {
+				return type.size ? type.size : defaultSize(type.name);
+			}
+
+			static bool isImplicit(std::shared_ptr<TypeNode> type) {
+				return type && type->fixedType && type->name.empty() && !type->element;
+			}
+
+			static bool isStatic(std::shared_ptr<TypeNode> type) {
+				if (!type || !type->fixedType) {
+					return false;
+				}
+
+				return type->element ? isStatic(type->element) : !type->name.empty();
+			}
+
+			static void apply(TypeNode &type, const Type &inferred) {
+				type.name = inferred.name;
+
+				if (!type.fixedSize) {
+					type.size = width(inferred);
+				} else if (!type.size) {
+					type.setSize(width(inferred));
+				}
+			}
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node || as(RecordNode, node)) {
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					declare(var);
+
+					return;
+				}
+
+				if (auto function = as(FunctionNode, node)) {
+					auto outer = scope;
+
+					if (function->params) {
+						for (auto &param: function->params->list) {
+							declare(as(VarNode, param));
+						}
+					}
+
+					visit(function->body);
+
+					scope = outer;
+
+					return;
+				}
+
+				if (as(ClassNode, node)) {
+					auto outer = scope;
+
+					for (auto &child: node->children()) {
+						visit(child);
+					}
+
+					scope = outer;
+
+					return;
+				}
+
+				if (auto assign = as(AssignNode, node)) {
+					visit(assign->value);
+
+					for (auto &target: assign->targets->list) {
+						auto identifier = as(IdentifierNode, target);
+
+						if (!identifier) {
+							visit(target);
+							continue;
+						}
+
+						auto found = scope.find(identifier->name);
+
+						if (found == scope.end()) {
+							continue;
+						}
+
+						auto value = assign->op == "=" ? typeOf(assign->value, found->second) : combine(assign->op.substr(0, assign->op.size() - 1), typeOf(target), typeOf(assign->value));
+
+						define(found->second, value, assign.get());
+						constrain(assign->value, found->second->type);
+					}
+
+					return;
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			void declare(std::shared_ptr<VarNode> var) {
+				if (!var) {
+					return;
+				}
+
+				visit(var->value);
+
+				if (final) {
+					declared.push_back(var.get());
+				}
+
+				if (isImplicit(var->type)) {
+					variables[var.get()];
+
+					if (var->value) {
+						define(var.get(), typeOf(var->value), var.get());
+					}
+				}
+
+				constrain(var->value, var->type);
+
+				scope[var->name->name] = var.get();
+			}
+
+			/**
+			 * Gives the variable a value of the type, or of one unknown as yet when there is
+			 * none, at site.
+			 */
+			void define(VarNode *var, std::optional<Type> type, const Node *site) {
+				auto found = variables.find(var);
+
+				if (found == variables.end() || found->second.conflict) {
+					return;
+				}
+
+				auto &variable = found->second;
+
+				if (!type) {
+					variable.conflict = final;
+
+					return;
+				}
+
+				if (!variable.type) {
+					variable.type        = type;
+					variable.initializer = site;
+					changed              = true;
+				} else if (variable.type->name != type->name) {
+					variable.conflict = true;
+					changed           = true;
+				} else if (width(*type) <= width(*variable.type)) {
+					return;
+				} else if (site == variable.initializer || !var->type->fixedSize) {
+					variable.type->size = width(*type);
+					changed             = true;
+				} else if (final) {
+					throw std::runtime_error(var->name->name + " is given a value of " + std::to_string(width(*type)) + " bits, wider than the " + std::to_string(width(*variable.type)) + " it is initialized with");
+				}
+			}
+
+			/**
+			 * A value given to a variable of static type gives that type to an implicit one
+			 * which has no value yet.
+			 */
+			void constrain(std::shared_ptr<Node> value, std::shared_ptr<TypeNode> type) {
+				auto identifier = as(IdentifierNode, value);
+
+				if (!identifier || !isStatic(type) || type->element) {
+					return;
+				}
+
+				auto found = scope.find(identifier->name);
+
+				if (found == scope.end()) {
+					return;
+				}
+
+				auto variable = variables.find(found->second);
+
+				if (variable != variables.end() && !variable->second.type) {
+					define(found->second, Type{type->name, type->fixedSize ? type->size : 0}, value.get());
+				}
+			}
+
+			std::optional<Type> typeOf(std::shared_ptr<Node> node) {
+				if (auto literal = as(LiteralNode, node)) {
+					return typeOf(*literal);
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					auto found = scope.find(identifier->name);
+
+					if (found == scope.end()) {
+						return std::nullopt;
+					}
+
+					return typeOf(found->second);
+				}
+
+				if (auto binary = as(BinaryNode, node)) {
+					return combine(binary->op, typeOf(binary->left), typeOf(binary->right));
+				}
+
+				if (auto cast = as(CastNode, node)) {
+					if (isStatic(cast->type) && !cast->type->element) {
+						return Type{cast->type->name, cast->type->fixedSize ? cast->type->size : 0};
+					}
+
+					auto value = typeOf(cast->value);
+
+					if (value && cast->type && cast->type->fixedSize && cast->type->size) {
+						value->size = cast->type->size;
+					}
+
+					return value;
+				}
+
+				if (auto call = as(CallNode, node)) {
+					auto identifier = as(IdentifierNode, call->target);
+					auto found      = identifier ? scope.find(identifier->name) : scope.end();
+
+					if (found == scope.end()) {
+						return std::nullopt;
+					}
+
+					auto function = as(FunctionNode, found->second->value);
+
+					if (function && isStatic(function->type) && !function->type->element) {
+						return Type{function->type->name, function->type->fixedSize ? function->type->size : 0};
+					}
+
+					return std::nullopt;
+				}
+
+				if (as(FunctionNode, node)) {
+					return Type{"function"};
+				}
+
+				return std::nullopt;
+			}
+
+			static Type typeOf(const LiteralNode &literal) {
+				switch (literal.kind) {
+					case LiteralNode::Kind::INTEGER: {
+						auto digits = literal.text.size();
+
+						return {"integer", digits > 10 || (digits == 10 && literal.text > "2147483647") ? 64u : 32u};
+					}
+
+					case LiteralNode::Kind::REAL:
+						return {"real"};
+
+					case LiteralNode::Kind::STRING:
+						return {"string"};
+
+					default:
+						return {"boolean"};
+				}
+			}
+
+			/**
+			 * The type of a value given to target, a char for a string literal of a single
+			 * character it can hold when target already holds chars.
+			 */
+			std::optional<Type> typeOf(std::shared_ptr<Node> value, VarNode *target) {
+				auto literal = as(LiteralNode, value);
+				auto found   = variables.find(target);
+
+				if (!literal || literal->kind != LiteralNode::Kind::STRING || found == variables.end() || !found->second.type) {
+					return typeOf(value);
+				}
+
+				auto &type   = *found->second.type;
+				auto &text   = literal->text;
+				auto points  = std::count_if(text.begin(), text.end(), [](char c) { return (c & 0xC0) != 0x80; });
+				auto longest = width(type) == 8 ? 1u : width(type) == 16 ? 3u : 4u;
+
+				if (type.name == "char" && points == 1 && text.size() <= longest) {
+					return type;
+				}
+
+				return typeOf(value);
+			}
+
+			std::optional<Type> typeOf(VarNode *var) {
+				if (auto found = variables.find(var); found != variables.end()) {
+					return found->second.conflict ? std::nullopt : found->second.type;
+				}
+
+				if (!isStatic(var->type) || var->type->element) {
+					return std::nullopt;
+				}
+
+				return Type{var->type->name, var->type->fixedSize ? var->type->size : 0};
+			}
+
+			static std::optional<Type> combine(const std::string &op, std::optional<Type> left, std::optional<Type> right) {
+				static const std::vector<std::string> comparisons = {"=", "<>", "<", ">", "<=", ">="};
+
+				if (std::find(comparisons.begin(), comparisons.end(), op) != comparisons.end()) {
+					return Type{"boolean"};
+				}
+
+				if (!left || !right) {
+					return std::nullopt;
+				}
+
+				auto size = std::max(width(*left), width(*right));
+				auto text = [](const Type &type) {
+					return type.name == "char" || type.name == "string";
+				};
+
+				if (op == "+" && text(*left) && text(*right)) {
+					return Type{"string", size};
+				}
+
+				if (op != "+" && op != "-" && op != "*" && op != "/" && op != "%") {
+					return std::nullopt;
+				}
+
+				if (left->name == "integer" && right->name == "integer") {
+					return Type{"integer", size};
+				}
+
+				if ((left->name == "real" || left->name == "integer") && (right->name == "real" || right->name == "integer")) {
+					return Type{"real", size};
+				}
+
+				return std::nullopt;
+			}
+	};
+}
+
+#endif
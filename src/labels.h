@@ -0,0 +1,257 @@
+#ifndef __PINT_LABELS_H
+#define __PINT_LABELS_H
+
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Encodes labels as small integers.  A label and every label extending it, in any unit of
+	 * the program, form a family whose values are numbered densely from 0: the root's values
+	 * first, then each extension's own values, extensions taken by name so the codes do not
+	 * depend on the order units are seen in.  A family of span n is stored in the narrowest
+	 * unsigned integer holding n codes and reflected through one static name table.
+	 *
+	 * Labels are named within their unit, `Logger.Level` naming the one of another unit, and
+	 * families by the unit-qualified name of their root.  Labels extending a label that is not
+	 * declared in the tree are left without codes.
+	 *
+	 * A unit compiled separately may extend any label, taking codes and widening the span, so
+	 * codes only stay the same across compilations when the tree is the closed set of every
+	 * unit of the program.  Otherwise no label gets codes and values are compared by name.
+	 */
+	class Labels {
+		public:
+			/**
+			 * Closed is set when the tree holds every unit of the program.
+			 */
+			Labels(bool closed = false) {
+				this->closed = closed;
+			}
+
+			/**
+			 * Returns the number of label families numbered.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				labels.clear();
+				units.clear();
+				extensions.clear();
+				unit.clear();
+
+				collect(node);
+
+				std::vector<std::shared_ptr<LabelNode>> roots;
+
+				for (auto &[name, label]: labels) {
+					auto base = this->base(*label);
+
+					if (base.empty()) {
+						roots.push_back(label);
+					} else if (labels.count(base)) {
+						extensions[base].push_back(label);
+					}
+				}
+
+				for (auto &root: roots) {
+					if (closed) {
+						encode(root);
+					}
+				}
+
+				for (auto &[name, label]: labels) {
+					std::set<std::string> seen = {name};
+
+					for (auto base = this->base(*label); label->family.empty() && labels.count(base); base = this->base(*labels[base])) {
+						if (!seen.insert(base).second) {
+							throw std::runtime_error("Label " + name + " extends itself");
+						}
+					}
+				}
+
+				if (!closed) {
+					return 0;
+				}
+
+				unit.clear();
+				resolve(node);
+
+				return roots.size();
+			}
+
+			/**
+			 * Bytes needed to store a value of a family with the given number of codes.
+			 */
+			static std::size_t bytes(std::size_t span) {
+				return span <= 0x100 ? 1 : span <= 0x10000 ? 2 : 4;
+			}
+
+			/**
+			 * `Logger.Level` for the label part of `Logger.Level#INFO`.
+			 */
+			static std::string name(std::shared_ptr<Node> node) {
+				if (auto identifier = as(IdentifierNode, node)) {
+					return identifier->name;
+				}
+
+				if (auto member = as(MemberNode, node)) {
+					auto target = name(member->target);
+
+					return target.empty() ? "" : target + "." + member->name->name;
+				}
+
+				return "";
+			}
+
+		private:
+			/**
+			 * Labels by unit-qualified name, the unit each is declared in, and the labels
+			 * extending each.
+			 */
+			std::map<std::string, std::shared_ptr<LabelNode>> labels;
+			std::map<const LabelNode *, std::string> units;
+			std::map<std::string, std::vector<std::shared_ptr<LabelNode>>> extensions;
+			std::string unit;
+			bool closed;
+
+			void collect(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto list = as(ListNode, node)) {
+					auto outer = unit;
+
+					for (auto &item: list->list) {
+						if (auto declaration = as(UnitNode, item)) {
+							unit = declaration->name();
+						} else {
+							collect(item);
+						}
+					}
+
+					unit = outer;
+
+					return;
+				}
+
+				if (auto label = as(LabelNode, node)) {
+					labels[unit + "." + label->name->name] = label;
+					units[label.get()] = unit;
+				}
+
+				for (auto &child: node->children()) {
+					collect(child);
+				}
+			}
+
+			static std::string qualify(const std::string &name, const std::string &unit) {
+				return name.find('.') == std::string::npos ? unit + "." + name : name;
+			}
+
+			std::string key(const LabelNode &label) {
+				return units[&label] + "." + label.name->name;
+			}
+
+			std::string base(const LabelNode &label) {
+				if (!label.extends || label.extends->list.empty()) {
+					return "";
+				}
+
+				if (label.extends->list.size() > 1) {
+					throw std::runtime_error("Label " + label.name->name + " extends more than one label");
+				}
+
+				auto base = name(label.extends->list.front());
+
+				return base.empty() ? "" : qualify(base, units[&label]);
+			}
+
+			void encode(std::shared_ptr<LabelNode> root) {
+				std::vector<std::shared_ptr<LabelNode>> family;
+				auto names = std::make_shared<std::vector<std::string>>();
+
+				number(root, nullptr, *names, family);
+
+				for (auto &label: family) {
+					label->family = key(*root);
+					label->span   = names->size();
+					label->names  = names;
+				}
+			}
+
+			void number(std::shared_ptr<LabelNode> label, std::shared_ptr<LabelNode> base, std::vector<std::string> &names, std::vector<std::shared_ptr<LabelNode>> &family) {
+				label->codes.clear();
+
+				if (base) {
+					label->codes = base->codes;
+				}
+
+				if (label->values) {
+					for (auto &item: label->values->list) {
+						auto value = as(IdentifierNode, item);
+
+						if (!label->codes.emplace(value->name, names.size()).second) {
+							throw std::runtime_error("Label " + label->name->name + " declares " + value->name + " twice");
+						}
+
+						names.push_back(value->name);
+					}
+				}
+
+				family.push_back(label);
+
+				for (auto &extension: extensions[key(*label)]) {
+					number(extension, label, names, family);
+				}
+			}
+
+			void resolve(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto list = as(ListNode, node)) {
+					auto outer = unit;
+
+					for (auto &item: list->list) {
+						if (auto declaration = as(UnitNode, item)) {
+							unit = declaration->name();
+						} else {
+							resolve(item);
+						}
+					}
+
+					unit = outer;
+
+					return;
+				}
+
+				if (auto value = as(LabelValueNode, node)) {
+					auto found = labels.find(qualify(name(value->label), unit));
+
+					if (found != labels.end() && !found->second->family.empty()) {
+						auto &label = *found->second;
+						auto code   = label.codes.find(value->value->name);
+
+						if (code == label.codes.end()) {
+							throw std::runtime_error("Label " + label.name->name + " has no value " + value->value->name);
+						}
+
+						value->family = label.family;
+						value->code   = int(code->second);
+					}
+				}
+
+				for (auto &child: node->children()) {
+					resolve(child);
+				}
+			}
+	};
+}
+
+#endif
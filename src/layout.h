@@ -0,0 +1,110 @@
+#ifndef __PINT_LAYOUT_H
+#define __PINT_LAYOUT_H
+
+#include <algorithm>
+#include <cstddef>
+
+#include "tree.h"
+#include "runtime/bitset.h"
+#include "runtime/dynamic.h"
+#include "runtime/numeric.h"
+
+namespace pint {
+	enum class Storage {
+		INLINE,
+		HEAP
+	};
+
+	/**
+	 * Decides how declared values are laid out in a frame or in a containing record.
+	 */
+	class Layout {
+		public:
+			/**
+			 * Bytes needed to store a value of the type inline, or 0 when that is not known until
+			 * run-time (dynamic types, sizes or spans).  A `char(N)` takes one UTF-N code unit.
+			 */
+			static std::size_t bytes(const TypeNode &type) {
+				if (type.isArray()) {
+					if (type.span == DYNAMIC_SIZE) {
+						return 0;
+					}
+
+					if (isBit(*type.element)) {
+						return bits::words(type.span) * sizeof(bits::Word);
+					}
+
+					return type.span * bytes(*type.element);
+				}
+
+				auto base = toBase(type.name);
+
+				if (!type.fixedSize || type.size == DYNAMIC_SIZE || !base) {
+					return 0;
+				}
+
+				switch (*base) {
+					case Base::INTEGER:
+					case Base::CARDINAL:
+						return nativeWidth(type.size) / 8;
+					case Base::REAL:
+						return type.size <= 32 ? 4 : 8;
+					case Base::CHAR:
+						return type.size <= 8 ? 1 : type.size <= 16 ? 2 : 4;
+					case Base::BOOLEAN:
+						return type.size == 1 ? 1 : bits::words(type.size) * sizeof(bits::Word);
+					default:
+						return 0;
+				}
+			}
+
+			/**
+			 * Fixed-span arrays of fixed-size elements are inline, only the remaining arrays get
+			 * heap storage.  Scalars always live in the frame, see Dynamic and BigInteger.
+			 */
+			static Storage storage(const TypeNode &type) {
+				if (type.isArray() && bytes(type) == 0) {
+					return Storage::HEAP;
+				}
+
+				return Storage::INLINE;
+			}
+
+			/**
+			 * Alignment of a value of the type stored inline.
+			 */
+			static std::size_t align(const TypeNode &type) {
+				if (type.isArray()) {
+					return isBit(*type.element) ? alignof(bits::Word) : align(*type.element);
+				}
+
+				std::size_t size = bytes(type);
+
+				return size == 0 ? alignof(Dynamic) : std::min(size, alignof(uint64_t));
+			}
+
+			/**
+			 * Bytes taken by a record field of the type, which is either stored inline or, when
+			 * its size is not fixed or it is another record, as a Dynamic word.
+			 */
+			static std::size_t field(const TypeNode *type) {
+				std::size_t size = type ? bytes(*type) : 0;
+
+				return size == 0 ? sizeof(Dynamic) : size;
+			}
+
+			static std::size_t fieldAlign(const TypeNode *type) {
+				return type && bytes(*type) != 0 ? align(*type) : alignof(Dynamic);
+			}
+
+		private:
+			/**
+			 * `boolean(1)` elements are packed, see Bits.
+			 */
+			static bool isBit(const TypeNode &type) {
+				return type.name == "boolean" && type.fixedSize && type.size == 1;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef __PINT_LOOPS_H
+#define __PINT_LOOPS_H
+
+#include <map>
+#include <string>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Finds what each `for ... in` and `for ... of` iterates over, so it can be emitted as a loop
+	 * over the underlying storage instead of through an iterator object:
+	 *
+	 * - arrays, including literals, as an index loop over their elements
+	 * - strings through String::each, which decodes UTF-8 as it goes
+	 * - objects through Object::each, over the shape's keys and the slots
+	 *
+	 * Subjects of unknown type keep the generic iteration.
+	 */
+	class Loops {
+		public:
+			/**
+			 * Returns the number of loops lowered.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				lowered = 0;
+
+				visit(node);
+
+				return lowered;
+			}
+
+		private:
+			std::map<std::string, std::shared_ptr<TypeNode>> types;
+			std::size_t lowered = 0;
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					visit(var->value);
+
+					types[var->name->name] = var->type;
+
+					return;
+				}
+
+				if (auto loop = as(ForNode, node)) {
+					visit(loop->subject);
+					visit(loop->limit);
+
+					if (loop->kind != ForNode::Kind::TO) {
+						loop->over = over(loop->subject);
+
+						if (loop->over != ForNode::Over::UNKNOWN) {
+							lowered++;
+						}
+					}
+
+					auto outer = types;
+
+					types.erase(loop->variable->name);
+					visit(loop->body);
+					types = outer;
+
+					return;
+				}
+
+				if (as(FunctionNode, node)) {
+					auto outer = types;
+
+					for (auto &child: node->children()) {
+						visit(child);
+					}
+
+					types = outer;
+
+					return;
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			ForNode::Over over(std::shared_ptr<Node> subject) {
+				if (as(ArrayNode, subject)) {
+					return ForNode::Over::ARRAY;
+				}
+
+				if (auto literal = as(LiteralNode, subject); literal && literal->kind == LiteralNode::Kind::STRING) {
+					return ForNode::Over::STRING;
+				}
+
+				auto identifier = as(IdentifierNode, subject);
+				auto found      = identifier ? types.find(identifier->name) : types.end();
+
+				if (found == types.end() || !found->second || !found->second->fixedType) {
+					return ForNode::Over::UNKNOWN;
+				}
+
+				auto &type = *found->second;
+
+				if (type.isArray()) {
+					return ForNode::Over::ARRAY;
+				}
+
+				if (type.name == "string") {
+					return ForNode::Over::STRING;
+				}
+
+				if (type.name == "object") {
+					return ForNode::Over::OBJECT;
+				}
+
+				return ForNode::Over::UNKNOWN;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,305 @@
+#ifndef __PINT_MAPPING_H
+#define __PINT_MAPPING_H
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Resolves element-wise application, `msg[encode]` and `xs.map(f)`, to the function applied,
+	 * and decides whether that function is pure and small enough to be inlined into the loop
+	 * over the elements (see CharMap and map) instead of being called for every element.
+	 *
+	 * A function is pure when its body only declares locals, assigns them, branches, returns
+	 * and calls pure functions, with at most BRANCHES conditions and NODES nodes.
+	 */
+	class Mapping {
+		public:
+			static constexpr std::size_t BRANCHES = 4;
+			static constexpr std::size_t NODES = 64;
+
+			/**
+			 * Returns the number of applications of a pure function.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				functions.clear();
+				verdicts.clear();
+				types.clear();
+				inlined = 0;
+
+				collect(node);
+				visit(node);
+
+				return inlined;
+			}
+
+		private:
+			enum class Verdict {
+				PENDING,
+				PURE,
+				IMPURE
+			};
+
+			/**
+			 * What the body of a function being checked has declared so far.
+			 */
+			struct Scope {
+				std::set<std::string> locals;
+				std::set<std::string> functions;
+				std::size_t branches = 0;
+				std::size_t nodes = 0;
+			};
+
+			std::multimap<std::string, std::shared_ptr<FunctionNode>> functions;
+			std::map<FunctionNode *, Verdict> verdicts;
+			std::map<std::string, std::shared_ptr<TypeNode>> types;
+			std::size_t inlined = 0;
+
+			void collect(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto function = as(FunctionNode, node); function && function->name) {
+					functions.emplace(function->name->name, function);
+				}
+
+				for (auto &child: node->children()) {
+					collect(child);
+				}
+			}
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					visit(var->value);
+
+					types[var->name->name] = var->type;
+
+					return;
+				}
+
+				if (as(FunctionNode, node) || as(ForNode, node)) {
+					auto outer = types;
+
+					if (auto loop = as(ForNode, node)) {
+						types.erase(loop->variable->name);
+					}
+
+					for (auto &child: node->children()) {
+						visit(child);
+					}
+
+					types = outer;
+
+					return;
+				}
+
+				if (auto index = as(IndexNode, node)) {
+					index->mapper = resolve(index->index, index->target);
+					count(index->mapper);
+				}
+
+				if (auto call = as(CallNode, node)) {
+					auto member = as(MemberNode, call->target);
+
+					if (member && member->name->name == "map" && call->args && call->args->list.size() == 1) {
+						call->mapper = resolve(call->args->list.front(), member->target);
+						count(call->mapper);
+					}
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+
+			void count(std::shared_ptr<FunctionNode> mapper) {
+				if (mapper && (mapper->pure = pure(mapper))) {
+					inlined++;
+				}
+			}
+
+			/**
+			 * The function of one parameter value names, preferring the overload taking the
+			 * element type of subject when there are several.
+			 */
+			std::shared_ptr<FunctionNode> resolve(std::shared_ptr<Node> value, std::shared_ptr<Node> subject) {
+				if (auto function = as(FunctionNode, value)) {
+					return function->params && function->params->list.size() == 1 ? function : nullptr;
+				}
+
+				auto name = as(IdentifierNode, value);
+
+				if (!name || types.count(name->name)) {
+					return nullptr;
+				}
+
+				std::string element = this->element(subject);
+				std::shared_ptr<FunctionNode> only;
+				std::size_t candidates = 0;
+
+				for (auto [it, end] = functions.equal_range(name->name); it != end; it++) {
+					auto &function = it->second;
+
+					if (!function->params || function->params->list.size() != 1) {
+						continue;
+					}
+
+					auto param = as(VarNode, function->params->list.front());
+
+					if (param->type && param->type->name == element && !element.empty()) {
+						return function;
+					}
+
+					only = function;
+					candidates++;
+				}
+
+				return candidates == 1 ? only : nullptr;
+			}
+
+			std::string element(std::shared_ptr<Node> subject) {
+				auto identifier = as(IdentifierNode, subject);
+				auto found      = identifier ? types.find(identifier->name) : types.end();
+
+				if (found == types.end() || !found->second) {
+					return "";
+				}
+
+				auto &type = *found->second;
+
+				if (type.isArray()) {
+					return type.element->name;
+				}
+
+				return type.name == "string" ? "char" : "";
+			}
+
+			bool pure(std::shared_ptr<FunctionNode> function) {
+				auto &verdict = verdicts[function.get()];
+
+				if (verdict == Verdict::PENDING) {
+					Scope scope;
+
+					verdict = Verdict::IMPURE;
+
+					if (function->params) {
+						for (auto &param: function->params->list) {
+							scope.locals.insert(as(VarNode, param)->name->name);
+						}
+					}
+
+					if (check(function->body, scope)) {
+						verdict = Verdict::PURE;
+					}
+				}
+
+				return verdict == Verdict::PURE;
+			}
+
+			bool check(std::shared_ptr<Node> node, Scope &scope) {
+				if (!node) {
+					return true;
+				}
+
+				if (++scope.nodes > NODES) {
+					return false;
+				}
+
+				if (auto identifier = as(IdentifierNode, node)) {
+					return scope.locals.count(identifier->name) > 0;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					scope.locals.insert(var->name->name);
+
+					if (auto function = as(FunctionNode, var->value)) {
+						if (!var->constant || !pure(function)) {
+							return false;
+						}
+
+						scope.functions.insert(var->name->name);
+
+						return true;
+					}
+
+					return check(var->value, scope);
+				}
+
+				if (auto assign = as(AssignNode, node)) {
+					for (auto &target: assign->targets->list) {
+						auto name = as(IdentifierNode, target);
+
+						if (!name || !scope.locals.count(name->name) || scope.functions.count(name->name)) {
+							return false;
+						}
+					}
+
+					return check(assign->value, scope);
+				}
+
+				if (auto call = as(CallNode, node)) {
+					auto name = as(IdentifierNode, call->target);
+
+					if (!name || !callable(name->name, scope)) {
+						return false;
+					}
+
+					return check(call->args, scope);
+				}
+
+				if (as(IfNode, node) && ++scope.branches > BRANCHES) {
+					return false;
+				}
+
+				if (!(as(ListNode, node) || as(LiteralNode, node) || as(BinaryNode, node) || as(IfNode, node) || as(ReturnNode, node))) {
+					return false;
+				}
+
+				for (auto &child: node->children()) {
+					if (!check(child, scope)) {
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			/**
+			 * A local `set` function, already checked when declared, or registered functions
+			 * which are all pure.
+			 */
+			bool callable(const std::string &name, const Scope &scope) {
+				if (scope.functions.count(name)) {
+					return true;
+				}
+
+				if (scope.locals.count(name)) {
+					return false;
+				}
+
+				auto [it, end] = functions.equal_range(name);
+
+				if (it == end) {
+					return false;
+				}
+
+				for (; it != end; it++) {
+					if (!pure(it->second)) {
+						return false;
+					}
+				}
+
+				return true;
+			}
+	};
+}
+
+#endif
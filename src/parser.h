@@ -82,27 +82,20 @@ class Tokenizer;
 enum class TokenType {
   __EMPTY = -1,
   // clang-format off
-  SEMICOLON = 53,
-  IDENTIFIER = 54,
-  SEPARATOR = 55,
-  TYPE_BASE = 56,
-  REAL = 57,
-  INTEGER = 58,
-  STRING = 59,
-  BOOLEAN = 60,
-  ADD = 61,
-  SUB = 62,
-  MUL = 63,
-  DIV = 64,
-  TOKEN_TYPE_65 = 65,
-  TOKEN_TYPE_66 = 66,
-  TOKEN_TYPE_67 = 67,
-  TOKEN_TYPE_68 = 68,
-  TOKEN_TYPE_69 = 69,
-  TOKEN_TYPE_70 = 70,
-  TOKEN_TYPE_71 = 71,
-  TOKEN_TYPE_72 = 72,
-  TOKEN_TYPE_73 = 73,
+  SEMICOLON = 60,
+  IDENTIFIER = 61,
+  SEPARATOR = 62,
+  DOT = 63,
+  ELLIPSIS = 64,
+  TYPE_BASE = 65,
+  REAL = 66,
+  INTEGER = 67,
+  STRING = 68,
+  BOOLEAN = 69,
+  ADD = 70,
+  SUB = 71,
+  MUL = 72,
+  DIV = 73,
   TOKEN_TYPE_74 = 74,
   TOKEN_TYPE_75 = 75,
   TOKEN_TYPE_76 = 76,
@@ -122,7 +115,19 @@ enum class TokenType {
   TOKEN_TYPE_90 = 90,
   TOKEN_TYPE_91 = 91,
   TOKEN_TYPE_92 = 92,
-  __EOF = 93
+  TOKEN_TYPE_93 = 93,
+  TOKEN_TYPE_94 = 94,
+  TOKEN_TYPE_95 = 95,
+  TOKEN_TYPE_96 = 96,
+  TOKEN_TYPE_97 = 97,
+  TOKEN_TYPE_98 = 98,
+  TOKEN_TYPE_99 = 99,
+  TOKEN_TYPE_100 = 100,
+  TOKEN_TYPE_101 = 101,
+  TOKEN_TYPE_102 = 102,
+  TOKEN_TYPE_103 = 103,
+  TOKEN_TYPE_104 = 104,
+  __EOF = 105
   // clang-format on
 };
 
@@ -355,7 +360,7 @@ class Tokenizer {
    * Lexical rules.
    */
   // clang-format off
-  static constexpr size_t LEX_RULES_COUNT = 43;
+  static constexpr size_t LEX_RULES_COUNT = 48;
   static std::array<LexRule, LEX_RULES_COUNT> lexRules_;
   static std::map<TokenizerState, std::vector<size_t>> lexRulesByStartConditions_;
   // clang-format on
@@ -405,176 +410,196 @@ std::string Tokenizer::__EOF("$");
 
 // clang-format off
 inline TokenType _lexRule1(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_65;
+return TokenType::TOKEN_TYPE_74;
 }
 
 inline TokenType _lexRule2(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_66;
+return TokenType::TOKEN_TYPE_75;
 }
 
 inline TokenType _lexRule3(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_67;
+return TokenType::TOKEN_TYPE_76;
 }
 
 inline TokenType _lexRule4(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_68;
+return TokenType::TOKEN_TYPE_77;
 }
 
 inline TokenType _lexRule5(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_69;
+return TokenType::TOKEN_TYPE_78;
 }
 
 inline TokenType _lexRule6(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_70;
+return TokenType::TOKEN_TYPE_79;
 }
 
 inline TokenType _lexRule7(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_71;
+return TokenType::TOKEN_TYPE_80;
 }
 
 inline TokenType _lexRule8(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_72;
+return TokenType::TOKEN_TYPE_81;
 }
 
 inline TokenType _lexRule9(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_73;
+return TokenType::TOKEN_TYPE_82;
 }
 
 inline TokenType _lexRule10(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_74;
+return TokenType::TOKEN_TYPE_83;
 }
 
 inline TokenType _lexRule11(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_75;
+return TokenType::TOKEN_TYPE_84;
 }
 
 inline TokenType _lexRule12(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_76;
+return TokenType::TOKEN_TYPE_85;
 }
 
 inline TokenType _lexRule13(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_77;
+return TokenType::TOKEN_TYPE_86;
 }
 
 inline TokenType _lexRule14(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_78;
+return TokenType::TOKEN_TYPE_87;
 }
 
 inline TokenType _lexRule15(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_79;
+return TokenType::TOKEN_TYPE_88;
 }
 
 inline TokenType _lexRule16(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_80;
+return TokenType::TOKEN_TYPE_89;
 }
 
 inline TokenType _lexRule17(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_81;
+return TokenType::TOKEN_TYPE_90;
 }
 
 inline TokenType _lexRule18(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_82;
+return TokenType::TOKEN_TYPE_91;
 }
 
 inline TokenType _lexRule19(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_83;
+return TokenType::TOKEN_TYPE_92;
 }
 
 inline TokenType _lexRule20(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_84;
+return TokenType::TOKEN_TYPE_93;
 }
 
 inline TokenType _lexRule21(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_85;
+return TokenType::TOKEN_TYPE_94;
 }
 
 inline TokenType _lexRule22(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_86;
+return TokenType::TOKEN_TYPE_95;
 }
 
 inline TokenType _lexRule23(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_87;
+return TokenType::TOKEN_TYPE_96;
 }
 
 inline TokenType _lexRule24(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_88;
+return TokenType::TOKEN_TYPE_97;
 }
 
 inline TokenType _lexRule25(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_89;
+return TokenType::TOKEN_TYPE_98;
 }
 
 inline TokenType _lexRule26(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_90;
+return TokenType::TOKEN_TYPE_99;
 }
 
 inline TokenType _lexRule27(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_91;
+return TokenType::TOKEN_TYPE_100;
 }
 
 inline TokenType _lexRule28(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TOKEN_TYPE_92;
+return TokenType::TOKEN_TYPE_101;
 }
 
 inline TokenType _lexRule29(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::__EMPTY;
+return TokenType::TOKEN_TYPE_102;
 }
 
 inline TokenType _lexRule30(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::__EMPTY;
+return TokenType::TOKEN_TYPE_103;
 }
 
 inline TokenType _lexRule31(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::__EMPTY;
+return TokenType::TOKEN_TYPE_104;
 }
 
 inline TokenType _lexRule32(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::TYPE_BASE;
+return TokenType::__EMPTY;
 }
 
 inline TokenType _lexRule33(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::STRING;
+return TokenType::__EMPTY;
 }
 
 inline TokenType _lexRule34(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::BOOLEAN;
+return TokenType::__EMPTY;
 }
 
 inline TokenType _lexRule35(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::REAL;
+return TokenType::TYPE_BASE;
 }
 
 inline TokenType _lexRule36(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::INTEGER;
+return TokenType::STRING;
 }
 
 inline TokenType _lexRule37(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::IDENTIFIER;
+return TokenType::BOOLEAN;
 }
 
 inline TokenType _lexRule38(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::SEMICOLON;
+return TokenType::REAL;
 }
 
 inline TokenType _lexRule39(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::SEPARATOR;
+return TokenType::INTEGER;
 }
 
 inline TokenType _lexRule40(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::ADD;
+return TokenType::IDENTIFIER;
 }
 
 inline TokenType _lexRule41(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::SUB;
+return TokenType::SEMICOLON;
 }
 
 inline TokenType _lexRule42(const Tokenizer& tokenizer, const std::string& yytext) {
-return TokenType::MUL;
+return TokenType::SEPARATOR;
 }
 
 inline TokenType _lexRule43(const Tokenizer& tokenizer, const std::string& yytext) {
+return TokenType::ADD;
+}
+
+inline TokenType _lexRule44(const Tokenizer& tokenizer, const std::string& yytext) {
+return TokenType::SUB;
+}
+
+inline TokenType _lexRule45(const Tokenizer& tokenizer, const std::string& yytext) {
+return TokenType::MUL;
+}
+
+inline TokenType _lexRule46(const Tokenizer& tokenizer, const std::string& yytext) {
 return TokenType::DIV;
 }
+
+inline TokenType _lexRule47(const Tokenizer& tokenizer, const std::string& yytext) {
+return TokenType::ELLIPSIS;
+}
+
+inline TokenType _lexRule48(const Tokenizer& tokenizer, const std::string& yytext) {
+return TokenType::DOT;
+}
 // clang-format on
 
 // ------------------------------------------------------------------
@@ -600,33 +625,38 @@ std::array<LexRule, Tokenizer::LEX_RULES_COUNT> Tokenizer::lexRules_ = {{
   {std::regex(R"(^implementation)"), &_lexRule16},
   {std::regex(R"(^\$)"), &_lexRule17},
   {std::regex(R"(^,)"), &_lexRule18},
-  {std::regex(R"(^\.)"), &_lexRule19},
-  {std::regex(R"(^as)"), &_lexRule20},
-  {std::regex(R"(^@)"), &_lexRule21},
-  {std::regex(R"(^void)"), &_lexRule22},
-  {std::regex(R"(^\[)"), &_lexRule23},
-  {std::regex(R"(^\])"), &_lexRule24},
-  {std::regex(R"(^return)"), &_lexRule25},
-  {std::regex(R"(^var)"), &_lexRule26},
-  {std::regex(R"(^set)"), &_lexRule27},
-  {std::regex(R"(^default)"), &_lexRule28},
-  {std::regex(R"(^\s+)"), &_lexRule29},
-  {std::regex(R"(^\/\/.*)"), &_lexRule30},
-  {std::regex(R"(^\{[^\}]*\})"), &_lexRule31},
-  {std::regex(R"(^(integer|cardinal|real|char|string|boolean))"), &_lexRule32},
-  {std::regex(R"(^(['"])(.*?[^\\])?(\\\\)*(\1))"), &_lexRule33},
-  {std::regex(R"(^true|false)"), &_lexRule34},
-  {std::regex(R"(^[0-9]+\.[0-9]+)"), &_lexRule35},
-  {std::regex(R"(^[0-9]+)"), &_lexRule36},
-  {std::regex(R"(^[a-zA-Z_][a-zA-Z0-9_]*)"), &_lexRule37},
-  {std::regex(R"(^[;])"), &_lexRule38},
-  {std::regex(R"(^\\)"), &_lexRule39},
-  {std::regex(R"(^\+)"), &_lexRule40},
-  {std::regex(R"(^-)"), &_lexRule41},
-  {std::regex(R"(^\*)"), &_lexRule42},
-  {std::regex(R"(^\/)"), &_lexRule43}
+  {std::regex(R"(^as)"), &_lexRule19},
+  {std::regex(R"(^<)"), &_lexRule20},
+  {std::regex(R"(^>)"), &_lexRule21},
+  {std::regex(R"(^of)"), &_lexRule22},
+  {std::regex(R"(^@)"), &_lexRule23},
+  {std::regex(R"(^void)"), &_lexRule24},
+  {std::regex(R"(^#)"), &_lexRule25},
+  {std::regex(R"(^\[)"), &_lexRule26},
+  {std::regex(R"(^\])"), &_lexRule27},
+  {std::regex(R"(^return)"), &_lexRule28},
+  {std::regex(R"(^var)"), &_lexRule29},
+  {std::regex(R"(^set)"), &_lexRule30},
+  {std::regex(R"(^default)"), &_lexRule31},
+  {std::regex(R"(^\s+)"), &_lexRule32},
+  {std::regex(R"(^\/\/.*)"), &_lexRule33},
+  {std::regex(R"(^\{[^\}]*\})"), &_lexRule34},
+  {std::regex(R"(^(integer|cardinal|real|char|string|boolean))"), &_lexRule35},
+  {std::regex(R"(^(['"])(.*?[^\\])?(\\\\)*(\1))"), &_lexRule36},
+  {std::regex(R"(^true|false)"), &_lexRule37},
+  {std::regex(R"(^[0-9]+\.[0-9]+)"), &_lexRule38},
+  {std::regex(R"(^[0-9]+)"), &_lexRule39},
+  {std::regex(R"(^[a-zA-Z_][a-zA-Z0-9_]*)"), &_lexRule40},
+  {std::regex(R"(^[;])"), &_lexRule41},
+  {std::regex(R"(^\\)"), &_lexRule42},
+  {std::regex(R"(^\+)"), &_lexRule43},
+  {std::regex(R"(^-)"), &_lexRule44},
+  {std::regex(R"(^\*)"), &_lexRule45},
+  {std::regex(R"(^\/)"), &_lexRule46},
+  {std::regex(R"(^\.\.\.)"), &_lexRule47},
+  {std::regex(R"(^\.)"), &_lexRule48}
 }};
-std::map<TokenizerState, std::vector<size_t>> Tokenizer::lexRulesByStartConditions_ =  {{TokenizerState::INITIAL, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42}}};
+std::map<TokenizerState, std::vector<size_t>> Tokenizer::lexRulesByStartConditions_ =  {{TokenizerState::INITIAL, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47}}};
 // clang-format on
 
 #endif
@@ -828,10 +858,10 @@ class parser {
   }
 
   // clang-format off
-  static constexpr size_t PRODUCTIONS_COUNT = 129;
+  static constexpr size_t PRODUCTIONS_COUNT = 150;
   static std::array<Production, PRODUCTIONS_COUNT> productions_;
 
-  static constexpr size_t ROWS_COUNT = 231;
+  static constexpr size_t ROWS_COUNT = 284;
   static std::array<Row, ROWS_COUNT> table_;
   // clang-format on
 };
@@ -1000,7 +1030,6 @@ PUSH_VR();
 
 void _handler15(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
 auto _1 = POP_V();
 
 auto __ = _1;
@@ -1049,6 +1078,30 @@ PUSH_VR();
 void _handler19(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
+
+auto __ = _1;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler20(yyparse& parser) {
+// Semantic action prologue.
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
+
+auto __ = _1;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler21(yyparse& parser) {
+// Semantic action prologue.
+parser.tokensStack.pop_back();
 auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
@@ -1059,7 +1112,7 @@ PUSH_VR();
 
 }
 
-void _handler20(yyparse& parser) {
+void _handler22(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
 auto _2 = POP_V();
@@ -1072,7 +1125,7 @@ PUSH_VR();
 
 }
 
-void _handler21(yyparse& parser) {
+void _handler23(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
@@ -1092,137 +1145,148 @@ PUSH_VR();
 
 }
 
-void _handler22(yyparse& parser) {
+void _handler24(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _8 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<LabelNode>(as(IdentifierNode, _2), as(ListNode, _5), as(ListNode, _8));
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler23(yyparse& parser) {
+void _handler25(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _8 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<RecordNode>(as(IdentifierNode, _2), as(ListNode, _5), as(ListNode, _8));
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler24(yyparse& parser) {
+void _handler26(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _7 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto function = as(FunctionNode, _5);
+
+    function->name = as(IdentifierNode, _2);
+    function->body = std::make_shared<ListNode>(std::make_shared<ReturnNode>(_7));
+    auto __ = function;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler25(yyparse& parser) {
+void _handler27(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _7 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto function = as(FunctionNode, _5);
+
+    function->name = as(IdentifierNode, _2);
+    function->body = as(ListNode, _7);
+    auto __ = function;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler26(yyparse& parser) {
+void _handler28(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _8 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _6 = POP_V();
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ClassNode>(ClassNode::Kind::CLASS, as(IdentifierNode, _2), as(ListNode, _5), as(ListNode, _6), as(ListNode, _8));
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler27(yyparse& parser) {
+void _handler29(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _8 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _6 = POP_V();
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ClassNode>(ClassNode::Kind::INTERFACE, as(IdentifierNode, _2), as(ListNode, _5), as(ListNode, _6), as(ListNode, _8));
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler28(yyparse& parser) {
+void _handler30(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _8 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _6 = POP_V();
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ClassNode>(ClassNode::Kind::IMPLEMENTATION, as(IdentifierNode, _2), as(ListNode, _5), as(ListNode, _6), as(ListNode, _8));
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler29(yyparse& parser) {
+void _handler31(yyparse& parser) {
 // Semantic action prologue.
 auto _1 = POP_T();
 
@@ -1233,19 +1297,20 @@ PUSH_VR();
 
 }
 
-void _handler30(yyparse& parser) {
+void _handler32(yyparse& parser) {
 // Semantic action prologue.
 auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = _2;
+as(IdentifierNode, _2)->dynamic = true;
+		auto __ = _2;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler31(yyparse& parser) {
+void _handler33(yyparse& parser) {
 // Semantic action prologue.
 auto _1 = POP_V();
 
@@ -1256,7 +1321,7 @@ PUSH_VR();
 
 }
 
-void _handler32(yyparse& parser) {
+void _handler34(yyparse& parser) {
 // Semantic action prologue.
 auto _3 = POP_V();
 parser.tokensStack.pop_back();
@@ -1270,7 +1335,7 @@ PUSH_VR();
 
 }
 
-void _handler33(yyparse& parser) {
+void _handler35(yyparse& parser) {
 // Semantic action prologue.
 auto _1 = POP_V();
 
@@ -1281,7 +1346,7 @@ PUSH_VR();
 
 }
 
-void _handler34(yyparse& parser) {
+void _handler36(yyparse& parser) {
 // Semantic action prologue.
 auto _3 = POP_V();
 parser.tokensStack.pop_back();
@@ -1295,31 +1360,37 @@ PUSH_VR();
 
 }
 
-void _handler35(yyparse& parser) {
+void _handler37(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler36(yyparse& parser) {
+void _handler38(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+std::string name;
+
+    for (auto &part: as(ListNode, _1)->list) {
+      name += as(IdentifierNode, part)->name + ".";
+    }
+
+    auto __ = std::make_shared<IdentifierNode>(name + as(IdentifierNode, _3)->name);
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler37(yyparse& parser) {
+void _handler39(yyparse& parser) {
 // Semantic action prologue.
 auto _1 = POP_V();
 
@@ -1330,7 +1401,7 @@ PUSH_VR();
 
 }
 
-void _handler38(yyparse& parser) {
+void _handler40(yyparse& parser) {
 // Semantic action prologue.
 auto _3 = POP_V();
 parser.tokensStack.pop_back();
@@ -1344,7 +1415,7 @@ PUSH_VR();
 
 }
 
-void _handler39(yyparse& parser) {
+void _handler41(yyparse& parser) {
 // Semantic action prologue.
 parser.valuesStack.pop_back();
 
@@ -1355,7 +1426,7 @@ PUSH_VR();
 
 }
 
-void _handler40(yyparse& parser) {
+void _handler42(yyparse& parser) {
 // Semantic action prologue.
 parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
@@ -1368,7 +1439,7 @@ PUSH_VR();
 
 }
 
-void _handler41(yyparse& parser) {
+void _handler43(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
 parser.valuesStack.pop_back();
@@ -1383,7 +1454,7 @@ PUSH_VR();
 
 }
 
-void _handler42(yyparse& parser) {
+void _handler44(yyparse& parser) {
 // Semantic action prologue.
 auto _1 = POP_V();
 
@@ -1394,7 +1465,7 @@ PUSH_VR();
 
 }
 
-void _handler43(yyparse& parser) {
+void _handler45(yyparse& parser) {
 // Semantic action prologue.
 auto _3 = POP_V();
 parser.tokensStack.pop_back();
@@ -1408,7 +1479,7 @@ PUSH_VR();
 
 }
 
-void _handler44(yyparse& parser) {
+void _handler46(yyparse& parser) {
 // Semantic action prologue.
 parser.valuesStack.pop_back();
 
@@ -1419,7 +1490,7 @@ PUSH_VR();
 
 }
 
-void _handler45(yyparse& parser) {
+void _handler47(yyparse& parser) {
 // Semantic action prologue.
 parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
@@ -1432,7 +1503,7 @@ PUSH_VR();
 
 }
 
-void _handler46(yyparse& parser) {
+void _handler48(yyparse& parser) {
 // Semantic action prologue.
 auto _1 = POP_V();
 
@@ -1443,7 +1514,7 @@ PUSH_VR();
 
 }
 
-void _handler47(yyparse& parser) {
+void _handler49(yyparse& parser) {
 // Semantic action prologue.
 auto _3 = POP_V();
 parser.tokensStack.pop_back();
@@ -1457,7 +1528,7 @@ PUSH_VR();
 
 }
 
-void _handler48(yyparse& parser) {
+void _handler50(yyparse& parser) {
 // Semantic action prologue.
 
 
@@ -1468,7 +1539,7 @@ PUSH_VR();
 
 }
 
-void _handler49(yyparse& parser) {
+void _handler51(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
 parser.tokensStack.pop_back();
@@ -1480,102 +1551,77 @@ PUSH_VR();
 
 }
 
-void _handler50(yyparse& parser) {
+void _handler52(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = _2;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler51(yyparse& parser) {
+void _handler53(yyparse& parser) {
 // Semantic action prologue.
+auto _1 = POP_V();
 
-
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler52(yyparse& parser) {
+void _handler54(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto type = std::make_shared<TypeNode>(as(IdentifierNode, _1)->name);
+
+    type->arguments = as(ListNode, _3);
+    auto __ = type;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler53(yyparse& parser) {
+void _handler55(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ListNode>(_1);
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler54(yyparse& parser) {
+void _handler56(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-
-auto __ = std::make_shared<Node>();
+as(ListNode, _1)->list.push_back(_3);
+    auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler55(yyparse& parser) {
+void _handler57(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
 
- // Semantic action epilogue.
-PUSH_VR();
-
-}
-
-void _handler56(yyparse& parser) {
-// Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-
-auto __ = std::make_shared<Node>();
-
- // Semantic action epilogue.
-PUSH_VR();
-
-}
-
-void _handler57(yyparse& parser) {
-// Semantic action prologue.
-parser.valuesStack.pop_back();
-
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ListNode>();
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1584,10 +1630,11 @@ PUSH_VR();
 
 void _handler58(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+parser.tokensStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = _2;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1596,11 +1643,9 @@ PUSH_VR();
 
 void _handler59(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<VarNode>(as(IdentifierNode, _1), nullptr);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1609,12 +1654,11 @@ PUSH_VR();
 
 void _handler60(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-auto _2 = POP_V();
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = _2;
+auto __ = std::make_shared<VarNode>(as(IdentifierNode, _1), as(TypeNode, _3));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1623,9 +1667,9 @@ PUSH_VR();
 
 void _handler61(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ListNode>(_1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1634,11 +1678,12 @@ PUSH_VR();
 
 void _handler62(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+as(ListNode, _1)->list.push_back(_3);
+    auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1647,9 +1692,9 @@ PUSH_VR();
 
 void _handler63(yyparse& parser) {
 // Semantic action prologue.
-auto _1 = POP_V();
 
-auto __ = std::make_shared<ListNode>(_1);
+
+auto __ = std::make_shared<FunctionNode>(std::make_shared<ListNode>(), nullptr, nullptr);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1658,12 +1703,11 @@ PUSH_VR();
 
 void _handler64(yyparse& parser) {
 // Semantic action prologue.
-auto _3 = POP_V();
 parser.tokensStack.pop_back();
-auto _1 = POP_V();
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
 
-as(ListNode, _1)->list.push_back(_3);
-		auto __ = _1;
+auto __ = std::make_shared<FunctionNode>(as(ListNode, _2), nullptr, nullptr);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1672,9 +1716,13 @@ PUSH_VR();
 
 void _handler65(yyparse& parser) {
 // Semantic action prologue.
-auto _1 = POP_V();
+auto _5 = POP_V();
+parser.tokensStack.pop_back();
+parser.tokensStack.pop_back();
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<ListNode>(_1);
+auto __ = std::make_shared<FunctionNode>(as(ListNode, _2), as(TypeNode, _5), nullptr);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1683,12 +1731,9 @@ PUSH_VR();
 
 void _handler66(yyparse& parser) {
 // Semantic action prologue.
-auto _3 = POP_V();
-parser.tokensStack.pop_back();
-auto _1 = POP_V();
 
-as(ListNode, _1)->list.push_back(_3);
-    auto __ = _1;
+
+auto __ = std::make_shared<Node>();
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1697,7 +1742,9 @@ PUSH_VR();
 
 void _handler67(yyparse& parser) {
 // Semantic action prologue.
-
+parser.tokensStack.pop_back();
+parser.valuesStack.pop_back();
+parser.tokensStack.pop_back();
 
 auto __ = std::make_shared<Node>();
 
@@ -1708,9 +1755,13 @@ PUSH_VR();
 
 void _handler68(yyparse& parser) {
 // Semantic action prologue.
-auto _1 = POP_V();
+parser.valuesStack.pop_back();
+parser.tokensStack.pop_back();
+parser.tokensStack.pop_back();
+parser.valuesStack.pop_back();
+parser.tokensStack.pop_back();
 
-auto __ = _1;
+auto __ = std::make_shared<Node>();
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1719,9 +1770,9 @@ PUSH_VR();
 
 void _handler69(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<VarNode>(as(IdentifierNode, _1), nullptr);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1730,9 +1781,10 @@ PUSH_VR();
 
 void _handler70(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<VarNode>(as(IdentifierNode, _2), nullptr);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1741,9 +1793,11 @@ PUSH_VR();
 
 void _handler71(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<VarNode>(as(IdentifierNode, _1), as(TypeNode, _3));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1752,9 +1806,12 @@ PUSH_VR();
 
 void _handler72(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _4 = POP_V();
+parser.tokensStack.pop_back();
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<VarNode>(as(IdentifierNode, _2), as(TypeNode, _4));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1763,9 +1820,9 @@ PUSH_VR();
 
 void _handler73(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1774,9 +1831,12 @@ PUSH_VR();
 
 void _handler74(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+as(VarNode, _1)->setValue(_3);
+		auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1785,12 +1845,19 @@ PUSH_VR();
 
 void _handler75(yyparse& parser) {
 // Semantic action prologue.
+auto _8 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _5 = POP_V();
+parser.tokensStack.pop_back();
+parser.tokensStack.pop_back();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto var = std::make_shared<VarNode>(as(IdentifierNode, _1), std::make_shared<TypeNode>("function"));
+
+		var->setValue(std::make_shared<FunctionNode>(as(ListNode, _5), nullptr, std::make_shared<ListNode>(std::make_shared<ReturnNode>(_8))));
+		auto __ = var;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1799,9 +1866,21 @@ PUSH_VR();
 
 void _handler76(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _10 = POP_V();
+parser.tokensStack.pop_back();
+auto _8 = POP_V();
+parser.tokensStack.pop_back();
+parser.tokensStack.pop_back();
+auto _5 = POP_V();
+parser.tokensStack.pop_back();
+parser.tokensStack.pop_back();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto var = std::make_shared<VarNode>(as(IdentifierNode, _1), std::make_shared<TypeNode>("function"));
+
+		var->setValue(std::make_shared<FunctionNode>(as(ListNode, _5), as(TypeNode, _8), std::make_shared<ListNode>(std::make_shared<ReturnNode>(_10))));
+		auto __ = var;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1810,11 +1889,9 @@ PUSH_VR();
 
 void _handler77(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ListNode>(_1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1823,9 +1900,12 @@ PUSH_VR();
 
 void _handler78(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+as(ListNode, _1)->list.push_back(_3);
+		auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1834,9 +1914,9 @@ PUSH_VR();
 
 void _handler79(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1845,9 +1925,11 @@ PUSH_VR();
 
 void _handler80(yyparse& parser) {
 // Semantic action prologue.
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+as(VarNode, _2)->variadic = true;
+    auto __ = _2;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1856,9 +1938,9 @@ PUSH_VR();
 
 void _handler81(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ListNode>(_1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1867,9 +1949,12 @@ PUSH_VR();
 
 void _handler82(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+as(ListNode, _1)->list.push_back(_3);
+    auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1878,9 +1963,12 @@ PUSH_VR();
 
 void _handler83(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+as(ListNode, _1)->list.push_back(_3);
+    auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1889,9 +1977,9 @@ PUSH_VR();
 
 void _handler84(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+
+auto __ = std::make_shared<ListNode>();
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1900,9 +1988,9 @@ PUSH_VR();
 
 void _handler85(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1911,12 +1999,9 @@ PUSH_VR();
 
 void _handler86(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
 parser.valuesStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<TypeNode>("void");
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1925,11 +2010,9 @@ PUSH_VR();
 
 void _handler87(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1939,13 +2022,8 @@ PUSH_VR();
 void _handler88(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<TypeNode>("function");
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1954,9 +2032,9 @@ PUSH_VR();
 
 void _handler89(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<TypeNode>(as(IdentifierNode, _1)->name);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1965,11 +2043,15 @@ PUSH_VR();
 
 void _handler90(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto type = std::make_shared<TypeNode>(as(IdentifierNode, _1)->name);
+
+    type->arguments = as(ListNode, _3);
+    auto __ = type;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -1978,9 +2060,7 @@ PUSH_VR();
 
 void _handler91(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
 
 auto __ = std::make_shared<Node>();
 
@@ -1991,11 +2071,9 @@ PUSH_VR();
 
 void _handler92(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_T();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<TypeNode>(_1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2004,11 +2082,21 @@ PUSH_VR();
 
 void _handler93(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto type = as(TypeNode, _1);
+
+    if (auto literal = as(LiteralNode, _3)) {
+      type->setSize(std::stoul(literal->text));
+    } else {
+      type->setSize(0);
+      type->expression = _3;
+    }
+
+    auto __ = type;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2017,11 +2105,9 @@ PUSH_VR();
 
 void _handler94(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ListNode>(_1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2030,9 +2116,12 @@ PUSH_VR();
 
 void _handler95(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
 auto _1 = POP_V();
 
-auto __ = std::make_shared<ListNode>(_1);
+as(ListNode, _1)->list.push_back(_3);
+    auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2041,12 +2130,9 @@ PUSH_VR();
 
 void _handler96(yyparse& parser) {
 // Semantic action prologue.
-auto _3 = POP_V();
-parser.tokensStack.pop_back();
-auto _1 = POP_V();
+auto _1 = POP_T();
 
-as(ListNode, _1)->list.push_back(_3);
-    auto __ = _1;
+auto __ = std::make_shared<LiteralNode>(LiteralNode::Kind::REAL, _1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2055,9 +2141,9 @@ PUSH_VR();
 
 void _handler97(yyparse& parser) {
 // Semantic action prologue.
+auto _1 = POP_T();
 
-
-auto __ = std::make_shared<ListNode>();
+auto __ = std::make_shared<LiteralNode>(LiteralNode::Kind::INTEGER, _1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2066,9 +2152,9 @@ PUSH_VR();
 
 void _handler98(yyparse& parser) {
 // Semantic action prologue.
-auto _1 = POP_V();
+auto _1 = POP_T();
 
-auto __ = _1;
+auto __ = std::make_shared<LiteralNode>(LiteralNode::Kind::STRING, _1.substr(1, _1.size() - 2));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2077,10 +2163,9 @@ PUSH_VR();
 
 void _handler99(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
+auto _1 = POP_T();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<LiteralNode>(LiteralNode::Kind::BOOLEAN, _1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2089,9 +2174,9 @@ PUSH_VR();
 
 void _handler100(yyparse& parser) {
 // Semantic action prologue.
+auto _1 = POP_V();
 
-
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2100,10 +2185,9 @@ PUSH_VR();
 
 void _handler101(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
+parser.valuesStack.pop_back();
 
-// size: INTEGER
-    auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<Node>();
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2112,9 +2196,9 @@ PUSH_VR();
 
 void _handler102(yyparse& parser) {
 // Semantic action prologue.
+auto _1 = POP_V();
 
-
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2123,9 +2207,9 @@ PUSH_VR();
 
 void _handler103(yyparse& parser) {
 // Semantic action prologue.
-parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2134,9 +2218,11 @@ PUSH_VR();
 
 void _handler104(yyparse& parser) {
 // Semantic action prologue.
-
-
-auto __ = std::make_shared<Node>();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
+
+auto __ = std::make_shared<LabelValueNode>(_1, as(IdentifierNode, _3));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2145,9 +2231,12 @@ PUSH_VR();
 
 void _handler105(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+parser.tokensStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<IndexNode>(_1, _3);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2156,11 +2245,11 @@ PUSH_VR();
 
 void _handler106(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<MemberNode>(_1, as(IdentifierNode, _3));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2170,11 +2259,13 @@ PUSH_VR();
 void _handler107(yyparse& parser) {
 // Semantic action prologue.
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<CallNode>(std::make_shared<MemberNode>(_1, as(IdentifierNode, _3)), as(ListNode, _5));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2183,10 +2274,9 @@ PUSH_VR();
 
 void _handler108(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2195,10 +2285,11 @@ PUSH_VR();
 
 void _handler109(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<BinaryNode>("+", _1, _3);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2207,9 +2298,11 @@ PUSH_VR();
 
 void _handler110(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<BinaryNode>("-", _1, _3);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2218,12 +2311,11 @@ PUSH_VR();
 
 void _handler111(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<BinaryNode>("*", _1, _3);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2232,11 +2324,11 @@ PUSH_VR();
 
 void _handler112(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<BinaryNode>("/", _1, _3);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2245,9 +2337,11 @@ PUSH_VR();
 
 void _handler113(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
 auto _1 = POP_V();
 
-auto __ = std::make_shared<ListNode>(_1);
+auto __ = std::make_shared<CastNode>(_1, as(TypeNode, _3));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2260,8 +2354,7 @@ auto _3 = POP_V();
 parser.tokensStack.pop_back();
 auto _1 = POP_V();
 
-as(ListNode, _1)->list.push_back(_3);
-		auto __ = _1;
+auto __ = std::make_shared<CastNode>(_1, as(TypeNode, _3));
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2270,11 +2363,9 @@ PUSH_VR();
 
 void _handler115(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2283,11 +2374,11 @@ PUSH_VR();
 
 void _handler116(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = _2;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2296,13 +2387,9 @@ PUSH_VR();
 
 void _handler117(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ListNode>(_1);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2311,9 +2398,12 @@ PUSH_VR();
 
 void _handler118(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+as(ListNode, _1)->list.push_back(_3);
+    auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2322,11 +2412,9 @@ PUSH_VR();
 
 void _handler119(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
-parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+
+auto __ = std::make_shared<ListNode>();
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2335,9 +2423,9 @@ PUSH_VR();
 
 void _handler120(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto __ = _1;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2346,11 +2434,10 @@ PUSH_VR();
 
 void _handler121(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto __ = std::make_shared<ReturnNode>(_2);
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2359,6 +2446,205 @@ PUSH_VR();
 
 void _handler122(yyparse& parser) {
 // Semantic action prologue.
+
+
+auto __ = std::make_shared<LiteralNode>(LiteralNode::Kind::INTEGER, "0");
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler123(yyparse& parser) {
+// Semantic action prologue.
+auto _1 = POP_T();
+
+auto __ = std::make_shared<LiteralNode>(LiteralNode::Kind::INTEGER, _1);
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler124(yyparse& parser) {
+// Semantic action prologue.
+auto _1 = POP_V();
+
+auto __ = _1;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler125(yyparse& parser) {
+// Semantic action prologue.
+
+
+auto __ = std::make_shared<LiteralNode>(LiteralNode::Kind::INTEGER, "0");
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler126(yyparse& parser) {
+// Semantic action prologue.
+auto _1 = POP_T();
+
+auto __ = std::make_shared<LiteralNode>(LiteralNode::Kind::INTEGER, _1);
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler127(yyparse& parser) {
+// Semantic action prologue.
+
+
+auto type = std::make_shared<TypeNode>();
+
+    type->fixedType = true;
+    auto __ = type;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler128(yyparse& parser) {
+// Semantic action prologue.
+auto _1 = POP_V();
+
+auto __ = _1;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler129(yyparse& parser) {
+// Semantic action prologue.
+parser.tokensStack.pop_back();
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
+
+auto type = std::make_shared<TypeNode>();
+
+    type->fixedType = true;
+
+    if (auto literal = as(LiteralNode, _2)) {
+      type->setSize(std::stoul(literal->text));
+    } else {
+      type->setSize(0);
+      type->expression = _2;
+    }
+
+    auto __ = type;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler130(yyparse& parser) {
+// Semantic action prologue.
+parser.tokensStack.pop_back();
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
+
+auto __ = std::make_shared<TypeNode>(as(TypeNode, _1), std::stoul(as(LiteralNode, _3)->text));
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler131(yyparse& parser) {
+// Semantic action prologue.
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
+
+auto __ = _2;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler132(yyparse& parser) {
+// Semantic action prologue.
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
+
+for (auto &item: as(ListNode, _2)->list) {
+      as(VarNode, item)->constant = true;
+    }
+
+    auto __ = _2;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler133(yyparse& parser) {
+// Semantic action prologue.
+auto _1 = POP_V();
+
+if (!as(IdentifierNode, _1) && !as(IndexNode, _1) && !as(MemberNode, _1)) {
+			throw std::runtime_error("Only a variable, an element or a member can be assigned");
+		}
+
+		auto __ = _1;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler134(yyparse& parser) {
+// Semantic action prologue.
+auto _1 = POP_V();
+
+auto __ = std::make_shared<ListNode>(_1);
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler135(yyparse& parser) {
+// Semantic action prologue.
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
+
+as(ListNode, _1)->list.push_back(_3);
+		auto __ = _1;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler136(yyparse& parser) {
+// Semantic action prologue.
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
+
+auto __ = std::make_shared<AssignNode>(as(ListNode, _1), _3);
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler137(yyparse& parser) {
+// Semantic action prologue.
 parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
 parser.valuesStack.pop_back();
@@ -2370,7 +2656,7 @@ PUSH_VR();
 
 }
 
-void _handler123(yyparse& parser) {
+void _handler138(yyparse& parser) {
 // Semantic action prologue.
 parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
@@ -2385,7 +2671,7 @@ PUSH_VR();
 
 }
 
-void _handler124(yyparse& parser) {
+void _handler139(yyparse& parser) {
 // Semantic action prologue.
 parser.valuesStack.pop_back();
 
@@ -2396,7 +2682,7 @@ PUSH_VR();
 
 }
 
-void _handler125(yyparse& parser) {
+void _handler140(yyparse& parser) {
 // Semantic action prologue.
 parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
@@ -2409,35 +2695,104 @@ PUSH_VR();
 
 }
 
-void _handler126(yyparse& parser) {
+void _handler141(yyparse& parser) {
+// Semantic action prologue.
+auto _1 = POP_V();
+
+auto __ = std::make_shared<VarNode>(as(IdentifierNode, _1), std::make_shared<TypeNode>());
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler142(yyparse& parser) {
 // Semantic action prologue.
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _1 = POP_V();
+
+auto __ = std::make_shared<VarNode>(as(IdentifierNode, _1), as(TypeNode, _3));
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler143(yyparse& parser) {
+// Semantic action prologue.
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto field = std::make_shared<VarNode>(as(IdentifierNode, _1), std::make_shared<TypeNode>());
+
+    field->setValue(_3);
+    auto __ = field;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler127(yyparse& parser) {
+void _handler144(yyparse& parser) {
 // Semantic action prologue.
+auto _5 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _3 = POP_V();
 parser.tokensStack.pop_back();
+auto _1 = POP_V();
 
-auto __ = std::make_shared<Node>();
+auto field = std::make_shared<VarNode>(as(IdentifierNode, _1), as(TypeNode, _3));
+
+    field->setValue(_5);
+    auto __ = field;
 
  // Semantic action epilogue.
 PUSH_VR();
 
 }
 
-void _handler128(yyparse& parser) {
+void _handler145(yyparse& parser) {
+// Semantic action prologue.
+auto _1 = POP_V();
+
+auto __ = std::make_shared<ListNode>(_1);
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler146(yyparse& parser) {
+// Semantic action prologue.
+auto _3 = POP_V();
+parser.tokensStack.pop_back();
+auto _1 = POP_V();
+
+as(ListNode, _1)->list.push_back(_3);
+    auto __ = _1;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler147(yyparse& parser) {
+// Semantic action prologue.
+parser.tokensStack.pop_back();
+auto _2 = POP_V();
+parser.tokensStack.pop_back();
+
+auto __ = std::make_shared<ArrayNode>(as(ListNode, _2));
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler148(yyparse& parser) {
 // Semantic action prologue.
-parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
 parser.valuesStack.pop_back();
 parser.tokensStack.pop_back();
@@ -2449,15 +2804,35 @@ PUSH_VR();
 
 }
 
-void _handler129(yyparse& parser) {
+void _handler149(yyparse& parser) {
 // Semantic action prologue.
+auto _4 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
-parser.valuesStack.pop_back();
+
+auto function = as(FunctionNode, _2);
+
+		function->body = std::make_shared<ListNode>(std::make_shared<ReturnNode>(_4));
+		auto __ = function;
+
+ // Semantic action epilogue.
+PUSH_VR();
+
+}
+
+void _handler150(yyparse& parser) {
+// Semantic action prologue.
+parser.tokensStack.pop_back();
+auto _4 = POP_V();
+parser.tokensStack.pop_back();
+auto _2 = POP_V();
 parser.tokensStack.pop_back();
 
-auto __ = std::make_shared<Node>();
+auto function = as(FunctionNode, _2);
+
+		function->body = as(ListNode, _4);
+		auto __ = function;
 
  // Semantic action epilogue.
 PUSH_VR();
@@ -2480,24 +2855,24 @@ std::array<Production, yyparse::PRODUCTIONS_COUNT> yyparse::productions_ = {{{-1
 {3, 1, &_handler12},
 {3, 1, &_handler13},
 {3, 1, &_handler14},
-{4, 2, &_handler15},
-{5, 2, &_handler16},
-{6, 2, &_handler17},
-{7, 2, &_handler18},
-{8, 3, &_handler19},
-{9, 3, &_handler20},
-{10, 10, &_handler21},
-{10, 10, &_handler22},
-{10, 10, &_handler23},
-{10, 8, &_handler24},
-{10, 8, &_handler25},
-{10, 8, &_handler26},
-{10, 8, &_handler27},
-{10, 8, &_handler28},
-{11, 1, &_handler29},
-{11, 2, &_handler30},
+{3, 1, &_handler15},
+{4, 2, &_handler16},
+{5, 2, &_handler17},
+{6, 2, &_handler18},
+{7, 2, &_handler19},
+{8, 2, &_handler20},
+{9, 3, &_handler21},
+{10, 3, &_handler22},
+{11, 10, &_handler23},
+{11, 10, &_handler24},
+{11, 10, &_handler25},
+{11, 8, &_handler26},
+{11, 8, &_handler27},
+{11, 9, &_handler28},
+{11, 9, &_handler29},
+{11, 9, &_handler30},
 {12, 1, &_handler31},
-{12, 3, &_handler32},
+{12, 2, &_handler32},
 {13, 1, &_handler33},
 {13, 3, &_handler34},
 {14, 1, &_handler35},
@@ -2506,95 +2881,116 @@ std::array<Production, yyparse::PRODUCTIONS_COUNT> yyparse::productions_ = {{{-1
 {15, 3, &_handler38},
 {16, 1, &_handler39},
 {16, 3, &_handler40},
-{16, 5, &_handler41},
-{17, 1, &_handler42},
-{17, 3, &_handler43},
+{17, 1, &_handler41},
+{17, 3, &_handler42},
+{17, 5, &_handler43},
 {18, 1, &_handler44},
 {18, 3, &_handler45},
 {19, 1, &_handler46},
 {19, 3, &_handler47},
-{20, 0, &_handler48},
-{20, 2, &_handler49},
-{20, 3, &_handler50},
-{21, 0, &_handler51},
+{20, 1, &_handler48},
+{20, 3, &_handler49},
+{21, 0, &_handler50},
+{21, 2, &_handler51},
 {21, 3, &_handler52},
-{21, 5, &_handler53},
-{22, 0, &_handler54},
-{22, 3, &_handler55},
-{22, 5, &_handler56},
-{23, 1, &_handler57},
-{23, 2, &_handler58},
-{23, 3, &_handler59},
-{23, 4, &_handler60},
-{24, 1, &_handler61},
-{24, 3, &_handler62},
-{25, 1, &_handler63},
-{25, 3, &_handler64},
-{26, 1, &_handler65},
-{26, 3, &_handler66},
-{27, 0, &_handler67},
-{27, 1, &_handler68},
-{28, 1, &_handler69},
-{28, 1, &_handler70},
-{28, 1, &_handler71},
-{28, 1, &_handler72},
-{29, 1, &_handler73},
-{30, 1, &_handler74},
-{30, 4, &_handler75},
-{31, 1, &_handler76},
-{31, 3, &_handler77},
-{32, 1, &_handler78},
+{22, 1, &_handler53},
+{22, 4, &_handler54},
+{23, 1, &_handler55},
+{23, 3, &_handler56},
+{24, 0, &_handler57},
+{24, 3, &_handler58},
+{25, 1, &_handler59},
+{25, 3, &_handler60},
+{26, 1, &_handler61},
+{26, 3, &_handler62},
+{27, 0, &_handler63},
+{27, 3, &_handler64},
+{27, 5, &_handler65},
+{28, 0, &_handler66},
+{28, 3, &_handler67},
+{28, 5, &_handler68},
+{29, 1, &_handler69},
+{29, 2, &_handler70},
+{29, 3, &_handler71},
+{29, 4, &_handler72},
+{30, 1, &_handler73},
+{30, 3, &_handler74},
+{30, 8, &_handler75},
+{30, 10, &_handler76},
+{31, 1, &_handler77},
+{31, 3, &_handler78},
 {32, 1, &_handler79},
-{32, 1, &_handler80},
-{32, 1, &_handler81},
-{32, 1, &_handler82},
-{32, 1, &_handler83},
-{33, 1, &_handler84},
-{33, 1, &_handler85},
-{33, 4, &_handler86},
-{33, 3, &_handler87},
-{33, 6, &_handler88},
-{34, 1, &_handler89},
-{34, 3, &_handler90},
-{34, 3, &_handler91},
-{34, 3, &_handler92},
-{34, 3, &_handler93},
-{34, 3, &_handler94},
-{35, 1, &_handler95},
-{35, 3, &_handler96},
-{36, 0, &_handler97},
-{36, 1, &_handler98},
-{37, 2, &_handler99},
-{38, 0, &_handler100},
-{38, 1, &_handler101},
-{39, 0, &_handler102},
-{39, 1, &_handler103},
-{40, 0, &_handler104},
-{40, 1, &_handler105},
+{32, 2, &_handler80},
+{33, 1, &_handler81},
+{33, 3, &_handler82},
+{33, 3, &_handler83},
+{34, 0, &_handler84},
+{34, 1, &_handler85},
+{35, 1, &_handler86},
+{35, 1, &_handler87},
+{35, 1, &_handler88},
+{35, 1, &_handler89},
+{35, 4, &_handler90},
+{36, 1, &_handler91},
+{37, 1, &_handler92},
+{37, 4, &_handler93},
+{38, 1, &_handler94},
+{38, 3, &_handler95},
+{39, 1, &_handler96},
+{39, 1, &_handler97},
+{39, 1, &_handler98},
+{39, 1, &_handler99},
+{39, 1, &_handler100},
+{39, 1, &_handler101},
+{40, 1, &_handler102},
+{40, 1, &_handler103},
+{40, 3, &_handler104},
+{40, 4, &_handler105},
 {40, 3, &_handler106},
-{40, 4, &_handler107},
-{41, 2, &_handler108},
-{42, 2, &_handler109},
-{43, 1, &_handler110},
-{43, 4, &_handler111},
-{43, 3, &_handler112},
-{44, 1, &_handler113},
-{44, 3, &_handler114},
-{45, 3, &_handler115},
-{46, 3, &_handler116},
-{46, 5, &_handler117},
-{47, 1, &_handler118},
-{47, 3, &_handler119},
-{48, 1, &_handler120},
-{48, 3, &_handler121},
-{48, 3, &_handler122},
-{48, 5, &_handler123},
-{49, 1, &_handler124},
-{49, 3, &_handler125},
-{50, 3, &_handler126},
-{51, 3, &_handler127},
-{52, 4, &_handler128},
-{52, 5, &_handler129}}};
+{40, 6, &_handler107},
+{41, 1, &_handler108},
+{41, 3, &_handler109},
+{41, 3, &_handler110},
+{41, 3, &_handler111},
+{41, 3, &_handler112},
+{41, 3, &_handler113},
+{41, 3, &_handler114},
+{41, 1, &_handler115},
+{41, 3, &_handler116},
+{42, 1, &_handler117},
+{42, 3, &_handler118},
+{43, 0, &_handler119},
+{43, 1, &_handler120},
+{44, 2, &_handler121},
+{45, 0, &_handler122},
+{45, 1, &_handler123},
+{45, 1, &_handler124},
+{46, 0, &_handler125},
+{46, 1, &_handler126},
+{47, 0, &_handler127},
+{47, 1, &_handler128},
+{47, 3, &_handler129},
+{47, 4, &_handler130},
+{48, 2, &_handler131},
+{49, 2, &_handler132},
+{50, 1, &_handler133},
+{51, 1, &_handler134},
+{51, 3, &_handler135},
+{52, 3, &_handler136},
+{53, 3, &_handler137},
+{53, 5, &_handler138},
+{54, 1, &_handler139},
+{54, 3, &_handler140},
+{55, 1, &_handler141},
+{55, 3, &_handler142},
+{55, 3, &_handler143},
+{55, 5, &_handler144},
+{56, 1, &_handler145},
+{56, 3, &_handler146},
+{57, 3, &_handler147},
+{58, 3, &_handler148},
+{59, 4, &_handler149},
+{59, 5, &_handler150}}};
 // clang-format on
 
 // ------------------------------------------------------------------
@@ -2602,237 +2998,290 @@ std::array<Production, yyparse::PRODUCTIONS_COUNT> yyparse::productions_ = {{{-1
 
 // clang-format off
 std::array<Row, yyparse::ROWS_COUNT> yyparse::table_ = {
-    Row {{0, {TE::Transit, 1}}, {65, {TE::Reduce, 1}}, {66, {TE::Reduce, 1}}, {67, {TE::Reduce, 1}}, {90, {TE::Reduce, 1}}, {91, {TE::Reduce, 1}}, {93, {TE::Reduce, 1}}},
-    Row {{1, {TE::Transit, 2}}, {4, {TE::Transit, 6}}, {5, {TE::Transit, 7}}, {8, {TE::Transit, 3}}, {9, {TE::Transit, 4}}, {10, {TE::Transit, 5}}, {41, {TE::Transit, 11}}, {42, {TE::Transit, 13}}, {65, {TE::Shift, 8}}, {66, {TE::Shift, 9}}, {67, {TE::Shift, 10}}, {90, {TE::Shift, 12}}, {91, {TE::Shift, 14}}, {93, {TE::Accept, 0}}},
-    Row {{65, {TE::Reduce, 2}}, {66, {TE::Reduce, 2}}, {67, {TE::Reduce, 2}}, {90, {TE::Reduce, 2}}, {91, {TE::Reduce, 2}}, {93, {TE::Reduce, 2}}},
-    Row {{65, {TE::Reduce, 3}}, {66, {TE::Reduce, 3}}, {67, {TE::Reduce, 3}}, {90, {TE::Reduce, 3}}, {91, {TE::Reduce, 3}}, {93, {TE::Reduce, 3}}},
-    Row {{65, {TE::Reduce, 4}}, {66, {TE::Reduce, 4}}, {67, {TE::Reduce, 4}}, {90, {TE::Reduce, 4}}, {91, {TE::Reduce, 4}}, {93, {TE::Reduce, 4}}},
-    Row {{65, {TE::Reduce, 5}}, {66, {TE::Reduce, 5}}, {67, {TE::Reduce, 5}}, {90, {TE::Reduce, 5}}, {91, {TE::Reduce, 5}}, {93, {TE::Reduce, 5}}},
-    Row {{65, {TE::Reduce, 6}}, {66, {TE::Reduce, 6}}, {67, {TE::Reduce, 6}}, {90, {TE::Reduce, 6}}, {91, {TE::Reduce, 6}}, {93, {TE::Reduce, 6}}},
-    Row {{65, {TE::Reduce, 7}}, {66, {TE::Reduce, 7}}, {67, {TE::Reduce, 7}}, {90, {TE::Reduce, 7}}, {91, {TE::Reduce, 7}}, {93, {TE::Reduce, 7}}},
-    Row {{11, {TE::Transit, 16}}, {13, {TE::Transit, 15}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 26}}, {14, {TE::Transit, 25}}, {16, {TE::Transit, 24}}, {17, {TE::Transit, 23}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{11, {TE::Transit, 44}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{53, {TE::Shift, 181}}},
-    Row {{11, {TE::Transit, 185}}, {23, {TE::Transit, 184}}, {24, {TE::Transit, 183}}, {25, {TE::Transit, 182}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}, {85, {TE::Shift, 186}}},
-    Row {{53, {TE::Shift, 196}}},
-    Row {{11, {TE::Transit, 185}}, {23, {TE::Transit, 184}}, {24, {TE::Transit, 183}}, {25, {TE::Transit, 197}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}, {85, {TE::Shift, 186}}},
-    Row {{53, {TE::Shift, 19}}, {55, {TE::Shift, 20}}},
-    Row {{53, {TE::Reduce, 32}}, {55, {TE::Reduce, 32}}},
-    Row {{53, {TE::Reduce, 28}}, {55, {TE::Reduce, 28}}, {61, {TE::Reduce, 28}}, {62, {TE::Reduce, 28}}, {63, {TE::Reduce, 28}}, {64, {TE::Reduce, 28}}, {68, {TE::Reduce, 28}}, {70, {TE::Reduce, 28}}, {71, {TE::Reduce, 28}}, {72, {TE::Reduce, 28}}, {76, {TE::Reduce, 28}}, {82, {TE::Reduce, 28}}, {83, {TE::Reduce, 28}}, {84, {TE::Reduce, 28}}, {87, {TE::Reduce, 28}}, {88, {TE::Reduce, 28}}, {92, {TE::Reduce, 28}}},
-    Row {{11, {TE::Transit, 22}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{65, {TE::Reduce, 18}}, {66, {TE::Reduce, 18}}, {67, {TE::Reduce, 18}}, {90, {TE::Reduce, 18}}, {91, {TE::Reduce, 18}}, {93, {TE::Reduce, 18}}},
-    Row {{11, {TE::Transit, 21}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{53, {TE::Reduce, 33}}, {55, {TE::Reduce, 33}}, {83, {TE::Reduce, 33}}},
-    Row {{53, {TE::Reduce, 29}}, {55, {TE::Reduce, 29}}, {61, {TE::Reduce, 29}}, {62, {TE::Reduce, 29}}, {63, {TE::Reduce, 29}}, {64, {TE::Reduce, 29}}, {68, {TE::Reduce, 29}}, {70, {TE::Reduce, 29}}, {71, {TE::Reduce, 29}}, {72, {TE::Reduce, 29}}, {76, {TE::Reduce, 29}}, {82, {TE::Reduce, 29}}, {83, {TE::Reduce, 29}}, {84, {TE::Reduce, 29}}, {87, {TE::Reduce, 29}}, {88, {TE::Reduce, 29}}, {92, {TE::Reduce, 29}}},
-    Row {{53, {TE::Shift, 28}}, {82, {TE::Shift, 29}}},
-    Row {{53, {TE::Reduce, 41}}, {82, {TE::Reduce, 41}}},
-    Row {{53, {TE::Reduce, 38}}, {82, {TE::Reduce, 38}}, {84, {TE::Shift, 31}}},
-    Row {{55, {TE::Shift, 20}}, {83, {TE::Shift, 33}}},
-    Row {{53, {TE::Reduce, 34}}, {55, {TE::Reduce, 32}}, {70, {TE::Reduce, 34}}, {72, {TE::Reduce, 34}}, {76, {TE::Reduce, 34}}, {82, {TE::Reduce, 34}}, {83, {TE::Reduce, 32}}, {84, {TE::Reduce, 34}}, {87, {TE::Reduce, 34}}, {92, {TE::Reduce, 34}}},
-    Row {{65, {TE::Reduce, 19}}, {66, {TE::Reduce, 19}}, {67, {TE::Reduce, 19}}, {90, {TE::Reduce, 19}}, {91, {TE::Reduce, 19}}, {93, {TE::Reduce, 19}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 26}}, {14, {TE::Transit, 25}}, {16, {TE::Transit, 30}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{53, {TE::Reduce, 42}}, {82, {TE::Reduce, 42}}},
-    Row {{11, {TE::Transit, 32}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{53, {TE::Reduce, 39}}, {82, {TE::Reduce, 39}}},
-    Row {{11, {TE::Transit, 35}}, {54, {TE::Shift, 17}}, {71, {TE::Shift, 34}}, {81, {TE::Shift, 18}}},
-    Row {{11, {TE::Transit, 38}}, {18, {TE::Transit, 37}}, {19, {TE::Transit, 36}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{53, {TE::Reduce, 35}}, {70, {TE::Reduce, 35}}, {72, {TE::Reduce, 35}}, {76, {TE::Reduce, 35}}, {82, {TE::Reduce, 35}}, {84, {TE::Reduce, 35}}, {87, {TE::Reduce, 35}}, {92, {TE::Reduce, 35}}},
-    Row {{72, {TE::Shift, 39}}, {82, {TE::Shift, 40}}},
-    Row {{72, {TE::Reduce, 45}}, {82, {TE::Reduce, 45}}},
-    Row {{72, {TE::Reduce, 43}}, {82, {TE::Reduce, 43}}, {84, {TE::Shift, 42}}},
-    Row {{53, {TE::Reduce, 40}}, {82, {TE::Reduce, 40}}},
-    Row {{11, {TE::Transit, 38}}, {18, {TE::Transit, 41}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{72, {TE::Reduce, 46}}, {82, {TE::Reduce, 46}}},
-    Row {{11, {TE::Transit, 43}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{72, {TE::Reduce, 44}}, {82, {TE::Reduce, 44}}},
-    Row {{68, {TE::Shift, 45}}},
-    Row {{69, {TE::Shift, 46}}, {73, {TE::Shift, 47}}, {74, {TE::Shift, 48}}, {75, {TE::Shift, 49}}, {78, {TE::Shift, 50}}, {79, {TE::Shift, 51}}, {80, {TE::Shift, 52}}},
-    Row {{20, {TE::Transit, 53}}, {70, {TE::Reduce, 47}}, {71, {TE::Shift, 54}}},
-    Row {{20, {TE::Transit, 81}}, {70, {TE::Reduce, 47}}, {71, {TE::Shift, 54}}},
-    Row {{20, {TE::Transit, 90}}, {70, {TE::Reduce, 47}}, {71, {TE::Shift, 54}}},
-    Row {{21, {TE::Transit, 162}}, {70, {TE::Reduce, 50}}, {71, {TE::Shift, 163}}, {76, {TE::Reduce, 50}}},
-    Row {{20, {TE::Transit, 219}}, {71, {TE::Shift, 54}}, {76, {TE::Reduce, 47}}},
-    Row {{20, {TE::Transit, 223}}, {71, {TE::Shift, 54}}, {76, {TE::Reduce, 47}}},
-    Row {{20, {TE::Transit, 227}}, {71, {TE::Shift, 54}}, {76, {TE::Reduce, 47}}},
-    Row {{70, {TE::Shift, 55}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 77}}, {15, {TE::Transit, 76}}, {54, {TE::Shift, 17}}, {72, {TE::Shift, 75}}, {81, {TE::Shift, 18}}},
-    Row {{71, {TE::Shift, 56}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 62}}, {28, {TE::Transit, 58}}, {29, {TE::Transit, 59}}, {30, {TE::Transit, 60}}, {31, {TE::Transit, 57}}, {54, {TE::Shift, 17}}, {56, {TE::Shift, 64}}, {75, {TE::Shift, 61}}, {81, {TE::Shift, 18}}, {86, {TE::Shift, 63}}},
-    Row {{72, {TE::Shift, 66}}, {82, {TE::Shift, 67}}},
-    Row {{72, {TE::Reduce, 75}}, {82, {TE::Reduce, 75}}},
-    Row {{53, {TE::Reduce, 68}}, {70, {TE::Reduce, 68}}, {72, {TE::Reduce, 68}}, {76, {TE::Reduce, 68}}, {82, {TE::Reduce, 68}}, {87, {TE::Reduce, 68}}, {92, {TE::Reduce, 68}}},
-    Row {{53, {TE::Reduce, 69}}, {70, {TE::Reduce, 69}}, {71, {TE::Shift, 70}}, {72, {TE::Reduce, 69}}, {76, {TE::Reduce, 69}}, {82, {TE::Reduce, 69}}, {87, {TE::Reduce, 69}}, {92, {TE::Reduce, 69}}},
-    Row {{53, {TE::Reduce, 70}}, {70, {TE::Reduce, 70}}, {72, {TE::Reduce, 70}}, {76, {TE::Reduce, 70}}, {82, {TE::Reduce, 70}}, {87, {TE::Reduce, 70}}, {92, {TE::Reduce, 70}}},
-    Row {{53, {TE::Reduce, 71}}, {70, {TE::Reduce, 71}}, {72, {TE::Reduce, 71}}, {76, {TE::Reduce, 71}}, {82, {TE::Reduce, 71}}, {87, {TE::Reduce, 71}}, {92, {TE::Reduce, 71}}},
-    Row {{53, {TE::Reduce, 72}}, {70, {TE::Reduce, 72}}, {72, {TE::Reduce, 72}}, {76, {TE::Reduce, 72}}, {82, {TE::Reduce, 72}}, {87, {TE::Reduce, 72}}, {92, {TE::Reduce, 72}}},
-    Row {{53, {TE::Reduce, 73}}, {70, {TE::Reduce, 73}}, {71, {TE::Reduce, 73}}, {72, {TE::Reduce, 73}}, {76, {TE::Reduce, 73}}, {82, {TE::Reduce, 73}}, {87, {TE::Reduce, 73}}, {92, {TE::Reduce, 73}}},
-    Row {{55, {TE::Shift, 20}}, {83, {TE::Shift, 74}}},
-    Row {{53, {TE::Shift, 68}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 62}}, {28, {TE::Transit, 69}}, {29, {TE::Transit, 59}}, {30, {TE::Transit, 60}}, {54, {TE::Shift, 17}}, {56, {TE::Shift, 64}}, {75, {TE::Shift, 61}}, {81, {TE::Shift, 18}}, {86, {TE::Shift, 63}}},
-    Row {{65, {TE::Reduce, 20}}, {66, {TE::Reduce, 20}}, {67, {TE::Reduce, 20}}, {90, {TE::Reduce, 20}}, {91, {TE::Reduce, 20}}, {93, {TE::Reduce, 20}}},
-    Row {{72, {TE::Reduce, 76}}, {82, {TE::Reduce, 76}}},
-    Row {{38, {TE::Transit, 71}}, {58, {TE::Shift, 72}}, {72, {TE::Reduce, 99}}},
-    Row {{72, {TE::Shift, 73}}},
-    Row {{72, {TE::Reduce, 100}}},
-    Row {{53, {TE::Reduce, 74}}, {70, {TE::Reduce, 74}}, {71, {TE::Reduce, 74}}, {72, {TE::Reduce, 74}}, {76, {TE::Reduce, 74}}, {82, {TE::Reduce, 74}}, {87, {TE::Reduce, 74}}, {92, {TE::Reduce, 74}}},
-    Row {{11, {TE::Transit, 35}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{70, {TE::Reduce, 48}}, {76, {TE::Reduce, 48}}},
-    Row {{72, {TE::Shift, 78}}, {82, {TE::Shift, 79}}},
-    Row {{72, {TE::Reduce, 36}}, {82, {TE::Reduce, 36}}},
-    Row {{70, {TE::Reduce, 49}}, {76, {TE::Reduce, 49}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 80}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{72, {TE::Reduce, 37}}, {82, {TE::Reduce, 37}}},
-    Row {{70, {TE::Shift, 82}}},
-    Row {{71, {TE::Shift, 83}}},
-    Row {{11, {TE::Transit, 85}}, {12, {TE::Transit, 84}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{72, {TE::Shift, 86}}, {82, {TE::Shift, 87}}},
-    Row {{72, {TE::Reduce, 30}}, {82, {TE::Reduce, 30}}},
-    Row {{53, {TE::Shift, 88}}},
-    Row {{11, {TE::Transit, 89}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{65, {TE::Reduce, 21}}, {66, {TE::Reduce, 21}}, {67, {TE::Reduce, 21}}, {90, {TE::Reduce, 21}}, {91, {TE::Reduce, 21}}, {93, {TE::Reduce, 21}}},
-    Row {{72, {TE::Reduce, 31}}, {82, {TE::Reduce, 31}}},
-    Row {{70, {TE::Shift, 91}}},
-    Row {{71, {TE::Shift, 92}}},
-    Row {{11, {TE::Transit, 95}}, {48, {TE::Transit, 94}}, {49, {TE::Transit, 93}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{72, {TE::Shift, 96}}, {82, {TE::Shift, 97}}},
-    Row {{72, {TE::Reduce, 123}}, {82, {TE::Reduce, 123}}},
-    Row {{68, {TE::Shift, 100}}, {72, {TE::Reduce, 119}}, {82, {TE::Reduce, 119}}, {92, {TE::Shift, 101}}},
-    Row {{53, {TE::Shift, 98}}},
-    Row {{11, {TE::Transit, 95}}, {48, {TE::Transit, 99}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{65, {TE::Reduce, 22}}, {66, {TE::Reduce, 22}}, {67, {TE::Reduce, 22}}, {90, {TE::Reduce, 22}}, {91, {TE::Reduce, 22}}, {93, {TE::Reduce, 22}}},
-    Row {{72, {TE::Reduce, 124}}, {82, {TE::Reduce, 124}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 62}}, {28, {TE::Transit, 103}}, {29, {TE::Transit, 59}}, {30, {TE::Transit, 60}}, {40, {TE::Transit, 102}}, {54, {TE::Shift, 17}}, {56, {TE::Shift, 64}}, {71, {TE::Shift, 104}}, {72, {TE::Reduce, 103}}, {75, {TE::Shift, 61}}, {81, {TE::Shift, 18}}, {82, {TE::Reduce, 103}}, {86, {TE::Shift, 63}}, {87, {TE::Reduce, 103}}, {92, {TE::Reduce, 103}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 161}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{72, {TE::Reduce, 120}}, {82, {TE::Reduce, 120}}, {87, {TE::Shift, 106}}, {92, {TE::Shift, 105}}},
-    Row {{53, {TE::Reduce, 104}}, {70, {TE::Reduce, 104}}, {72, {TE::Reduce, 104}}, {76, {TE::Reduce, 104}}, {82, {TE::Reduce, 104}}, {87, {TE::Reduce, 104}}, {92, {TE::Reduce, 104}}},
-    Row {{38, {TE::Transit, 155}}, {58, {TE::Shift, 72}}, {72, {TE::Reduce, 99}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 107}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{39, {TE::Transit, 152}}, {58, {TE::Shift, 153}}, {88, {TE::Reduce, 101}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 122}}, {82, {TE::Reduce, 122}}},
-    Row {{53, {TE::Reduce, 88}}, {61, {TE::Reduce, 88}}, {62, {TE::Reduce, 88}}, {63, {TE::Reduce, 88}}, {64, {TE::Reduce, 88}}, {72, {TE::Reduce, 88}}, {82, {TE::Reduce, 88}}, {83, {TE::Shift, 128}}, {87, {TE::Shift, 127}}, {88, {TE::Reduce, 88}}},
-    Row {{11, {TE::Transit, 133}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 131}}, {46, {TE::Transit, 134}}, {47, {TE::Transit, 132}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{53, {TE::Reduce, 83}}, {61, {TE::Reduce, 83}}, {62, {TE::Reduce, 83}}, {63, {TE::Reduce, 83}}, {64, {TE::Reduce, 83}}, {72, {TE::Reduce, 83}}, {82, {TE::Reduce, 83}}, {83, {TE::Reduce, 83}}, {87, {TE::Reduce, 83}}, {88, {TE::Reduce, 83}}},
-    Row {{53, {TE::Reduce, 84}}, {61, {TE::Reduce, 84}}, {62, {TE::Reduce, 84}}, {63, {TE::Reduce, 84}}, {64, {TE::Reduce, 84}}, {72, {TE::Reduce, 84}}, {82, {TE::Reduce, 84}}, {83, {TE::Reduce, 84}}, {87, {TE::Reduce, 84}}, {88, {TE::Reduce, 84}}},
-    Row {{53, {TE::Reduce, 77}}, {61, {TE::Reduce, 77}}, {62, {TE::Reduce, 77}}, {63, {TE::Reduce, 77}}, {64, {TE::Reduce, 77}}, {72, {TE::Reduce, 77}}, {82, {TE::Reduce, 77}}, {83, {TE::Reduce, 77}}, {87, {TE::Reduce, 77}}, {88, {TE::Reduce, 77}}},
-    Row {{53, {TE::Reduce, 78}}, {61, {TE::Reduce, 78}}, {62, {TE::Reduce, 78}}, {63, {TE::Reduce, 78}}, {64, {TE::Reduce, 78}}, {72, {TE::Reduce, 78}}, {82, {TE::Reduce, 78}}, {83, {TE::Reduce, 78}}, {87, {TE::Reduce, 78}}, {88, {TE::Reduce, 78}}},
-    Row {{53, {TE::Reduce, 79}}, {61, {TE::Reduce, 79}}, {62, {TE::Reduce, 79}}, {63, {TE::Reduce, 79}}, {64, {TE::Reduce, 79}}, {72, {TE::Reduce, 79}}, {82, {TE::Reduce, 79}}, {83, {TE::Reduce, 79}}, {87, {TE::Reduce, 79}}, {88, {TE::Reduce, 79}}},
-    Row {{53, {TE::Reduce, 80}}, {61, {TE::Reduce, 80}}, {62, {TE::Reduce, 80}}, {63, {TE::Reduce, 80}}, {64, {TE::Reduce, 80}}, {72, {TE::Reduce, 80}}, {82, {TE::Reduce, 80}}, {83, {TE::Reduce, 80}}, {87, {TE::Reduce, 80}}, {88, {TE::Reduce, 80}}},
-    Row {{53, {TE::Reduce, 81}}, {61, {TE::Reduce, 81}}, {62, {TE::Reduce, 81}}, {63, {TE::Reduce, 81}}, {64, {TE::Reduce, 81}}, {72, {TE::Reduce, 81}}, {82, {TE::Reduce, 81}}, {83, {TE::Reduce, 81}}, {87, {TE::Reduce, 81}}, {88, {TE::Reduce, 81}}},
-    Row {{53, {TE::Reduce, 82}}, {61, {TE::Reduce, 82}}, {62, {TE::Reduce, 82}}, {63, {TE::Reduce, 82}}, {64, {TE::Reduce, 82}}, {72, {TE::Reduce, 82}}, {82, {TE::Reduce, 82}}, {83, {TE::Reduce, 82}}, {87, {TE::Reduce, 82}}, {88, {TE::Reduce, 82}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 145}}, {35, {TE::Transit, 144}}, {36, {TE::Transit, 143}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}, {88, {TE::Reduce, 96}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 123}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 124}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 125}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 126}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{53, {TE::Reduce, 89}}, {61, {TE::Reduce, 89}}, {62, {TE::Reduce, 89}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 89}}, {82, {TE::Reduce, 89}}, {88, {TE::Reduce, 89}}},
-    Row {{53, {TE::Reduce, 90}}, {61, {TE::Reduce, 90}}, {62, {TE::Reduce, 90}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 90}}, {82, {TE::Reduce, 90}}, {88, {TE::Reduce, 90}}},
-    Row {{53, {TE::Reduce, 91}}, {61, {TE::Reduce, 91}}, {62, {TE::Reduce, 91}}, {63, {TE::Reduce, 91}}, {64, {TE::Reduce, 91}}, {72, {TE::Reduce, 91}}, {82, {TE::Reduce, 91}}, {88, {TE::Reduce, 91}}},
-    Row {{53, {TE::Reduce, 92}}, {61, {TE::Reduce, 92}}, {62, {TE::Reduce, 92}}, {63, {TE::Reduce, 92}}, {64, {TE::Reduce, 92}}, {72, {TE::Reduce, 92}}, {82, {TE::Reduce, 92}}, {88, {TE::Reduce, 92}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 129}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{11, {TE::Transit, 157}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {88, {TE::Shift, 130}}},
-    Row {{53, {TE::Reduce, 85}}, {61, {TE::Reduce, 85}}, {62, {TE::Reduce, 85}}, {63, {TE::Reduce, 85}}, {64, {TE::Reduce, 85}}, {72, {TE::Reduce, 85}}, {82, {TE::Reduce, 85}}, {83, {TE::Reduce, 85}}, {87, {TE::Reduce, 85}}, {88, {TE::Reduce, 85}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Shift, 135}}},
-    Row {{72, {TE::Shift, 136}}, {82, {TE::Shift, 137}}},
-    Row {{61, {TE::Reduce, 84}}, {62, {TE::Reduce, 84}}, {63, {TE::Reduce, 84}}, {64, {TE::Reduce, 84}}, {68, {TE::Shift, 141}}, {70, {TE::Shift, 140}}, {72, {TE::Reduce, 84}}, {83, {TE::Reduce, 84}}, {87, {TE::Reduce, 84}}},
-    Row {{72, {TE::Reduce, 117}}, {82, {TE::Reduce, 117}}},
-    Row {{53, {TE::Reduce, 93}}, {61, {TE::Reduce, 93}}, {62, {TE::Reduce, 93}}, {63, {TE::Reduce, 93}}, {64, {TE::Reduce, 93}}, {72, {TE::Reduce, 93}}, {82, {TE::Reduce, 93}}, {88, {TE::Reduce, 93}}},
-    Row {{53, {TE::Reduce, 126}}, {61, {TE::Reduce, 126}}, {62, {TE::Reduce, 126}}, {63, {TE::Reduce, 126}}, {64, {TE::Reduce, 126}}, {72, {TE::Reduce, 126}}, {82, {TE::Reduce, 126}}, {83, {TE::Reduce, 126}}, {87, {TE::Reduce, 126}}, {88, {TE::Reduce, 126}}},
-    Row {{11, {TE::Transit, 139}}, {46, {TE::Transit, 138}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{72, {TE::Reduce, 118}}, {82, {TE::Reduce, 118}}},
-    Row {{68, {TE::Shift, 141}}, {70, {TE::Shift, 140}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 142}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 62}}, {28, {TE::Transit, 103}}, {29, {TE::Transit, 59}}, {30, {TE::Transit, 60}}, {40, {TE::Transit, 149}}, {54, {TE::Shift, 17}}, {56, {TE::Shift, 64}}, {70, {TE::Reduce, 103}}, {71, {TE::Shift, 104}}, {75, {TE::Shift, 61}}, {81, {TE::Shift, 18}}, {86, {TE::Shift, 63}}, {87, {TE::Reduce, 103}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 115}}, {82, {TE::Reduce, 115}}},
-    Row {{88, {TE::Shift, 146}}},
-    Row {{72, {TE::Reduce, 97}}, {82, {TE::Shift, 147}}, {88, {TE::Reduce, 97}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 94}}, {82, {TE::Reduce, 94}}, {88, {TE::Reduce, 94}}},
-    Row {{53, {TE::Reduce, 125}}, {61, {TE::Reduce, 125}}, {62, {TE::Reduce, 125}}, {63, {TE::Reduce, 125}}, {64, {TE::Reduce, 125}}, {72, {TE::Reduce, 125}}, {82, {TE::Reduce, 125}}, {83, {TE::Reduce, 125}}, {87, {TE::Reduce, 125}}, {88, {TE::Reduce, 125}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 148}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 95}}, {82, {TE::Reduce, 95}}, {88, {TE::Reduce, 95}}},
-    Row {{70, {TE::Shift, 150}}, {87, {TE::Shift, 106}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 151}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 116}}, {82, {TE::Reduce, 116}}},
-    Row {{88, {TE::Shift, 154}}},
-    Row {{88, {TE::Reduce, 102}}},
-    Row {{53, {TE::Reduce, 106}}, {70, {TE::Reduce, 106}}, {72, {TE::Reduce, 106}}, {76, {TE::Reduce, 106}}, {82, {TE::Reduce, 106}}, {87, {TE::Reduce, 106}}, {92, {TE::Reduce, 106}}},
-    Row {{72, {TE::Shift, 156}}},
-    Row {{53, {TE::Reduce, 105}}, {70, {TE::Reduce, 105}}, {72, {TE::Reduce, 105}}, {76, {TE::Reduce, 105}}, {82, {TE::Reduce, 105}}, {87, {TE::Reduce, 105}}, {92, {TE::Reduce, 105}}},
-    Row {{53, {TE::Reduce, 86}}, {61, {TE::Reduce, 86}}, {62, {TE::Reduce, 86}}, {63, {TE::Reduce, 86}}, {64, {TE::Reduce, 86}}, {71, {TE::Shift, 158}}, {72, {TE::Reduce, 86}}, {82, {TE::Reduce, 86}}, {83, {TE::Reduce, 86}}, {87, {TE::Reduce, 86}}, {88, {TE::Reduce, 86}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 145}}, {35, {TE::Transit, 144}}, {36, {TE::Transit, 159}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {72, {TE::Reduce, 96}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{72, {TE::Shift, 160}}},
-    Row {{53, {TE::Reduce, 87}}, {61, {TE::Reduce, 87}}, {62, {TE::Reduce, 87}}, {63, {TE::Reduce, 87}}, {64, {TE::Reduce, 87}}, {72, {TE::Reduce, 87}}, {82, {TE::Reduce, 87}}, {83, {TE::Reduce, 87}}, {87, {TE::Reduce, 87}}, {88, {TE::Reduce, 87}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 121}}, {82, {TE::Reduce, 121}}},
-    Row {{70, {TE::Shift, 164}}, {76, {TE::Shift, 165}}},
-    Row {{11, {TE::Transit, 185}}, {23, {TE::Transit, 184}}, {24, {TE::Transit, 212}}, {25, {TE::Transit, 213}}, {26, {TE::Transit, 211}}, {27, {TE::Transit, 210}}, {54, {TE::Shift, 17}}, {72, {TE::Reduce, 66}}, {81, {TE::Shift, 18}}, {85, {TE::Shift, 186}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 166}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{2, {TE::Transit, 168}}, {54, {TE::Reduce, 8}}, {77, {TE::Reduce, 8}}, {81, {TE::Reduce, 8}}, {89, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {91, {TE::Reduce, 8}}},
-    Row {{53, {TE::Shift, 167}}, {61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}},
-    Row {{65, {TE::Reduce, 23}}, {66, {TE::Reduce, 23}}, {67, {TE::Reduce, 23}}, {90, {TE::Reduce, 23}}, {91, {TE::Reduce, 23}}, {93, {TE::Reduce, 23}}},
-    Row {{3, {TE::Transit, 170}}, {4, {TE::Transit, 171}}, {5, {TE::Transit, 172}}, {6, {TE::Transit, 173}}, {7, {TE::Transit, 174}}, {11, {TE::Transit, 178}}, {37, {TE::Transit, 179}}, {41, {TE::Transit, 11}}, {42, {TE::Transit, 13}}, {43, {TE::Transit, 177}}, {44, {TE::Transit, 176}}, {45, {TE::Transit, 175}}, {54, {TE::Shift, 17}}, {77, {TE::Shift, 169}}, {81, {TE::Shift, 18}}, {89, {TE::Shift, 180}}, {90, {TE::Shift, 12}}, {91, {TE::Shift, 14}}},
-    Row {{65, {TE::Reduce, 24}}, {66, {TE::Reduce, 24}}, {67, {TE::Reduce, 24}}, {90, {TE::Reduce, 24}}, {91, {TE::Reduce, 24}}, {93, {TE::Reduce, 24}}},
-    Row {{54, {TE::Reduce, 9}}, {77, {TE::Reduce, 9}}, {81, {TE::Reduce, 9}}, {89, {TE::Reduce, 9}}, {90, {TE::Reduce, 9}}, {91, {TE::Reduce, 9}}},
-    Row {{54, {TE::Reduce, 10}}, {77, {TE::Reduce, 10}}, {81, {TE::Reduce, 10}}, {89, {TE::Reduce, 10}}, {90, {TE::Reduce, 10}}, {91, {TE::Reduce, 10}}},
-    Row {{54, {TE::Reduce, 11}}, {77, {TE::Reduce, 11}}, {81, {TE::Reduce, 11}}, {89, {TE::Reduce, 11}}, {90, {TE::Reduce, 11}}, {91, {TE::Reduce, 11}}},
-    Row {{54, {TE::Reduce, 12}}, {77, {TE::Reduce, 12}}, {81, {TE::Reduce, 12}}, {89, {TE::Reduce, 12}}, {90, {TE::Reduce, 12}}, {91, {TE::Reduce, 12}}},
-    Row {{54, {TE::Reduce, 13}}, {77, {TE::Reduce, 13}}, {81, {TE::Reduce, 13}}, {89, {TE::Reduce, 13}}, {90, {TE::Reduce, 13}}, {91, {TE::Reduce, 13}}},
-    Row {{53, {TE::Shift, 198}}},
-    Row {{70, {TE::Shift, 199}}, {82, {TE::Shift, 200}}},
-    Row {{70, {TE::Reduce, 112}}, {82, {TE::Reduce, 112}}, {83, {TE::Shift, 204}}, {87, {TE::Shift, 203}}},
-    Row {{70, {TE::Reduce, 109}}, {82, {TE::Reduce, 109}}, {83, {TE::Reduce, 109}}, {87, {TE::Reduce, 109}}},
-    Row {{53, {TE::Shift, 208}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 209}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{54, {TE::Reduce, 14}}, {65, {TE::Reduce, 14}}, {66, {TE::Reduce, 14}}, {67, {TE::Reduce, 14}}, {77, {TE::Reduce, 14}}, {81, {TE::Reduce, 14}}, {89, {TE::Reduce, 14}}, {90, {TE::Reduce, 14}}, {91, {TE::Reduce, 14}}, {93, {TE::Reduce, 14}}},
-    Row {{53, {TE::Reduce, 107}}, {82, {TE::Shift, 187}}},
-    Row {{53, {TE::Reduce, 62}}, {82, {TE::Reduce, 62}}},
-    Row {{53, {TE::Reduce, 60}}, {70, {TE::Shift, 189}}, {72, {TE::Reduce, 60}}, {82, {TE::Reduce, 60}}},
-    Row {{53, {TE::Reduce, 56}}, {68, {TE::Shift, 191}}, {70, {TE::Reduce, 56}}, {72, {TE::Reduce, 56}}, {82, {TE::Reduce, 56}}},
-    Row {{11, {TE::Transit, 193}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{11, {TE::Transit, 185}}, {23, {TE::Transit, 184}}, {24, {TE::Transit, 188}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}, {85, {TE::Shift, 186}}},
-    Row {{53, {TE::Reduce, 63}}, {82, {TE::Reduce, 63}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 190}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{53, {TE::Reduce, 61}}, {61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {72, {TE::Reduce, 61}}, {82, {TE::Reduce, 61}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 62}}, {28, {TE::Transit, 103}}, {29, {TE::Transit, 59}}, {30, {TE::Transit, 60}}, {40, {TE::Transit, 192}}, {53, {TE::Reduce, 103}}, {54, {TE::Shift, 17}}, {56, {TE::Shift, 64}}, {70, {TE::Reduce, 103}}, {71, {TE::Shift, 104}}, {72, {TE::Reduce, 103}}, {75, {TE::Shift, 61}}, {81, {TE::Shift, 18}}, {82, {TE::Reduce, 103}}, {86, {TE::Shift, 63}}, {87, {TE::Reduce, 103}}},
-    Row {{53, {TE::Reduce, 58}}, {70, {TE::Reduce, 58}}, {72, {TE::Reduce, 58}}, {82, {TE::Reduce, 58}}, {87, {TE::Shift, 106}}},
-    Row {{53, {TE::Reduce, 57}}, {68, {TE::Shift, 194}}, {70, {TE::Reduce, 57}}, {72, {TE::Reduce, 57}}, {82, {TE::Reduce, 57}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 62}}, {28, {TE::Transit, 103}}, {29, {TE::Transit, 59}}, {30, {TE::Transit, 60}}, {40, {TE::Transit, 195}}, {53, {TE::Reduce, 103}}, {54, {TE::Shift, 17}}, {56, {TE::Shift, 64}}, {70, {TE::Reduce, 103}}, {71, {TE::Shift, 104}}, {72, {TE::Reduce, 103}}, {75, {TE::Shift, 61}}, {81, {TE::Shift, 18}}, {82, {TE::Reduce, 103}}, {86, {TE::Shift, 63}}, {87, {TE::Reduce, 103}}},
-    Row {{53, {TE::Reduce, 59}}, {70, {TE::Reduce, 59}}, {72, {TE::Reduce, 59}}, {82, {TE::Reduce, 59}}, {87, {TE::Shift, 106}}},
-    Row {{54, {TE::Reduce, 15}}, {65, {TE::Reduce, 15}}, {66, {TE::Reduce, 15}}, {67, {TE::Reduce, 15}}, {77, {TE::Reduce, 15}}, {81, {TE::Reduce, 15}}, {89, {TE::Reduce, 15}}, {90, {TE::Reduce, 15}}, {91, {TE::Reduce, 15}}, {93, {TE::Reduce, 15}}},
-    Row {{53, {TE::Reduce, 108}}, {82, {TE::Shift, 187}}},
-    Row {{54, {TE::Reduce, 16}}, {77, {TE::Reduce, 16}}, {81, {TE::Reduce, 16}}, {89, {TE::Reduce, 16}}, {90, {TE::Reduce, 16}}, {91, {TE::Reduce, 16}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 201}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{11, {TE::Transit, 178}}, {43, {TE::Transit, 202}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{53, {TE::Reduce, 114}}, {61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}},
-    Row {{70, {TE::Reduce, 113}}, {82, {TE::Reduce, 113}}, {83, {TE::Shift, 204}}, {87, {TE::Shift, 203}}},
-    Row {{11, {TE::Transit, 111}}, {32, {TE::Transit, 110}}, {33, {TE::Transit, 108}}, {34, {TE::Transit, 205}}, {50, {TE::Transit, 116}}, {51, {TE::Transit, 117}}, {54, {TE::Shift, 17}}, {57, {TE::Shift, 112}}, {58, {TE::Shift, 113}}, {59, {TE::Shift, 114}}, {60, {TE::Shift, 115}}, {71, {TE::Shift, 109}}, {81, {TE::Shift, 18}}, {87, {TE::Shift, 118}}},
-    Row {{11, {TE::Transit, 207}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}},
-    Row {{61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}, {88, {TE::Shift, 206}}},
-    Row {{70, {TE::Reduce, 110}}, {82, {TE::Reduce, 110}}, {83, {TE::Reduce, 110}}, {87, {TE::Reduce, 110}}},
-    Row {{70, {TE::Reduce, 111}}, {82, {TE::Reduce, 111}}, {83, {TE::Reduce, 111}}, {87, {TE::Reduce, 111}}},
-    Row {{54, {TE::Reduce, 17}}, {77, {TE::Reduce, 17}}, {81, {TE::Reduce, 17}}, {89, {TE::Reduce, 17}}, {90, {TE::Reduce, 17}}, {91, {TE::Reduce, 17}}},
-    Row {{53, {TE::Reduce, 98}}, {61, {TE::Shift, 119}}, {62, {TE::Shift, 120}}, {63, {TE::Shift, 121}}, {64, {TE::Shift, 122}}},
-    Row {{72, {TE::Shift, 214}}},
-    Row {{72, {TE::Reduce, 67}}},
-    Row {{53, {TE::Reduce, 62}}, {72, {TE::Reduce, 64}}, {82, {TE::Reduce, 62}}},
-    Row {{53, {TE::Shift, 217}}, {82, {TE::Shift, 187}}},
-    Row {{68, {TE::Shift, 215}}, {70, {TE::Reduce, 51}}, {76, {TE::Reduce, 51}}},
-    Row {{11, {TE::Transit, 27}}, {13, {TE::Transit, 65}}, {14, {TE::Transit, 62}}, {28, {TE::Transit, 103}}, {29, {TE::Transit, 59}}, {30, {TE::Transit, 60}}, {40, {TE::Transit, 216}}, {54, {TE::Shift, 17}}, {56, {TE::Shift, 64}}, {70, {TE::Reduce, 103}}, {71, {TE::Shift, 104}}, {75, {TE::Shift, 61}}, {76, {TE::Reduce, 103}}, {81, {TE::Shift, 18}}, {86, {TE::Shift, 63}}, {87, {TE::Reduce, 103}}},
-    Row {{70, {TE::Reduce, 52}}, {76, {TE::Reduce, 52}}, {87, {TE::Shift, 106}}},
-    Row {{11, {TE::Transit, 185}}, {23, {TE::Transit, 184}}, {24, {TE::Transit, 218}}, {54, {TE::Shift, 17}}, {81, {TE::Shift, 18}}, {85, {TE::Shift, 186}}},
-    Row {{72, {TE::Reduce, 65}}},
-    Row {{76, {TE::Shift, 220}}},
-    Row {{2, {TE::Transit, 221}}, {54, {TE::Reduce, 8}}, {77, {TE::Reduce, 8}}, {81, {TE::Reduce, 8}}, {89, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {91, {TE::Reduce, 8}}},
-    Row {{3, {TE::Transit, 170}}, {4, {TE::Transit, 171}}, {5, {TE::Transit, 172}}, {6, {TE::Transit, 173}}, {7, {TE::Transit, 174}}, {11, {TE::Transit, 178}}, {37, {TE::Transit, 179}}, {41, {TE::Transit, 11}}, {42, {TE::Transit, 13}}, {43, {TE::Transit, 177}}, {44, {TE::Transit, 176}}, {45, {TE::Transit, 175}}, {54, {TE::Shift, 17}}, {77, {TE::Shift, 222}}, {81, {TE::Shift, 18}}, {89, {TE::Shift, 180}}, {90, {TE::Shift, 12}}, {91, {TE::Shift, 14}}},
-    Row {{65, {TE::Reduce, 25}}, {66, {TE::Reduce, 25}}, {67, {TE::Reduce, 25}}, {90, {TE::Reduce, 25}}, {91, {TE::Reduce, 25}}, {93, {TE::Reduce, 25}}},
-    Row {{76, {TE::Shift, 224}}},
-    Row {{2, {TE::Transit, 225}}, {54, {TE::Reduce, 8}}, {77, {TE::Reduce, 8}}, {81, {TE::Reduce, 8}}, {89, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {91, {TE::Reduce, 8}}},
-    Row {{3, {TE::Transit, 170}}, {4, {TE::Transit, 171}}, {5, {TE::Transit, 172}}, {6, {TE::Transit, 173}}, {7, {TE::Transit, 174}}, {11, {TE::Transit, 178}}, {37, {TE::Transit, 179}}, {41, {TE::Transit, 11}}, {42, {TE::Transit, 13}}, {43, {TE::Transit, 177}}, {44, {TE::Transit, 176}}, {45, {TE::Transit, 175}}, {54, {TE::Shift, 17}}, {77, {TE::Shift, 226}}, {81, {TE::Shift, 18}}, {89, {TE::Shift, 180}}, {90, {TE::Shift, 12}}, {91, {TE::Shift, 14}}},
-    Row {{65, {TE::Reduce, 26}}, {66, {TE::Reduce, 26}}, {67, {TE::Reduce, 26}}, {90, {TE::Reduce, 26}}, {91, {TE::Reduce, 26}}, {93, {TE::Reduce, 26}}},
-    Row {{76, {TE::Shift, 228}}},
-    Row {{2, {TE::Transit, 229}}, {54, {TE::Reduce, 8}}, {77, {TE::Reduce, 8}}, {81, {TE::Reduce, 8}}, {89, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {91, {TE::Reduce, 8}}},
-    Row {{3, {TE::Transit, 170}}, {4, {TE::Transit, 171}}, {5, {TE::Transit, 172}}, {6, {TE::Transit, 173}}, {7, {TE::Transit, 174}}, {11, {TE::Transit, 178}}, {37, {TE::Transit, 179}}, {41, {TE::Transit, 11}}, {42, {TE::Transit, 13}}, {43, {TE::Transit, 177}}, {44, {TE::Transit, 176}}, {45, {TE::Transit, 175}}, {54, {TE::Shift, 17}}, {77, {TE::Shift, 230}}, {81, {TE::Shift, 18}}, {89, {TE::Shift, 180}}, {90, {TE::Shift, 12}}, {91, {TE::Shift, 14}}},
-    Row {{65, {TE::Reduce, 27}}, {66, {TE::Reduce, 27}}, {67, {TE::Reduce, 27}}, {90, {TE::Reduce, 27}}, {91, {TE::Reduce, 27}}, {93, {TE::Reduce, 27}}}
+    Row {{0, {TE::Transit, 1}}, {74, {TE::Reduce, 1}}, {75, {TE::Reduce, 1}}, {76, {TE::Reduce, 1}}, {102, {TE::Reduce, 1}}, {103, {TE::Reduce, 1}}, {105, {TE::Reduce, 1}}},
+    Row {{1, {TE::Transit, 2}}, {4, {TE::Transit, 6}}, {5, {TE::Transit, 7}}, {9, {TE::Transit, 3}}, {10, {TE::Transit, 4}}, {11, {TE::Transit, 5}}, {48, {TE::Transit, 11}}, {49, {TE::Transit, 13}}, {74, {TE::Shift, 8}}, {75, {TE::Shift, 9}}, {76, {TE::Shift, 10}}, {102, {TE::Shift, 12}}, {103, {TE::Shift, 14}}, {105, {TE::Accept, 0}}},
+    Row {{74, {TE::Reduce, 2}}, {75, {TE::Reduce, 2}}, {76, {TE::Reduce, 2}}, {102, {TE::Reduce, 2}}, {103, {TE::Reduce, 2}}, {105, {TE::Reduce, 2}}},
+    Row {{74, {TE::Reduce, 3}}, {75, {TE::Reduce, 3}}, {76, {TE::Reduce, 3}}, {102, {TE::Reduce, 3}}, {103, {TE::Reduce, 3}}, {105, {TE::Reduce, 3}}},
+    Row {{74, {TE::Reduce, 4}}, {75, {TE::Reduce, 4}}, {76, {TE::Reduce, 4}}, {102, {TE::Reduce, 4}}, {103, {TE::Reduce, 4}}, {105, {TE::Reduce, 4}}},
+    Row {{74, {TE::Reduce, 5}}, {75, {TE::Reduce, 5}}, {76, {TE::Reduce, 5}}, {102, {TE::Reduce, 5}}, {103, {TE::Reduce, 5}}, {105, {TE::Reduce, 5}}},
+    Row {{74, {TE::Reduce, 6}}, {75, {TE::Reduce, 6}}, {76, {TE::Reduce, 6}}, {102, {TE::Reduce, 6}}, {103, {TE::Reduce, 6}}, {105, {TE::Reduce, 6}}},
+    Row {{74, {TE::Reduce, 7}}, {75, {TE::Reduce, 7}}, {76, {TE::Reduce, 7}}, {102, {TE::Reduce, 7}}, {103, {TE::Reduce, 7}}, {105, {TE::Reduce, 7}}},
+    Row {{12, {TE::Transit, 16}}, {14, {TE::Transit, 15}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 26}}, {15, {TE::Transit, 25}}, {17, {TE::Transit, 24}}, {18, {TE::Transit, 23}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{12, {TE::Transit, 44}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{60, {TE::Shift, 277}}},
+    Row {{12, {TE::Transit, 211}}, {29, {TE::Transit, 210}}, {30, {TE::Transit, 279}}, {31, {TE::Transit, 278}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}, {96, {TE::Shift, 212}}},
+    Row {{60, {TE::Shift, 282}}},
+    Row {{12, {TE::Transit, 211}}, {29, {TE::Transit, 210}}, {30, {TE::Transit, 279}}, {31, {TE::Transit, 283}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}, {96, {TE::Shift, 212}}},
+    Row {{60, {TE::Shift, 19}}, {62, {TE::Shift, 20}}},
+    Row {{60, {TE::Reduce, 34}}, {62, {TE::Reduce, 34}}},
+    Row {{60, {TE::Reduce, 30}}, {62, {TE::Reduce, 30}}, {63, {TE::Reduce, 30}}, {70, {TE::Reduce, 30}}, {71, {TE::Reduce, 30}}, {72, {TE::Reduce, 30}}, {73, {TE::Reduce, 30}}, {77, {TE::Reduce, 30}}, {79, {TE::Reduce, 30}}, {80, {TE::Reduce, 30}}, {81, {TE::Reduce, 30}}, {85, {TE::Reduce, 30}}, {91, {TE::Reduce, 30}}, {92, {TE::Reduce, 30}}, {93, {TE::Reduce, 30}}, {94, {TE::Reduce, 30}}, {95, {TE::Reduce, 30}}, {98, {TE::Reduce, 30}}, {99, {TE::Reduce, 30}}, {100, {TE::Reduce, 30}}, {104, {TE::Reduce, 30}}},
+    Row {{12, {TE::Transit, 22}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{74, {TE::Reduce, 20}}, {75, {TE::Reduce, 20}}, {76, {TE::Reduce, 20}}, {102, {TE::Reduce, 20}}, {103, {TE::Reduce, 20}}, {105, {TE::Reduce, 20}}},
+    Row {{12, {TE::Transit, 21}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{60, {TE::Reduce, 35}}, {62, {TE::Reduce, 35}}, {63, {TE::Reduce, 35}}},
+    Row {{60, {TE::Reduce, 31}}, {62, {TE::Reduce, 31}}, {63, {TE::Reduce, 31}}, {70, {TE::Reduce, 31}}, {71, {TE::Reduce, 31}}, {72, {TE::Reduce, 31}}, {73, {TE::Reduce, 31}}, {77, {TE::Reduce, 31}}, {79, {TE::Reduce, 31}}, {80, {TE::Reduce, 31}}, {81, {TE::Reduce, 31}}, {85, {TE::Reduce, 31}}, {91, {TE::Reduce, 31}}, {92, {TE::Reduce, 31}}, {93, {TE::Reduce, 31}}, {94, {TE::Reduce, 31}}, {95, {TE::Reduce, 31}}, {98, {TE::Reduce, 31}}, {99, {TE::Reduce, 31}}, {100, {TE::Reduce, 31}}, {104, {TE::Reduce, 31}}},
+    Row {{60, {TE::Shift, 28}}, {91, {TE::Shift, 29}}},
+    Row {{60, {TE::Reduce, 43}}, {91, {TE::Reduce, 43}}},
+    Row {{60, {TE::Reduce, 40}}, {91, {TE::Reduce, 40}}, {92, {TE::Shift, 31}}},
+    Row {{62, {TE::Shift, 20}}, {63, {TE::Shift, 33}}},
+    Row {{60, {TE::Reduce, 36}}, {62, {TE::Reduce, 34}}, {63, {TE::Reduce, 34}}, {70, {TE::Reduce, 36}}, {71, {TE::Reduce, 36}}, {72, {TE::Reduce, 36}}, {73, {TE::Reduce, 36}}, {77, {TE::Reduce, 36}}, {79, {TE::Reduce, 36}}, {81, {TE::Reduce, 36}}, {85, {TE::Reduce, 36}}, {91, {TE::Reduce, 36}}, {92, {TE::Reduce, 36}}, {93, {TE::Reduce, 36}}, {94, {TE::Reduce, 36}}, {99, {TE::Reduce, 36}}, {100, {TE::Reduce, 36}}, {104, {TE::Reduce, 36}}},
+    Row {{74, {TE::Reduce, 21}}, {75, {TE::Reduce, 21}}, {76, {TE::Reduce, 21}}, {102, {TE::Reduce, 21}}, {103, {TE::Reduce, 21}}, {105, {TE::Reduce, 21}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 26}}, {15, {TE::Transit, 25}}, {17, {TE::Transit, 30}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{60, {TE::Reduce, 44}}, {91, {TE::Reduce, 44}}},
+    Row {{12, {TE::Transit, 32}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{60, {TE::Reduce, 41}}, {91, {TE::Reduce, 41}}},
+    Row {{12, {TE::Transit, 35}}, {61, {TE::Shift, 17}}, {80, {TE::Shift, 34}}, {90, {TE::Shift, 18}}},
+    Row {{12, {TE::Transit, 38}}, {19, {TE::Transit, 37}}, {20, {TE::Transit, 36}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{60, {TE::Reduce, 37}}, {70, {TE::Reduce, 37}}, {71, {TE::Reduce, 37}}, {72, {TE::Reduce, 37}}, {73, {TE::Reduce, 37}}, {77, {TE::Reduce, 37}}, {79, {TE::Reduce, 37}}, {81, {TE::Reduce, 37}}, {85, {TE::Reduce, 37}}, {91, {TE::Reduce, 37}}, {92, {TE::Reduce, 37}}, {93, {TE::Reduce, 37}}, {94, {TE::Reduce, 37}}, {99, {TE::Reduce, 37}}, {100, {TE::Reduce, 37}}, {104, {TE::Reduce, 37}}},
+    Row {{81, {TE::Shift, 39}}, {91, {TE::Shift, 40}}},
+    Row {{81, {TE::Reduce, 47}}, {91, {TE::Reduce, 47}}},
+    Row {{81, {TE::Reduce, 45}}, {91, {TE::Reduce, 45}}, {92, {TE::Shift, 42}}},
+    Row {{60, {TE::Reduce, 42}}, {91, {TE::Reduce, 42}}},
+    Row {{12, {TE::Transit, 38}}, {19, {TE::Transit, 41}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{81, {TE::Reduce, 48}}, {91, {TE::Reduce, 48}}},
+    Row {{12, {TE::Transit, 43}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{81, {TE::Reduce, 46}}, {91, {TE::Reduce, 46}}},
+    Row {{77, {TE::Shift, 45}}},
+    Row {{78, {TE::Shift, 46}}, {82, {TE::Shift, 47}}, {83, {TE::Shift, 48}}, {84, {TE::Shift, 49}}, {87, {TE::Shift, 50}}, {88, {TE::Shift, 51}}, {89, {TE::Shift, 52}}},
+    Row {{21, {TE::Transit, 53}}, {79, {TE::Reduce, 49}}, {80, {TE::Shift, 54}}},
+    Row {{21, {TE::Transit, 89}}, {79, {TE::Reduce, 49}}, {80, {TE::Shift, 54}}},
+    Row {{21, {TE::Transit, 98}}, {79, {TE::Reduce, 49}}, {80, {TE::Shift, 54}}},
+    Row {{27, {TE::Transit, 246}}, {79, {TE::Reduce, 62}}, {80, {TE::Shift, 175}}, {85, {TE::Reduce, 62}}},
+    Row {{24, {TE::Transit, 253}}, {80, {TE::Reduce, 56}}, {85, {TE::Reduce, 56}}, {93, {TE::Shift, 254}}},
+    Row {{24, {TE::Transit, 267}}, {80, {TE::Reduce, 56}}, {85, {TE::Reduce, 56}}, {93, {TE::Shift, 254}}},
+    Row {{24, {TE::Transit, 272}}, {80, {TE::Reduce, 56}}, {85, {TE::Reduce, 56}}, {93, {TE::Shift, 254}}},
+    Row {{79, {TE::Shift, 55}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 82}}, {22, {TE::Transit, 81}}, {23, {TE::Transit, 80}}, {61, {TE::Shift, 17}}, {81, {TE::Shift, 79}}, {90, {TE::Shift, 18}}},
+    Row {{80, {TE::Shift, 56}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 58}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {38, {TE::Transit, 57}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}},
+    Row {{81, {TE::Shift, 66}}, {91, {TE::Shift, 67}}},
+    Row {{81, {TE::Reduce, 93}}, {91, {TE::Reduce, 93}}, {94, {TE::Reduce, 93}}},
+    Row {{60, {TE::Reduce, 85}}, {70, {TE::Reduce, 85}}, {71, {TE::Reduce, 85}}, {72, {TE::Reduce, 85}}, {73, {TE::Reduce, 85}}, {77, {TE::Reduce, 85}}, {79, {TE::Reduce, 85}}, {81, {TE::Reduce, 85}}, {85, {TE::Reduce, 85}}, {91, {TE::Reduce, 85}}, {94, {TE::Reduce, 85}}, {99, {TE::Reduce, 85}}, {100, {TE::Reduce, 85}}, {104, {TE::Reduce, 85}}},
+    Row {{60, {TE::Reduce, 86}}, {70, {TE::Reduce, 86}}, {71, {TE::Reduce, 86}}, {72, {TE::Reduce, 86}}, {73, {TE::Reduce, 86}}, {77, {TE::Reduce, 86}}, {79, {TE::Reduce, 86}}, {80, {TE::Shift, 70}}, {81, {TE::Reduce, 86}}, {85, {TE::Reduce, 86}}, {91, {TE::Reduce, 86}}, {94, {TE::Reduce, 86}}, {99, {TE::Reduce, 86}}, {100, {TE::Reduce, 86}}, {104, {TE::Reduce, 86}}},
+    Row {{60, {TE::Reduce, 87}}, {70, {TE::Reduce, 87}}, {71, {TE::Reduce, 87}}, {72, {TE::Reduce, 87}}, {73, {TE::Reduce, 87}}, {77, {TE::Reduce, 87}}, {79, {TE::Reduce, 87}}, {81, {TE::Reduce, 87}}, {85, {TE::Reduce, 87}}, {91, {TE::Reduce, 87}}, {94, {TE::Reduce, 87}}, {99, {TE::Reduce, 87}}, {100, {TE::Reduce, 87}}, {104, {TE::Reduce, 87}}},
+    Row {{60, {TE::Reduce, 88}}, {70, {TE::Reduce, 88}}, {71, {TE::Reduce, 88}}, {72, {TE::Reduce, 88}}, {73, {TE::Reduce, 88}}, {77, {TE::Reduce, 88}}, {79, {TE::Reduce, 88}}, {81, {TE::Reduce, 88}}, {85, {TE::Reduce, 88}}, {91, {TE::Reduce, 88}}, {93, {TE::Shift, 75}}, {94, {TE::Reduce, 88}}, {99, {TE::Reduce, 88}}, {100, {TE::Reduce, 88}}, {104, {TE::Reduce, 88}}},
+    Row {{60, {TE::Reduce, 90}}, {70, {TE::Reduce, 90}}, {71, {TE::Reduce, 90}}, {72, {TE::Reduce, 90}}, {73, {TE::Reduce, 90}}, {77, {TE::Reduce, 90}}, {79, {TE::Reduce, 90}}, {81, {TE::Reduce, 90}}, {85, {TE::Reduce, 90}}, {91, {TE::Reduce, 90}}, {94, {TE::Reduce, 90}}, {99, {TE::Reduce, 90}}, {100, {TE::Reduce, 90}}, {104, {TE::Reduce, 90}}},
+    Row {{60, {TE::Reduce, 91}}, {70, {TE::Reduce, 91}}, {71, {TE::Reduce, 91}}, {72, {TE::Reduce, 91}}, {73, {TE::Reduce, 91}}, {77, {TE::Reduce, 91}}, {79, {TE::Reduce, 91}}, {80, {TE::Reduce, 91}}, {81, {TE::Reduce, 91}}, {85, {TE::Reduce, 91}}, {91, {TE::Reduce, 91}}, {94, {TE::Reduce, 91}}, {99, {TE::Reduce, 91}}, {100, {TE::Reduce, 91}}, {104, {TE::Reduce, 91}}},
+    Row {{62, {TE::Shift, 20}}, {63, {TE::Shift, 78}}},
+    Row {{60, {TE::Shift, 68}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 69}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}},
+    Row {{74, {TE::Reduce, 22}}, {75, {TE::Reduce, 22}}, {76, {TE::Reduce, 22}}, {102, {TE::Reduce, 22}}, {103, {TE::Reduce, 22}}, {105, {TE::Reduce, 22}}},
+    Row {{81, {TE::Reduce, 94}}, {91, {TE::Reduce, 94}}, {94, {TE::Reduce, 94}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 73}}, {45, {TE::Transit, 71}}, {61, {TE::Shift, 17}}, {67, {TE::Shift, 72}}, {81, {TE::Reduce, 121}}, {90, {TE::Shift, 18}}},
+    Row {{81, {TE::Shift, 74}}},
+    Row {{81, {TE::Reduce, 122}}},
+    Row {{81, {TE::Reduce, 123}}},
+    Row {{60, {TE::Reduce, 92}}, {70, {TE::Reduce, 92}}, {71, {TE::Reduce, 92}}, {72, {TE::Reduce, 92}}, {73, {TE::Reduce, 92}}, {77, {TE::Reduce, 92}}, {79, {TE::Reduce, 92}}, {80, {TE::Reduce, 92}}, {81, {TE::Reduce, 92}}, {85, {TE::Reduce, 92}}, {91, {TE::Reduce, 92}}, {94, {TE::Reduce, 92}}, {99, {TE::Reduce, 92}}, {100, {TE::Reduce, 92}}, {104, {TE::Reduce, 92}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 58}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {38, {TE::Transit, 76}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}},
+    Row {{91, {TE::Shift, 67}}, {94, {TE::Shift, 77}}},
+    Row {{60, {TE::Reduce, 89}}, {70, {TE::Reduce, 89}}, {71, {TE::Reduce, 89}}, {72, {TE::Reduce, 89}}, {73, {TE::Reduce, 89}}, {77, {TE::Reduce, 89}}, {79, {TE::Reduce, 89}}, {81, {TE::Reduce, 89}}, {85, {TE::Reduce, 89}}, {91, {TE::Reduce, 89}}, {94, {TE::Reduce, 89}}, {99, {TE::Reduce, 89}}, {100, {TE::Reduce, 89}}, {104, {TE::Reduce, 89}}},
+    Row {{12, {TE::Transit, 35}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{79, {TE::Reduce, 50}}, {85, {TE::Reduce, 50}}},
+    Row {{81, {TE::Shift, 83}}, {91, {TE::Shift, 84}}},
+    Row {{81, {TE::Reduce, 54}}, {91, {TE::Reduce, 54}}},
+    Row {{81, {TE::Reduce, 52}}, {91, {TE::Reduce, 52}}, {93, {TE::Shift, 86}}},
+    Row {{79, {TE::Reduce, 51}}, {85, {TE::Reduce, 51}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 82}}, {22, {TE::Transit, 85}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{81, {TE::Reduce, 55}}, {91, {TE::Reduce, 55}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 58}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {38, {TE::Transit, 87}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}},
+    Row {{91, {TE::Shift, 67}}, {94, {TE::Shift, 88}}},
+    Row {{81, {TE::Reduce, 53}}, {91, {TE::Reduce, 53}}},
+    Row {{79, {TE::Shift, 90}}},
+    Row {{80, {TE::Shift, 91}}},
+    Row {{12, {TE::Transit, 93}}, {13, {TE::Transit, 92}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{81, {TE::Shift, 94}}, {91, {TE::Shift, 95}}},
+    Row {{81, {TE::Reduce, 32}}, {91, {TE::Reduce, 32}}},
+    Row {{60, {TE::Shift, 96}}},
+    Row {{12, {TE::Transit, 97}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{74, {TE::Reduce, 23}}, {75, {TE::Reduce, 23}}, {76, {TE::Reduce, 23}}, {102, {TE::Reduce, 23}}, {103, {TE::Reduce, 23}}, {105, {TE::Reduce, 23}}},
+    Row {{81, {TE::Reduce, 33}}, {91, {TE::Reduce, 33}}},
+    Row {{79, {TE::Shift, 99}}},
+    Row {{80, {TE::Shift, 100}}},
+    Row {{12, {TE::Transit, 103}}, {55, {TE::Transit, 102}}, {56, {TE::Transit, 101}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{81, {TE::Shift, 104}}, {91, {TE::Shift, 105}}},
+    Row {{81, {TE::Reduce, 144}}, {91, {TE::Reduce, 144}}},
+    Row {{77, {TE::Shift, 108}}, {81, {TE::Reduce, 140}}, {91, {TE::Reduce, 140}}, {104, {TE::Shift, 109}}},
+    Row {{60, {TE::Shift, 106}}},
+    Row {{12, {TE::Transit, 103}}, {55, {TE::Transit, 107}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{74, {TE::Reduce, 24}}, {75, {TE::Reduce, 24}}, {76, {TE::Reduce, 24}}, {102, {TE::Reduce, 24}}, {103, {TE::Reduce, 24}}, {105, {TE::Reduce, 24}}},
+    Row {{81, {TE::Reduce, 145}}, {91, {TE::Reduce, 145}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 110}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {80, {TE::Shift, 112}}, {81, {TE::Reduce, 126}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {91, {TE::Reduce, 126}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}, {104, {TE::Reduce, 126}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 245}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{81, {TE::Reduce, 141}}, {91, {TE::Reduce, 141}}, {99, {TE::Shift, 114}}, {104, {TE::Shift, 113}}},
+    Row {{60, {TE::Reduce, 127}}, {70, {TE::Reduce, 127}}, {71, {TE::Reduce, 127}}, {72, {TE::Reduce, 127}}, {73, {TE::Reduce, 127}}, {77, {TE::Reduce, 127}}, {79, {TE::Reduce, 127}}, {81, {TE::Reduce, 127}}, {85, {TE::Reduce, 127}}, {91, {TE::Reduce, 127}}, {99, {TE::Reduce, 127}}, {100, {TE::Reduce, 127}}, {104, {TE::Reduce, 127}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 73}}, {45, {TE::Transit, 243}}, {61, {TE::Shift, 17}}, {67, {TE::Shift, 72}}, {81, {TE::Reduce, 121}}, {90, {TE::Shift, 18}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 115}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{46, {TE::Transit, 240}}, {67, {TE::Shift, 241}}, {100, {TE::Reduce, 124}}},
+    Row {{70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 143}}, {91, {TE::Reduce, 143}}},
+    Row {{60, {TE::Reduce, 107}}, {63, {TE::Shift, 141}}, {70, {TE::Reduce, 107}}, {71, {TE::Reduce, 107}}, {72, {TE::Reduce, 107}}, {73, {TE::Reduce, 107}}, {77, {TE::Reduce, 107}}, {81, {TE::Reduce, 107}}, {91, {TE::Reduce, 107}}, {98, {TE::Shift, 139}}, {99, {TE::Shift, 140}}, {100, {TE::Reduce, 107}}},
+    Row {{60, {TE::Reduce, 102}}, {63, {TE::Reduce, 102}}, {70, {TE::Reduce, 102}}, {71, {TE::Reduce, 102}}, {72, {TE::Reduce, 102}}, {73, {TE::Reduce, 102}}, {77, {TE::Shift, 153}}, {79, {TE::Reduce, 102}}, {81, {TE::Reduce, 102}}, {91, {TE::Reduce, 102}}, {98, {TE::Reduce, 102}}, {99, {TE::Reduce, 102}}, {100, {TE::Reduce, 102}}},
+    Row {{60, {TE::Reduce, 114}}, {70, {TE::Reduce, 114}}, {71, {TE::Reduce, 114}}, {72, {TE::Reduce, 114}}, {73, {TE::Reduce, 114}}, {77, {TE::Reduce, 114}}, {81, {TE::Reduce, 114}}, {91, {TE::Reduce, 114}}, {100, {TE::Reduce, 114}}},
+    Row {{12, {TE::Transit, 157}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 155}}, {53, {TE::Transit, 158}}, {54, {TE::Transit, 156}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{60, {TE::Reduce, 101}}, {63, {TE::Reduce, 101}}, {70, {TE::Reduce, 101}}, {71, {TE::Reduce, 101}}, {72, {TE::Reduce, 101}}, {73, {TE::Reduce, 101}}, {77, {TE::Reduce, 101}}, {79, {TE::Reduce, 101}}, {81, {TE::Reduce, 101}}, {91, {TE::Reduce, 101}}, {98, {TE::Reduce, 101}}, {99, {TE::Reduce, 101}}, {100, {TE::Reduce, 101}}},
+    Row {{60, {TE::Reduce, 95}}, {63, {TE::Reduce, 95}}, {70, {TE::Reduce, 95}}, {71, {TE::Reduce, 95}}, {72, {TE::Reduce, 95}}, {73, {TE::Reduce, 95}}, {77, {TE::Reduce, 95}}, {79, {TE::Reduce, 95}}, {81, {TE::Reduce, 95}}, {91, {TE::Reduce, 95}}, {98, {TE::Reduce, 95}}, {99, {TE::Reduce, 95}}, {100, {TE::Reduce, 95}}},
+    Row {{60, {TE::Reduce, 96}}, {63, {TE::Reduce, 96}}, {70, {TE::Reduce, 96}}, {71, {TE::Reduce, 96}}, {72, {TE::Reduce, 96}}, {73, {TE::Reduce, 96}}, {77, {TE::Reduce, 96}}, {79, {TE::Reduce, 96}}, {81, {TE::Reduce, 96}}, {91, {TE::Reduce, 96}}, {98, {TE::Reduce, 96}}, {99, {TE::Reduce, 96}}, {100, {TE::Reduce, 96}}},
+    Row {{60, {TE::Reduce, 97}}, {63, {TE::Reduce, 97}}, {70, {TE::Reduce, 97}}, {71, {TE::Reduce, 97}}, {72, {TE::Reduce, 97}}, {73, {TE::Reduce, 97}}, {77, {TE::Reduce, 97}}, {79, {TE::Reduce, 97}}, {81, {TE::Reduce, 97}}, {91, {TE::Reduce, 97}}, {98, {TE::Reduce, 97}}, {99, {TE::Reduce, 97}}, {100, {TE::Reduce, 97}}},
+    Row {{60, {TE::Reduce, 98}}, {63, {TE::Reduce, 98}}, {70, {TE::Reduce, 98}}, {71, {TE::Reduce, 98}}, {72, {TE::Reduce, 98}}, {73, {TE::Reduce, 98}}, {77, {TE::Reduce, 98}}, {79, {TE::Reduce, 98}}, {81, {TE::Reduce, 98}}, {91, {TE::Reduce, 98}}, {98, {TE::Reduce, 98}}, {99, {TE::Reduce, 98}}, {100, {TE::Reduce, 98}}},
+    Row {{60, {TE::Reduce, 99}}, {63, {TE::Reduce, 99}}, {70, {TE::Reduce, 99}}, {71, {TE::Reduce, 99}}, {72, {TE::Reduce, 99}}, {73, {TE::Reduce, 99}}, {77, {TE::Reduce, 99}}, {79, {TE::Reduce, 99}}, {81, {TE::Reduce, 99}}, {91, {TE::Reduce, 99}}, {98, {TE::Reduce, 99}}, {99, {TE::Reduce, 99}}, {100, {TE::Reduce, 99}}},
+    Row {{60, {TE::Reduce, 100}}, {63, {TE::Reduce, 100}}, {70, {TE::Reduce, 100}}, {71, {TE::Reduce, 100}}, {72, {TE::Reduce, 100}}, {73, {TE::Reduce, 100}}, {77, {TE::Reduce, 100}}, {79, {TE::Reduce, 100}}, {81, {TE::Reduce, 100}}, {91, {TE::Reduce, 100}}, {98, {TE::Reduce, 100}}, {99, {TE::Reduce, 100}}, {100, {TE::Reduce, 100}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 149}}, {42, {TE::Transit, 148}}, {43, {TE::Transit, 172}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}, {100, {TE::Reduce, 118}}},
+    Row {{27, {TE::Transit, 174}}, {79, {TE::Reduce, 62}}, {80, {TE::Shift, 175}}, {85, {TE::Reduce, 62}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 134}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 135}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 136}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 137}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 138}}, {60, {TE::Reduce, 126}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {70, {TE::Reduce, 126}}, {71, {TE::Reduce, 126}}, {72, {TE::Reduce, 126}}, {73, {TE::Reduce, 126}}, {77, {TE::Reduce, 126}}, {80, {TE::Shift, 112}}, {81, {TE::Reduce, 126}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {91, {TE::Reduce, 126}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}, {100, {TE::Reduce, 126}}},
+    Row {{60, {TE::Reduce, 108}}, {70, {TE::Reduce, 108}}, {71, {TE::Reduce, 108}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 108}}, {91, {TE::Reduce, 108}}, {100, {TE::Reduce, 108}}},
+    Row {{60, {TE::Reduce, 109}}, {70, {TE::Reduce, 109}}, {71, {TE::Reduce, 109}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 109}}, {91, {TE::Reduce, 109}}, {100, {TE::Reduce, 109}}},
+    Row {{60, {TE::Reduce, 110}}, {70, {TE::Reduce, 110}}, {71, {TE::Reduce, 110}}, {72, {TE::Reduce, 110}}, {73, {TE::Reduce, 110}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 110}}, {91, {TE::Reduce, 110}}, {100, {TE::Reduce, 110}}},
+    Row {{60, {TE::Reduce, 111}}, {70, {TE::Reduce, 111}}, {71, {TE::Reduce, 111}}, {72, {TE::Reduce, 111}}, {73, {TE::Reduce, 111}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 111}}, {91, {TE::Reduce, 111}}, {100, {TE::Reduce, 111}}},
+    Row {{60, {TE::Reduce, 112}}, {70, {TE::Reduce, 112}}, {71, {TE::Reduce, 112}}, {72, {TE::Reduce, 112}}, {73, {TE::Reduce, 112}}, {77, {TE::Reduce, 112}}, {81, {TE::Reduce, 112}}, {91, {TE::Reduce, 112}}, {99, {TE::Shift, 114}}, {100, {TE::Reduce, 112}}},
+    Row {{12, {TE::Transit, 142}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 143}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{12, {TE::Transit, 145}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{60, {TE::Reduce, 103}}, {63, {TE::Reduce, 103}}, {70, {TE::Reduce, 103}}, {71, {TE::Reduce, 103}}, {72, {TE::Reduce, 103}}, {73, {TE::Reduce, 103}}, {77, {TE::Reduce, 103}}, {79, {TE::Reduce, 103}}, {81, {TE::Reduce, 103}}, {91, {TE::Reduce, 103}}, {98, {TE::Reduce, 103}}, {99, {TE::Reduce, 103}}, {100, {TE::Reduce, 103}}},
+    Row {{70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {100, {TE::Shift, 144}}},
+    Row {{60, {TE::Reduce, 104}}, {63, {TE::Reduce, 104}}, {70, {TE::Reduce, 104}}, {71, {TE::Reduce, 104}}, {72, {TE::Reduce, 104}}, {73, {TE::Reduce, 104}}, {77, {TE::Reduce, 104}}, {79, {TE::Reduce, 104}}, {81, {TE::Reduce, 104}}, {91, {TE::Reduce, 104}}, {98, {TE::Reduce, 104}}, {99, {TE::Reduce, 104}}, {100, {TE::Reduce, 104}}},
+    Row {{60, {TE::Reduce, 105}}, {63, {TE::Reduce, 105}}, {70, {TE::Reduce, 105}}, {71, {TE::Reduce, 105}}, {72, {TE::Reduce, 105}}, {73, {TE::Reduce, 105}}, {77, {TE::Reduce, 105}}, {79, {TE::Reduce, 105}}, {80, {TE::Shift, 146}}, {81, {TE::Reduce, 105}}, {91, {TE::Reduce, 105}}, {98, {TE::Reduce, 105}}, {99, {TE::Reduce, 105}}, {100, {TE::Reduce, 105}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 149}}, {42, {TE::Transit, 148}}, {43, {TE::Transit, 147}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {81, {TE::Reduce, 118}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{81, {TE::Shift, 150}}},
+    Row {{81, {TE::Reduce, 119}}, {91, {TE::Shift, 151}}, {100, {TE::Reduce, 119}}},
+    Row {{70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 116}}, {91, {TE::Reduce, 116}}, {100, {TE::Reduce, 116}}},
+    Row {{60, {TE::Reduce, 106}}, {63, {TE::Reduce, 106}}, {70, {TE::Reduce, 106}}, {71, {TE::Reduce, 106}}, {72, {TE::Reduce, 106}}, {73, {TE::Reduce, 106}}, {77, {TE::Reduce, 106}}, {79, {TE::Reduce, 106}}, {81, {TE::Reduce, 106}}, {91, {TE::Reduce, 106}}, {98, {TE::Reduce, 106}}, {99, {TE::Reduce, 106}}, {100, {TE::Reduce, 106}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 152}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 117}}, {91, {TE::Reduce, 117}}, {100, {TE::Reduce, 117}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 154}}, {60, {TE::Reduce, 126}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {70, {TE::Reduce, 126}}, {71, {TE::Reduce, 126}}, {72, {TE::Reduce, 126}}, {73, {TE::Reduce, 126}}, {77, {TE::Reduce, 126}}, {80, {TE::Shift, 112}}, {81, {TE::Reduce, 126}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {91, {TE::Reduce, 126}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}, {100, {TE::Reduce, 126}}},
+    Row {{60, {TE::Reduce, 113}}, {70, {TE::Reduce, 113}}, {71, {TE::Reduce, 113}}, {72, {TE::Reduce, 113}}, {73, {TE::Reduce, 113}}, {77, {TE::Reduce, 113}}, {81, {TE::Reduce, 113}}, {91, {TE::Reduce, 113}}, {99, {TE::Shift, 114}}, {100, {TE::Reduce, 113}}},
+    Row {{70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Shift, 159}}},
+    Row {{81, {TE::Shift, 160}}, {91, {TE::Shift, 161}}},
+    Row {{63, {TE::Reduce, 102}}, {70, {TE::Reduce, 102}}, {71, {TE::Reduce, 102}}, {72, {TE::Reduce, 102}}, {73, {TE::Reduce, 102}}, {77, {TE::Shift, 170}}, {79, {TE::Shift, 164}}, {81, {TE::Reduce, 102}}, {98, {TE::Reduce, 102}}, {99, {TE::Reduce, 102}}},
+    Row {{81, {TE::Reduce, 138}}, {91, {TE::Reduce, 138}}},
+    Row {{60, {TE::Reduce, 115}}, {70, {TE::Reduce, 115}}, {71, {TE::Reduce, 115}}, {72, {TE::Reduce, 115}}, {73, {TE::Reduce, 115}}, {77, {TE::Reduce, 115}}, {81, {TE::Reduce, 115}}, {91, {TE::Reduce, 115}}, {100, {TE::Reduce, 115}}},
+    Row {{60, {TE::Reduce, 147}}, {63, {TE::Reduce, 147}}, {70, {TE::Reduce, 147}}, {71, {TE::Reduce, 147}}, {72, {TE::Reduce, 147}}, {73, {TE::Reduce, 147}}, {77, {TE::Reduce, 147}}, {79, {TE::Reduce, 147}}, {81, {TE::Reduce, 147}}, {91, {TE::Reduce, 147}}, {98, {TE::Reduce, 147}}, {99, {TE::Reduce, 147}}, {100, {TE::Reduce, 147}}},
+    Row {{12, {TE::Transit, 163}}, {53, {TE::Transit, 162}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{81, {TE::Reduce, 139}}, {91, {TE::Reduce, 139}}},
+    Row {{77, {TE::Shift, 165}}, {79, {TE::Shift, 164}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 166}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 167}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {79, {TE::Reduce, 126}}, {80, {TE::Shift, 112}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}},
+    Row {{70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 136}}, {91, {TE::Reduce, 136}}},
+    Row {{79, {TE::Shift, 168}}, {99, {TE::Shift, 114}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 169}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 137}}, {91, {TE::Reduce, 137}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 171}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {70, {TE::Reduce, 126}}, {71, {TE::Reduce, 126}}, {72, {TE::Reduce, 126}}, {73, {TE::Reduce, 126}}, {77, {TE::Reduce, 126}}, {79, {TE::Reduce, 126}}, {80, {TE::Shift, 112}}, {81, {TE::Reduce, 126}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}},
+    Row {{70, {TE::Reduce, 113}}, {71, {TE::Reduce, 113}}, {72, {TE::Reduce, 113}}, {73, {TE::Reduce, 113}}, {77, {TE::Reduce, 113}}, {79, {TE::Shift, 168}}, {81, {TE::Reduce, 113}}, {99, {TE::Shift, 114}}},
+    Row {{100, {TE::Shift, 173}}},
+    Row {{60, {TE::Reduce, 146}}, {63, {TE::Reduce, 146}}, {70, {TE::Reduce, 146}}, {71, {TE::Reduce, 146}}, {72, {TE::Reduce, 146}}, {73, {TE::Reduce, 146}}, {77, {TE::Reduce, 146}}, {79, {TE::Reduce, 146}}, {81, {TE::Reduce, 146}}, {91, {TE::Reduce, 146}}, {98, {TE::Reduce, 146}}, {99, {TE::Reduce, 146}}, {100, {TE::Reduce, 146}}},
+    Row {{79, {TE::Shift, 176}}, {85, {TE::Shift, 177}}},
+    Row {{12, {TE::Transit, 211}}, {29, {TE::Transit, 210}}, {30, {TE::Transit, 208}}, {32, {TE::Transit, 207}}, {33, {TE::Transit, 206}}, {34, {TE::Transit, 205}}, {61, {TE::Shift, 17}}, {64, {TE::Shift, 209}}, {81, {TE::Reduce, 83}}, {90, {TE::Shift, 18}}, {96, {TE::Shift, 212}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 178}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{2, {TE::Transit, 179}}, {61, {TE::Reduce, 8}}, {66, {TE::Reduce, 8}}, {67, {TE::Reduce, 8}}, {68, {TE::Reduce, 8}}, {69, {TE::Reduce, 8}}, {80, {TE::Reduce, 8}}, {84, {TE::Reduce, 8}}, {86, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {99, {TE::Reduce, 8}}, {101, {TE::Reduce, 8}}, {102, {TE::Reduce, 8}}, {103, {TE::Reduce, 8}}},
+    Row {{60, {TE::Reduce, 148}}, {70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 148}}, {91, {TE::Reduce, 148}}, {100, {TE::Reduce, 148}}},
+    Row {{3, {TE::Transit, 181}}, {4, {TE::Transit, 182}}, {5, {TE::Transit, 183}}, {6, {TE::Transit, 185}}, {7, {TE::Transit, 184}}, {8, {TE::Transit, 186}}, {12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 188}}, {41, {TE::Transit, 187}}, {44, {TE::Transit, 192}}, {48, {TE::Transit, 11}}, {49, {TE::Transit, 13}}, {50, {TE::Transit, 191}}, {51, {TE::Transit, 190}}, {52, {TE::Transit, 189}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {86, {TE::Shift, 180}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}, {101, {TE::Shift, 193}}, {102, {TE::Shift, 12}}, {103, {TE::Shift, 14}}},
+    Row {{60, {TE::Reduce, 149}}, {70, {TE::Reduce, 149}}, {71, {TE::Reduce, 149}}, {72, {TE::Reduce, 149}}, {73, {TE::Reduce, 149}}, {77, {TE::Reduce, 149}}, {81, {TE::Reduce, 149}}, {91, {TE::Reduce, 149}}, {100, {TE::Reduce, 149}}},
+    Row {{61, {TE::Reduce, 9}}, {66, {TE::Reduce, 9}}, {67, {TE::Reduce, 9}}, {68, {TE::Reduce, 9}}, {69, {TE::Reduce, 9}}, {80, {TE::Reduce, 9}}, {84, {TE::Reduce, 9}}, {86, {TE::Reduce, 9}}, {90, {TE::Reduce, 9}}, {99, {TE::Reduce, 9}}, {101, {TE::Reduce, 9}}, {102, {TE::Reduce, 9}}, {103, {TE::Reduce, 9}}},
+    Row {{61, {TE::Reduce, 10}}, {66, {TE::Reduce, 10}}, {67, {TE::Reduce, 10}}, {68, {TE::Reduce, 10}}, {69, {TE::Reduce, 10}}, {80, {TE::Reduce, 10}}, {84, {TE::Reduce, 10}}, {86, {TE::Reduce, 10}}, {90, {TE::Reduce, 10}}, {99, {TE::Reduce, 10}}, {101, {TE::Reduce, 10}}, {102, {TE::Reduce, 10}}, {103, {TE::Reduce, 10}}},
+    Row {{61, {TE::Reduce, 11}}, {66, {TE::Reduce, 11}}, {67, {TE::Reduce, 11}}, {68, {TE::Reduce, 11}}, {69, {TE::Reduce, 11}}, {80, {TE::Reduce, 11}}, {84, {TE::Reduce, 11}}, {86, {TE::Reduce, 11}}, {90, {TE::Reduce, 11}}, {99, {TE::Reduce, 11}}, {101, {TE::Reduce, 11}}, {102, {TE::Reduce, 11}}, {103, {TE::Reduce, 11}}},
+    Row {{61, {TE::Reduce, 12}}, {66, {TE::Reduce, 12}}, {67, {TE::Reduce, 12}}, {68, {TE::Reduce, 12}}, {69, {TE::Reduce, 12}}, {80, {TE::Reduce, 12}}, {84, {TE::Reduce, 12}}, {86, {TE::Reduce, 12}}, {90, {TE::Reduce, 12}}, {99, {TE::Reduce, 12}}, {101, {TE::Reduce, 12}}, {102, {TE::Reduce, 12}}, {103, {TE::Reduce, 12}}},
+    Row {{61, {TE::Reduce, 13}}, {66, {TE::Reduce, 13}}, {67, {TE::Reduce, 13}}, {68, {TE::Reduce, 13}}, {69, {TE::Reduce, 13}}, {80, {TE::Reduce, 13}}, {84, {TE::Reduce, 13}}, {86, {TE::Reduce, 13}}, {90, {TE::Reduce, 13}}, {99, {TE::Reduce, 13}}, {101, {TE::Reduce, 13}}, {102, {TE::Reduce, 13}}, {103, {TE::Reduce, 13}}},
+    Row {{61, {TE::Reduce, 14}}, {66, {TE::Reduce, 14}}, {67, {TE::Reduce, 14}}, {68, {TE::Reduce, 14}}, {69, {TE::Reduce, 14}}, {80, {TE::Reduce, 14}}, {84, {TE::Reduce, 14}}, {86, {TE::Reduce, 14}}, {90, {TE::Reduce, 14}}, {99, {TE::Reduce, 14}}, {101, {TE::Reduce, 14}}, {102, {TE::Reduce, 14}}, {103, {TE::Reduce, 14}}},
+    Row {{60, {TE::Shift, 194}}, {70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}},
+    Row {{60, {TE::Reduce, 107}}, {63, {TE::Shift, 141}}, {70, {TE::Reduce, 107}}, {71, {TE::Reduce, 107}}, {72, {TE::Reduce, 107}}, {73, {TE::Reduce, 107}}, {77, {TE::Reduce, 107}}, {79, {TE::Reduce, 132}}, {91, {TE::Reduce, 132}}, {98, {TE::Shift, 139}}, {99, {TE::Shift, 140}}},
+    Row {{60, {TE::Shift, 195}}},
+    Row {{79, {TE::Shift, 196}}, {91, {TE::Shift, 197}}},
+    Row {{79, {TE::Reduce, 133}}, {91, {TE::Reduce, 133}}},
+    Row {{60, {TE::Shift, 203}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 204}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{61, {TE::Reduce, 18}}, {66, {TE::Reduce, 18}}, {67, {TE::Reduce, 18}}, {68, {TE::Reduce, 18}}, {69, {TE::Reduce, 18}}, {80, {TE::Reduce, 18}}, {84, {TE::Reduce, 18}}, {86, {TE::Reduce, 18}}, {90, {TE::Reduce, 18}}, {99, {TE::Reduce, 18}}, {101, {TE::Reduce, 18}}, {102, {TE::Reduce, 18}}, {103, {TE::Reduce, 18}}},
+    Row {{61, {TE::Reduce, 17}}, {66, {TE::Reduce, 17}}, {67, {TE::Reduce, 17}}, {68, {TE::Reduce, 17}}, {69, {TE::Reduce, 17}}, {80, {TE::Reduce, 17}}, {84, {TE::Reduce, 17}}, {86, {TE::Reduce, 17}}, {90, {TE::Reduce, 17}}, {99, {TE::Reduce, 17}}, {101, {TE::Reduce, 17}}, {102, {TE::Reduce, 17}}, {103, {TE::Reduce, 17}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 198}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{12, {TE::Transit, 201}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 200}}, {50, {TE::Transit, 199}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 202}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{60, {TE::Reduce, 135}}, {70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}},
+    Row {{79, {TE::Reduce, 134}}, {91, {TE::Reduce, 134}}},
+    Row {{63, {TE::Shift, 141}}, {79, {TE::Reduce, 132}}, {91, {TE::Reduce, 132}}, {98, {TE::Shift, 139}}, {99, {TE::Shift, 140}}},
+    Row {{63, {TE::Reduce, 102}}, {79, {TE::Reduce, 102}}, {91, {TE::Reduce, 102}}, {98, {TE::Reduce, 102}}, {99, {TE::Reduce, 102}}},
+    Row {{12, {TE::Transit, 163}}, {53, {TE::Transit, 158}}, {54, {TE::Transit, 156}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{61, {TE::Reduce, 19}}, {66, {TE::Reduce, 19}}, {67, {TE::Reduce, 19}}, {68, {TE::Reduce, 19}}, {69, {TE::Reduce, 19}}, {80, {TE::Reduce, 19}}, {84, {TE::Reduce, 19}}, {86, {TE::Reduce, 19}}, {90, {TE::Reduce, 19}}, {99, {TE::Reduce, 19}}, {101, {TE::Reduce, 19}}, {102, {TE::Reduce, 19}}, {103, {TE::Reduce, 19}}},
+    Row {{60, {TE::Reduce, 120}}, {70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}},
+    Row {{81, {TE::Shift, 213}}},
+    Row {{60, {TE::Shift, 217}}, {81, {TE::Reduce, 84}}, {91, {TE::Shift, 216}}},
+    Row {{60, {TE::Reduce, 80}}, {81, {TE::Reduce, 80}}, {91, {TE::Reduce, 80}}},
+    Row {{60, {TE::Reduce, 78}}, {81, {TE::Reduce, 78}}, {91, {TE::Reduce, 78}}},
+    Row {{12, {TE::Transit, 221}}, {29, {TE::Transit, 220}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}, {96, {TE::Shift, 212}}},
+    Row {{60, {TE::Reduce, 72}}, {79, {TE::Shift, 224}}, {81, {TE::Reduce, 72}}, {91, {TE::Reduce, 72}}},
+    Row {{60, {TE::Reduce, 68}}, {77, {TE::Shift, 226}}, {79, {TE::Reduce, 68}}, {81, {TE::Reduce, 68}}, {91, {TE::Reduce, 68}}},
+    Row {{12, {TE::Transit, 237}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{77, {TE::Shift, 214}}, {79, {TE::Reduce, 63}}, {85, {TE::Reduce, 63}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 215}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {79, {TE::Reduce, 126}}, {80, {TE::Shift, 112}}, {84, {TE::Shift, 61}}, {85, {TE::Reduce, 126}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}},
+    Row {{79, {TE::Reduce, 64}}, {85, {TE::Reduce, 64}}, {99, {TE::Shift, 114}}},
+    Row {{12, {TE::Transit, 211}}, {29, {TE::Transit, 210}}, {30, {TE::Transit, 208}}, {32, {TE::Transit, 218}}, {61, {TE::Shift, 17}}, {64, {TE::Shift, 209}}, {90, {TE::Shift, 18}}, {96, {TE::Shift, 212}}},
+    Row {{12, {TE::Transit, 211}}, {29, {TE::Transit, 210}}, {30, {TE::Transit, 208}}, {32, {TE::Transit, 219}}, {61, {TE::Shift, 17}}, {64, {TE::Shift, 209}}, {90, {TE::Shift, 18}}, {96, {TE::Shift, 212}}},
+    Row {{60, {TE::Reduce, 81}}, {81, {TE::Reduce, 81}}, {91, {TE::Reduce, 81}}},
+    Row {{60, {TE::Reduce, 82}}, {81, {TE::Reduce, 82}}, {91, {TE::Reduce, 82}}},
+    Row {{60, {TE::Reduce, 79}}, {81, {TE::Reduce, 79}}, {91, {TE::Reduce, 79}}},
+    Row {{60, {TE::Reduce, 68}}, {77, {TE::Shift, 222}}, {81, {TE::Reduce, 68}}, {91, {TE::Reduce, 68}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 223}}, {60, {TE::Reduce, 126}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {80, {TE::Shift, 112}}, {81, {TE::Reduce, 126}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {91, {TE::Reduce, 126}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}},
+    Row {{60, {TE::Reduce, 70}}, {79, {TE::Reduce, 70}}, {81, {TE::Reduce, 70}}, {91, {TE::Reduce, 70}}, {99, {TE::Shift, 114}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 225}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{60, {TE::Reduce, 73}}, {70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 73}}, {91, {TE::Reduce, 73}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 223}}, {60, {TE::Reduce, 126}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {79, {TE::Reduce, 126}}, {80, {TE::Shift, 112}}, {81, {TE::Reduce, 126}}, {84, {TE::Shift, 227}}, {90, {TE::Shift, 18}}, {91, {TE::Reduce, 126}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}},
+    Row {{60, {TE::Reduce, 87}}, {79, {TE::Reduce, 87}}, {80, {TE::Shift, 228}}, {81, {TE::Reduce, 87}}, {91, {TE::Reduce, 87}}, {99, {TE::Reduce, 87}}},
+    Row {{12, {TE::Transit, 211}}, {29, {TE::Transit, 210}}, {30, {TE::Transit, 208}}, {32, {TE::Transit, 207}}, {33, {TE::Transit, 206}}, {34, {TE::Transit, 229}}, {61, {TE::Shift, 17}}, {64, {TE::Shift, 209}}, {81, {TE::Reduce, 83}}, {90, {TE::Shift, 18}}, {96, {TE::Shift, 212}}},
+    Row {{81, {TE::Shift, 230}}},
+    Row {{77, {TE::Shift, 232}}, {79, {TE::Shift, 231}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 233}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 234}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {79, {TE::Reduce, 126}}, {80, {TE::Shift, 112}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}},
+    Row {{60, {TE::Reduce, 74}}, {70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 74}}, {91, {TE::Reduce, 74}}},
+    Row {{79, {TE::Shift, 235}}, {99, {TE::Shift, 114}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 236}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{60, {TE::Reduce, 75}}, {70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 75}}, {91, {TE::Reduce, 75}}},
+    Row {{60, {TE::Reduce, 69}}, {77, {TE::Shift, 238}}, {79, {TE::Reduce, 69}}, {81, {TE::Reduce, 69}}, {91, {TE::Reduce, 69}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 111}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {47, {TE::Transit, 239}}, {60, {TE::Reduce, 126}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {79, {TE::Reduce, 126}}, {80, {TE::Shift, 112}}, {81, {TE::Reduce, 126}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {91, {TE::Reduce, 126}}, {97, {TE::Shift, 63}}, {99, {TE::Reduce, 126}}},
+    Row {{60, {TE::Reduce, 71}}, {79, {TE::Reduce, 71}}, {81, {TE::Reduce, 71}}, {91, {TE::Reduce, 71}}, {99, {TE::Shift, 114}}},
+    Row {{100, {TE::Shift, 242}}},
+    Row {{100, {TE::Reduce, 125}}},
+    Row {{60, {TE::Reduce, 129}}, {70, {TE::Reduce, 129}}, {71, {TE::Reduce, 129}}, {72, {TE::Reduce, 129}}, {73, {TE::Reduce, 129}}, {77, {TE::Reduce, 129}}, {79, {TE::Reduce, 129}}, {81, {TE::Reduce, 129}}, {85, {TE::Reduce, 129}}, {91, {TE::Reduce, 129}}, {99, {TE::Reduce, 129}}, {100, {TE::Reduce, 129}}, {104, {TE::Reduce, 129}}},
+    Row {{81, {TE::Shift, 244}}},
+    Row {{60, {TE::Reduce, 128}}, {70, {TE::Reduce, 128}}, {71, {TE::Reduce, 128}}, {72, {TE::Reduce, 128}}, {73, {TE::Reduce, 128}}, {77, {TE::Reduce, 128}}, {79, {TE::Reduce, 128}}, {81, {TE::Reduce, 128}}, {85, {TE::Reduce, 128}}, {91, {TE::Reduce, 128}}, {99, {TE::Reduce, 128}}, {100, {TE::Reduce, 128}}, {104, {TE::Reduce, 128}}},
+    Row {{70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}, {81, {TE::Reduce, 142}}, {91, {TE::Reduce, 142}}},
+    Row {{79, {TE::Shift, 247}}, {85, {TE::Shift, 248}}},
+    Row {{12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 116}}, {41, {TE::Transit, 249}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}},
+    Row {{2, {TE::Transit, 251}}, {61, {TE::Reduce, 8}}, {66, {TE::Reduce, 8}}, {67, {TE::Reduce, 8}}, {68, {TE::Reduce, 8}}, {69, {TE::Reduce, 8}}, {80, {TE::Reduce, 8}}, {84, {TE::Reduce, 8}}, {86, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {99, {TE::Reduce, 8}}, {101, {TE::Reduce, 8}}, {102, {TE::Reduce, 8}}, {103, {TE::Reduce, 8}}},
+    Row {{60, {TE::Shift, 250}}, {70, {TE::Shift, 129}}, {71, {TE::Shift, 130}}, {72, {TE::Shift, 131}}, {73, {TE::Shift, 132}}, {77, {TE::Shift, 133}}},
+    Row {{74, {TE::Reduce, 25}}, {75, {TE::Reduce, 25}}, {76, {TE::Reduce, 25}}, {102, {TE::Reduce, 25}}, {103, {TE::Reduce, 25}}, {105, {TE::Reduce, 25}}},
+    Row {{3, {TE::Transit, 181}}, {4, {TE::Transit, 182}}, {5, {TE::Transit, 183}}, {6, {TE::Transit, 185}}, {7, {TE::Transit, 184}}, {8, {TE::Transit, 186}}, {12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 188}}, {41, {TE::Transit, 187}}, {44, {TE::Transit, 192}}, {48, {TE::Transit, 11}}, {49, {TE::Transit, 13}}, {50, {TE::Transit, 191}}, {51, {TE::Transit, 190}}, {52, {TE::Transit, 189}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {86, {TE::Shift, 252}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}, {101, {TE::Shift, 193}}, {102, {TE::Shift, 12}}, {103, {TE::Shift, 14}}},
+    Row {{74, {TE::Reduce, 26}}, {75, {TE::Reduce, 26}}, {76, {TE::Reduce, 26}}, {102, {TE::Reduce, 26}}, {103, {TE::Reduce, 26}}, {105, {TE::Reduce, 26}}},
+    Row {{21, {TE::Transit, 255}}, {80, {TE::Shift, 54}}, {85, {TE::Reduce, 49}}},
+    Row {{12, {TE::Transit, 261}}, {25, {TE::Transit, 260}}, {26, {TE::Transit, 259}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{85, {TE::Shift, 256}}},
+    Row {{2, {TE::Transit, 257}}, {61, {TE::Reduce, 8}}, {66, {TE::Reduce, 8}}, {67, {TE::Reduce, 8}}, {68, {TE::Reduce, 8}}, {69, {TE::Reduce, 8}}, {80, {TE::Reduce, 8}}, {84, {TE::Reduce, 8}}, {86, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {99, {TE::Reduce, 8}}, {101, {TE::Reduce, 8}}, {102, {TE::Reduce, 8}}, {103, {TE::Reduce, 8}}},
+    Row {{3, {TE::Transit, 181}}, {4, {TE::Transit, 182}}, {5, {TE::Transit, 183}}, {6, {TE::Transit, 185}}, {7, {TE::Transit, 184}}, {8, {TE::Transit, 186}}, {12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 188}}, {41, {TE::Transit, 187}}, {44, {TE::Transit, 192}}, {48, {TE::Transit, 11}}, {49, {TE::Transit, 13}}, {50, {TE::Transit, 191}}, {51, {TE::Transit, 190}}, {52, {TE::Transit, 189}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {86, {TE::Shift, 258}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}, {101, {TE::Shift, 193}}, {102, {TE::Shift, 12}}, {103, {TE::Shift, 14}}},
+    Row {{74, {TE::Reduce, 27}}, {75, {TE::Reduce, 27}}, {76, {TE::Reduce, 27}}, {102, {TE::Reduce, 27}}, {103, {TE::Reduce, 27}}, {105, {TE::Reduce, 27}}},
+    Row {{91, {TE::Shift, 263}}, {94, {TE::Shift, 262}}},
+    Row {{91, {TE::Reduce, 60}}, {94, {TE::Reduce, 60}}},
+    Row {{91, {TE::Reduce, 58}}, {94, {TE::Reduce, 58}}, {95, {TE::Shift, 265}}},
+    Row {{80, {TE::Reduce, 57}}, {85, {TE::Reduce, 57}}},
+    Row {{12, {TE::Transit, 261}}, {25, {TE::Transit, 264}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}},
+    Row {{91, {TE::Reduce, 61}}, {94, {TE::Reduce, 61}}},
+    Row {{12, {TE::Transit, 27}}, {14, {TE::Transit, 65}}, {15, {TE::Transit, 62}}, {35, {TE::Transit, 266}}, {36, {TE::Transit, 59}}, {37, {TE::Transit, 60}}, {61, {TE::Shift, 17}}, {65, {TE::Shift, 64}}, {84, {TE::Shift, 61}}, {90, {TE::Shift, 18}}, {97, {TE::Shift, 63}}},
+    Row {{91, {TE::Reduce, 59}}, {94, {TE::Reduce, 59}}},
+    Row {{21, {TE::Transit, 268}}, {80, {TE::Shift, 54}}, {85, {TE::Reduce, 49}}},
+    Row {{85, {TE::Shift, 269}}},
+    Row {{2, {TE::Transit, 270}}, {61, {TE::Reduce, 8}}, {66, {TE::Reduce, 8}}, {67, {TE::Reduce, 8}}, {68, {TE::Reduce, 8}}, {69, {TE::Reduce, 8}}, {80, {TE::Reduce, 8}}, {84, {TE::Reduce, 8}}, {86, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {99, {TE::Reduce, 8}}, {101, {TE::Reduce, 8}}, {102, {TE::Reduce, 8}}, {103, {TE::Reduce, 8}}},
+    Row {{3, {TE::Transit, 181}}, {4, {TE::Transit, 182}}, {5, {TE::Transit, 183}}, {6, {TE::Transit, 185}}, {7, {TE::Transit, 184}}, {8, {TE::Transit, 186}}, {12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 188}}, {41, {TE::Transit, 187}}, {44, {TE::Transit, 192}}, {48, {TE::Transit, 11}}, {49, {TE::Transit, 13}}, {50, {TE::Transit, 191}}, {51, {TE::Transit, 190}}, {52, {TE::Transit, 189}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {86, {TE::Shift, 271}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}, {101, {TE::Shift, 193}}, {102, {TE::Shift, 12}}, {103, {TE::Shift, 14}}},
+    Row {{74, {TE::Reduce, 28}}, {75, {TE::Reduce, 28}}, {76, {TE::Reduce, 28}}, {102, {TE::Reduce, 28}}, {103, {TE::Reduce, 28}}, {105, {TE::Reduce, 28}}},
+    Row {{21, {TE::Transit, 273}}, {80, {TE::Shift, 54}}, {85, {TE::Reduce, 49}}},
+    Row {{85, {TE::Shift, 274}}},
+    Row {{2, {TE::Transit, 275}}, {61, {TE::Reduce, 8}}, {66, {TE::Reduce, 8}}, {67, {TE::Reduce, 8}}, {68, {TE::Reduce, 8}}, {69, {TE::Reduce, 8}}, {80, {TE::Reduce, 8}}, {84, {TE::Reduce, 8}}, {86, {TE::Reduce, 8}}, {90, {TE::Reduce, 8}}, {99, {TE::Reduce, 8}}, {101, {TE::Reduce, 8}}, {102, {TE::Reduce, 8}}, {103, {TE::Reduce, 8}}},
+    Row {{3, {TE::Transit, 181}}, {4, {TE::Transit, 182}}, {5, {TE::Transit, 183}}, {6, {TE::Transit, 185}}, {7, {TE::Transit, 184}}, {8, {TE::Transit, 186}}, {12, {TE::Transit, 117}}, {39, {TE::Transit, 120}}, {40, {TE::Transit, 188}}, {41, {TE::Transit, 187}}, {44, {TE::Transit, 192}}, {48, {TE::Transit, 11}}, {49, {TE::Transit, 13}}, {50, {TE::Transit, 191}}, {51, {TE::Transit, 190}}, {52, {TE::Transit, 189}}, {57, {TE::Transit, 125}}, {58, {TE::Transit, 126}}, {59, {TE::Transit, 118}}, {61, {TE::Shift, 17}}, {66, {TE::Shift, 121}}, {67, {TE::Shift, 122}}, {68, {TE::Shift, 123}}, {69, {TE::Shift, 124}}, {80, {TE::Shift, 119}}, {84, {TE::Shift, 128}}, {86, {TE::Shift, 276}}, {90, {TE::Shift, 18}}, {99, {TE::Shift, 127}}, {101, {TE::Shift, 193}}, {102, {TE::Shift, 12}}, {103, {TE::Shift, 14}}},
+    Row {{74, {TE::Reduce, 29}}, {75, {TE::Reduce, 29}}, {76, {TE::Reduce, 29}}, {102, {TE::Reduce, 29}}, {103, {TE::Reduce, 29}}, {105, {TE::Reduce, 29}}},
+    Row {{61, {TE::Reduce, 15}}, {66, {TE::Reduce, 15}}, {67, {TE::Reduce, 15}}, {68, {TE::Reduce, 15}}, {69, {TE::Reduce, 15}}, {74, {TE::Reduce, 15}}, {75, {TE::Reduce, 15}}, {76, {TE::Reduce, 15}}, {80, {TE::Reduce, 15}}, {84, {TE::Reduce, 15}}, {86, {TE::Reduce, 15}}, {90, {TE::Reduce, 15}}, {99, {TE::Reduce, 15}}, {101, {TE::Reduce, 15}}, {102, {TE::Reduce, 15}}, {103, {TE::Reduce, 15}}, {105, {TE::Reduce, 15}}},
+    Row {{60, {TE::Reduce, 130}}, {91, {TE::Shift, 280}}},
+    Row {{60, {TE::Reduce, 76}}, {91, {TE::Reduce, 76}}},
+    Row {{12, {TE::Transit, 211}}, {29, {TE::Transit, 210}}, {30, {TE::Transit, 281}}, {61, {TE::Shift, 17}}, {90, {TE::Shift, 18}}, {96, {TE::Shift, 212}}},
+    Row {{60, {TE::Reduce, 77}}, {91, {TE::Reduce, 77}}},
+    Row {{61, {TE::Reduce, 16}}, {66, {TE::Reduce, 16}}, {67, {TE::Reduce, 16}}, {68, {TE::Reduce, 16}}, {69, {TE::Reduce, 16}}, {74, {TE::Reduce, 16}}, {75, {TE::Reduce, 16}}, {76, {TE::Reduce, 16}}, {80, {TE::Reduce, 16}}, {84, {TE::Reduce, 16}}, {86, {TE::Reduce, 16}}, {90, {TE::Reduce, 16}}, {99, {TE::Reduce, 16}}, {101, {TE::Reduce, 16}}, {102, {TE::Reduce, 16}}, {103, {TE::Reduce, 16}}, {105, {TE::Reduce, 16}}},
+    Row {{60, {TE::Reduce, 131}}, {91, {TE::Shift, 280}}}
 };
 // clang-format on
 
@@ -0,0 +1,203 @@
+#ifndef __PINT_PIPELINES_H
+#define __PINT_PIPELINES_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Fuses chains of `map` and `filter` calls, optionally ending in `reduce`, into a single
+	 * pass over the source, see Pipeline, instead of building an array for every call.  Only
+	 * chains over an array or a string, literal or declared so, are fused, since any other
+	 * receiver may have methods of its own by those names.
+	 *
+	 * The result of the chain is only built when it is used as a value: stored, passed,
+	 * returned or otherwise escaping.  A chain iterated for its values by `for ... in`, reduced,
+	 * or whose result is discarded never builds one, so a single `map` is made lazy there too;
+	 * a discarded chain is drained, driven through each for the calls it makes.  `for ... of`
+	 * iterates indexes, so the chain it is given is built like any other value.
+	 */
+	class Pipelines {
+		public:
+			/**
+			 * Returns the number of intermediate arrays no longer built.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				types.clear();
+				avoided = 0;
+
+				visit(node, Use::DISCARDED);
+
+				return avoided;
+			}
+
+		private:
+			enum class Use {
+				VALUE,
+				CONSUMED,
+				DISCARDED
+			};
+
+			std::map<std::string, std::shared_ptr<TypeNode>> types;
+			std::size_t avoided = 0;
+
+			void visit(std::shared_ptr<Node> node, Use use) {
+				if (!node) {
+					return;
+				}
+
+				if (auto list = as(ListNode, node)) {
+					for (auto &item: list->list) {
+						visit(item, use);
+					}
+
+					return;
+				}
+
+				if (auto var = as(VarNode, node)) {
+					visit(var->value, Use::VALUE);
+
+					types[var->name->name] = var->type;
+
+					return;
+				}
+
+				if (auto call = as(CallNode, node); call && stage(*call) && sequence(source(*call))) {
+					chain(call, use);
+
+					return;
+				}
+
+				if (auto loop = as(ForNode, node)) {
+					auto outer = types;
+
+					visit(loop->subject, loop->kind == ForNode::Kind::IN ? Use::CONSUMED : Use::VALUE);
+					visit(loop->limit, Use::VALUE);
+
+					types.erase(loop->variable->name);
+					visit(loop->body, Use::DISCARDED);
+					types = outer;
+
+					if (auto call = as(CallNode, loop->subject); call && !call->stages.empty() && !call->materialize) {
+						loop->over = ForNode::Over::PIPELINE;
+					}
+
+					return;
+				}
+
+				if (auto function = as(FunctionNode, node)) {
+					auto outer = types;
+
+					visit(function->params, Use::VALUE);
+					visit(function->body, Use::DISCARDED);
+
+					types = outer;
+
+					return;
+				}
+
+				if (auto branch = as(IfNode, node)) {
+					visit(branch->condition, Use::VALUE);
+					visit(branch->then, Use::DISCARDED);
+					visit(branch->otherwise, Use::DISCARDED);
+
+					return;
+				}
+
+				for (auto &child: node->children()) {
+					visit(child, Use::VALUE);
+				}
+			}
+
+			static std::string name(const CallNode &call) {
+				auto member = as(MemberNode, call.target);
+
+				return member && call.args ? member->name->name : "";
+			}
+
+			/**
+			 * `map(f)`, `filter(f)` or `reduce(f, initial)`.
+			 */
+			static bool stage(const CallNode &call) {
+				auto name  = Pipelines::name(call);
+				auto count = call.args ? call.args->list.size() : 0;
+
+				return ((name == "map" || name == "filter") && count == 1) || (name == "reduce" && count == 2);
+			}
+
+			/**
+			 * The receiver of the first call of the chain ending in call.
+			 */
+			static std::shared_ptr<Node> source(const CallNode &call) {
+				auto receiver = as(MemberNode, call.target)->target;
+
+				for (auto inner = as(CallNode, receiver); inner && stage(*inner) && name(*inner) != "reduce"; inner = as(CallNode, receiver)) {
+					receiver = as(MemberNode, inner->target)->target;
+				}
+
+				return receiver;
+			}
+
+			bool sequence(std::shared_ptr<Node> receiver) {
+				if (as(ArrayNode, receiver)) {
+					return true;
+				}
+
+				if (auto literal = as(LiteralNode, receiver)) {
+					return literal->kind == LiteralNode::Kind::STRING;
+				}
+
+				auto identifier = as(IdentifierNode, receiver);
+				auto found      = identifier ? types.find(identifier->name) : types.end();
+
+				if (found == types.end() || !found->second || !found->second->fixedType) {
+					return false;
+				}
+
+				return found->second->isArray() || found->second->name == "string";
+			}
+
+			void chain(std::shared_ptr<CallNode> last, Use use) {
+				std::vector<std::shared_ptr<CallNode>> stages = {last};
+
+				while (true) {
+					auto source = as(CallNode, as(MemberNode, stages.back()->target)->target);
+
+					if (!source || !stage(*source) || name(*source) == "reduce") {
+						break;
+					}
+
+					stages.push_back(source);
+				}
+
+				std::vector<std::shared_ptr<CallNode>> chain(stages.rbegin(), stages.rend());
+				bool reduced     = name(*last) == "reduce";
+				bool materialize = !reduced && use == Use::VALUE;
+				std::size_t lazy = chain.size() - reduced - materialize;
+
+				if (lazy > 0) {
+					for (auto &stage: chain) {
+						stage->fused = stage != last;
+					}
+
+					last->stages      = chain;
+					last->materialize = materialize;
+					last->drained     = !reduced && use == Use::DISCARDED;
+
+					avoided += lazy;
+				}
+
+				visit(as(MemberNode, chain.front()->target)->target, Use::VALUE);
+
+				for (auto &stage: chain) {
+					visit(stage->args, Use::VALUE);
+				}
+			}
+	};
+}
+
+#endif
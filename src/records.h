@@ -0,0 +1,237 @@
+#ifndef __PINT_RECORDS_H
+#define __PINT_RECORDS_H
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "layout.h"
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Gives every record a fixed C-style layout, so a field access is a load at a constant
+	 * offset from a single allocation, see Record.
+	 *
+	 * The fields of the first extended record come first at their own offsets, so a record can
+	 * be used where its first base is expected.  The remaining inherited fields and the record's
+	 * own fields are flattened after the whole of it, padding included, so copying the base
+	 * part never touches them.  They go in order of decreasing alignment, each into the first
+	 * gap left by alignment that it fits in.  The generated constructor still takes and
+	 * evaluates the fields, defaults included, in declaration order.
+	 *
+	 * Records are named within their unit, `Logger.Entry` naming the one of another unit.
+	 * Records extending a record that is not declared in the tree keep an empty layout.
+	 */
+	class Records {
+		public:
+			/**
+			 * Returns the number of records which were laid out.
+			 */
+			std::size_t run(std::shared_ptr<Node> node) {
+				records.clear();
+				units.clear();
+				done.clear();
+				pending.clear();
+				unit.clear();
+
+				collect(node);
+
+				std::size_t count = 0;
+
+				for (auto &[name, record]: records) {
+					if (layout(record)) {
+						count++;
+					}
+				}
+
+				return count;
+			}
+
+		private:
+			/**
+			 * Records by unit-qualified name, and the unit each is declared in.
+			 */
+			std::map<std::string, std::shared_ptr<RecordNode>> records;
+			std::map<RecordNode *, std::string> units;
+			std::map<RecordNode *, bool> done;
+			std::set<RecordNode *> pending;
+			std::string unit;
+
+			void collect(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto list = as(ListNode, node)) {
+					auto outer = unit;
+
+					for (auto &item: list->list) {
+						if (auto declaration = as(UnitNode, item)) {
+							unit = declaration->name();
+						} else {
+							collect(item);
+						}
+					}
+
+					unit = outer;
+
+					return;
+				}
+
+				if (auto record = as(RecordNode, node)) {
+					records[unit + "." + record->name->name] = record;
+					units[record.get()] = unit;
+				}
+
+				for (auto &child: node->children()) {
+					collect(child);
+				}
+			}
+
+			/**
+			 * Lays out the record after the ones it extends, returns false if one is unknown.
+			 */
+			bool layout(std::shared_ptr<RecordNode> record) {
+				if (auto found = done.find(record.get()); found != done.end()) {
+					return found->second;
+				}
+
+				if (pending.count(record.get())) {
+					throw std::runtime_error("Record " + record->name->name + " extends itself");
+				}
+
+				pending.insert(record.get());
+
+				std::vector<std::shared_ptr<RecordNode>> bases;
+				bool known = true;
+
+				if (record->extends) {
+					for (auto &item: record->extends->list) {
+						auto name  = as(IdentifierNode, item);
+						auto found = name ? records.find(qualify(name->name, units[record.get()])) : records.end();
+
+						if (found == records.end() || !layout(found->second)) {
+							known = false;
+						} else {
+							bases.push_back(found->second);
+						}
+					}
+				}
+
+				pending.erase(record.get());
+				done[record.get()] = known;
+
+				auto params = std::make_shared<ListNode>();
+				auto body   = std::make_shared<ListNode>();
+
+				record->constructor = std::make_shared<FunctionNode>(params, std::make_shared<TypeNode>(record->name->name), body);
+
+				if (!known) {
+					return false;
+				}
+
+				std::vector<std::shared_ptr<VarNode>> fields;
+
+				for (auto &base: bases) {
+					for (auto &param: base->constructor->params->list) {
+						fields.push_back(as(VarNode, param));
+					}
+				}
+
+				if (record->fields) {
+					for (auto &item: record->fields->list) {
+						fields.push_back(as(VarNode, item));
+					}
+				}
+
+				std::set<std::string> names;
+
+				for (auto &field: fields) {
+					if (!names.insert(field->name->name).second) {
+						throw std::runtime_error("Field " + field->name->name + " of record " + record->name->name + " is declared twice");
+					}
+
+					auto param = std::make_shared<VarNode>(field->name, field->type);
+					auto self  = std::make_shared<MemberNode>(std::make_shared<IdentifierNode>("this"), field->name);
+
+					param->setValue(field->value);
+					params->list.push_back(param);
+					body->list.push_back(std::make_shared<AssignNode>(std::make_shared<ListNode>(self), field->name));
+				}
+
+				place(*record, bases, fields);
+
+				return true;
+			}
+
+			static std::string qualify(const std::string &name, const std::string &unit) {
+				return name.find('.') == std::string::npos ? unit + "." + name : name;
+			}
+
+			static void place(RecordNode &record, const std::vector<std::shared_ptr<RecordNode>> &bases, std::vector<std::shared_ptr<VarNode>> fields) {
+				std::size_t end = 0;
+
+				record.layout.clear();
+				record.align = 1;
+
+				if (!bases.empty()) {
+					auto &first = *bases.front();
+
+					end           = first.bytes;
+					record.layout = first.layout;
+					record.align  = first.align;
+
+					fields.erase(fields.begin(), fields.begin() + first.layout.size());
+				}
+
+				std::stable_sort(fields.begin(), fields.end(), [](auto &a, auto &b) {
+					return Layout::fieldAlign(a->type.get()) > Layout::fieldAlign(b->type.get());
+				});
+
+				std::vector<std::pair<std::size_t, std::size_t>> holes;
+
+				for (auto &field: fields) {
+					std::size_t bytes  = Layout::field(field->type.get());
+					std::size_t align  = Layout::fieldAlign(field->type.get());
+					std::size_t offset = (end + align - 1) / align * align;
+
+					auto hole = std::find_if(holes.begin(), holes.end(), [&](auto &hole) {
+						return (hole.first + align - 1) / align * align + bytes <= hole.second;
+					});
+
+					if (hole != holes.end()) {
+						auto [start, stop] = *hole;
+
+						offset = (start + align - 1) / align * align;
+						holes.erase(hole);
+
+						if (start < offset) {
+							holes.push_back({start, offset});
+						}
+
+						if (offset + bytes < stop) {
+							holes.push_back({offset + bytes, stop});
+						}
+					} else {
+						if (end < offset) {
+							holes.push_back({end, offset});
+						}
+
+						end = offset + bytes;
+					}
+
+					record.layout.push_back({field, offset, bytes, align});
+					record.align = std::max(record.align, align);
+				}
+
+				record.bytes = (end + record.align - 1) / record.align * record.align;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,659 @@
+#ifndef __PINT_RUNTIME_AIO_H
+#define __PINT_RUNTIME_AIO_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define PINT_IO_URING 1
+#endif
+
+namespace pint {
+	/**
+	 * A pending asynchronous write.  It owns the data until the write completes, and can be
+	 * polled from PINT code without blocking.
+	 */
+	class Completion {
+		public:
+			Completion(int fd, std::string data, int64_t offset) {
+				this->fd     = fd;
+				this->data   = std::move(data);
+				this->offset = offset;
+			}
+
+			bool done() const {
+				return finished.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * Bytes written, or a negated errno.  Only meaningful once done().
+			 */
+			int64_t result() const {
+				return written;
+			}
+
+			void finish(int64_t written) {
+				this->written = written;
+				finished.store(true, std::memory_order_release);
+			}
+
+			int fd;
+			std::string data;
+			int64_t offset;
+
+		private:
+			int64_t written = 0;
+			std::atomic<bool> finished = false;
+	};
+
+	/**
+	 * Where writes are actually carried out.  An offset of -1 writes at the current position.
+	 */
+	class Backend {
+		public:
+			virtual ~ Backend() {}
+
+			virtual void submit(std::shared_ptr<Completion> completion) = 0;
+
+			/**
+			 * Sends whatever is queued and collects finished writes, without waiting.
+			 */
+			virtual void poll() = 0;
+
+			/**
+			 * Waits until no write to the descriptor is queued or in flight, so it can be closed.
+			 */
+			virtual void drain(int fd) = 0;
+	};
+
+	#if PINT_IO_URING
+	/**
+	 * Submits writes to io_uring as they come, one syscall for everything queued.  A write to a
+	 * descriptor which still has writes in flight is held back until those finish, and the ones
+	 * held back are then submitted together, linked so they complete in order.  Finished writes
+	 * are collected on every submit and poll().
+	 *
+	 * A short write cancels the writes linked after it, so its remainder is resubmitted followed
+	 * by the cancelled writes, in their original order.
+	 */
+	class UringBackend: public Backend {
+		public:
+			static std::unique_ptr<UringBackend> create(unsigned entries = 256) {
+				auto backend = std::unique_ptr<UringBackend>(new UringBackend());
+
+				if (!backend->setup(entries)) {
+					return nullptr;
+				}
+
+				return backend;
+			}
+
+			~ UringBackend() {
+				while (!inflight.empty()) {
+					await();
+				}
+
+				if (sqes) munmap(sqes, sqesSize);
+				if (cqRing && cqRing != sqRing) munmap(cqRing, cqSize);
+				if (sqRing) munmap(sqRing, sqSize);
+				if (ring >= 0) ::close(ring);
+			}
+
+			/**
+			 * Never has more writes in flight than the completion queue can hold, so no completion
+			 * can overflow it.
+			 */
+			void submit(std::shared_ptr<Completion> completion) override {
+				reap();
+
+				while (inflight.size() >= capacity) {
+					await();
+				}
+
+				File &file  = files[completion->fd];
+				Write write = {completion, 0, sequence++};
+
+				if (!file.backlog.empty() || !place(write)) {
+					file.backlog.push_back(write);
+				}
+
+				send();
+			}
+
+			void poll() override {
+				send();
+				reap();
+				send();
+			}
+
+			void drain(int fd) override {
+				for (;;) {
+					reap();
+
+					auto found = files.find(fd);
+
+					if (found == files.end()) {
+						return;
+					}
+
+					if (!found->second.outstanding && found->second.backlog.empty()) {
+						files.erase(found);
+
+						return;
+					}
+
+					await();
+				}
+			}
+
+		private:
+			/**
+			 * A write and how much of it is already done, in the order it was submitted.
+			 */
+			struct Write {
+				std::shared_ptr<Completion> completion;
+				std::size_t written = 0;
+				uint64_t sequence   = 0;
+			};
+
+			/**
+			 * Writes to a descriptor which are in flight, those waiting for them to finish, and
+			 * those to submit again once they have.
+			 */
+			struct File {
+				unsigned outstanding = 0;
+				std::deque<Write> backlog;
+				std::vector<Write> retries;
+			};
+
+			int ring = -1;
+			unsigned entries  = 0;
+			unsigned capacity = 0;
+			unsigned queued   = 0;
+			uint64_t sequence = 0;
+
+			void *sqRing = nullptr;
+			void *cqRing = nullptr;
+			io_uring_sqe *sqes = nullptr;
+			std::size_t sqSize = 0;
+			std::size_t cqSize = 0;
+			std::size_t sqesSize = 0;
+
+			std::atomic<unsigned> *sqTail = nullptr;
+			unsigned *sqMask = nullptr;
+			unsigned *sqArray = nullptr;
+			std::atomic<unsigned> *cqHead = nullptr;
+			std::atomic<unsigned> *cqTail = nullptr;
+			unsigned *cqMask = nullptr;
+			io_uring_cqe *cqes = nullptr;
+
+			std::unordered_map<Completion *, Write> inflight;
+			std::unordered_map<int, File> files;
+
+			/**
+			 * Last queued entry per descriptor in the batch that has not been submitted yet.
+			 */
+			std::unordered_map<int, unsigned> batch;
+
+			UringBackend() {}
+
+			bool setup(unsigned entries) {
+				io_uring_params params = {};
+
+				ring = int(syscall(__NR_io_uring_setup, entries, &params));
+
+				if (ring < 0) {
+					return false;
+				}
+
+				if (!(params.features & IORING_FEAT_RW_CUR_POS) || !supports(IORING_OP_WRITE)) {
+					return false;
+				}
+
+				this->entries  = params.sq_entries;
+				this->capacity = params.cq_entries;
+
+				sqSize   = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+				cqSize   = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+				sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+				if (params.features & IORING_FEAT_SINGLE_MMAP) {
+					sqSize = cqSize = std::max(sqSize, cqSize);
+				}
+
+				sqRing = mmap(nullptr, sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+				cqRing = params.features & IORING_FEAT_SINGLE_MMAP
+					? sqRing
+					: mmap(nullptr, cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+				sqes   = static_cast<io_uring_sqe *>(mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES));
+
+				if (sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqes == MAP_FAILED) {
+					if (sqes != MAP_FAILED) munmap(sqes, sqesSize);
+					if (cqRing != MAP_FAILED && cqRing != sqRing) munmap(cqRing, cqSize);
+					if (sqRing != MAP_FAILED) munmap(sqRing, sqSize);
+
+					sqRing = cqRing = nullptr;
+					sqes   = nullptr;
+
+					return false;
+				}
+
+				char *sq = static_cast<char *>(sqRing);
+				char *cq = static_cast<char *>(cqRing);
+
+				sqTail  = reinterpret_cast<std::atomic<unsigned> *>(sq + params.sq_off.tail);
+				sqMask  = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+				sqArray = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+				cqHead  = reinterpret_cast<std::atomic<unsigned> *>(cq + params.cq_off.head);
+				cqTail  = reinterpret_cast<std::atomic<unsigned> *>(cq + params.cq_off.tail);
+				cqMask  = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+				cqes    = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+				return true;
+			}
+
+			/**
+			 * Whether the kernel knows opcode.  Setup fails without IORING_OP_WRITE, or without
+			 * IORING_FEAT_RW_CUR_POS for the offset of -1 of writes at the current position, as
+			 * kernels lacking either would fail every write with -EINVAL instead.
+			 */
+			bool supports(unsigned opcode) {
+				std::vector<char> buffer(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op));
+				auto probe = reinterpret_cast<io_uring_probe *>(buffer.data());
+
+				if (syscall(__NR_io_uring_register, ring, IORING_REGISTER_PROBE, probe, 256) < 0) {
+					return false;
+				}
+
+				return opcode <= probe->last_op && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED);
+			}
+
+			/**
+			 * Adds the rest of a write to the current batch, linked to the previous write to the
+			 * same descriptor.  Fails if earlier writes to the descriptor were already submitted
+			 * and are in flight.
+			 */
+			bool place(const Write &write) {
+				auto &completion = *write.completion;
+
+				if (queued == entries) {
+					send();
+				}
+
+				if (files[completion.fd].outstanding && !batch.count(completion.fd)) {
+					return false;
+				}
+
+				unsigned tail       = sqTail->load(std::memory_order_relaxed);
+				unsigned index      = tail & *sqMask;
+				io_uring_sqe &entry = sqes[index];
+
+				entry           = {};
+				entry.opcode    = IORING_OP_WRITE;
+				entry.fd        = completion.fd;
+				entry.addr      = reinterpret_cast<uint64_t>(completion.data.data() + write.written);
+				entry.len       = unsigned(completion.data.size() - write.written);
+				entry.off       = completion.offset < 0 ? uint64_t(-1) : uint64_t(completion.offset) + write.written;
+				entry.user_data = reinterpret_cast<uint64_t>(&completion);
+				sqArray[index]  = index;
+
+				if (auto previous = batch.find(completion.fd); previous != batch.end()) {
+					sqes[previous->second].flags |= IOSQE_IO_LINK;
+				}
+
+				batch[completion.fd] = index;
+				files[completion.fd].outstanding++;
+				inflight[&completion] = write;
+
+				sqTail->store(tail + 1, std::memory_order_release);
+				queued++;
+
+				return true;
+			}
+
+			void send() {
+				if (queued) {
+					enter(queued, 0, 0);
+					queued = 0;
+					batch.clear();
+				}
+			}
+
+			/**
+			 * Submits the batch and blocks until at least one write completes.
+			 */
+			void await() {
+				enter(queued, 1, IORING_ENTER_GETEVENTS);
+				queued = 0;
+				batch.clear();
+				reap();
+			}
+
+			void enter(unsigned submit, unsigned wait, unsigned flags) {
+				syscall(__NR_io_uring_enter, ring, submit, wait, flags, nullptr, 0);
+			}
+
+			/**
+			 * Finishes completed writes, keeping short and cancelled ones to submit again, then
+			 * queues the backlog of every descriptor that no longer has writes in flight.
+			 */
+			void reap() {
+				unsigned head = cqHead->load(std::memory_order_relaxed);
+				unsigned tail = cqTail->load(std::memory_order_acquire);
+
+				for (; head != tail; head++) {
+					io_uring_cqe &entry = cqes[head & *cqMask];
+					auto found          = inflight.find(reinterpret_cast<Completion *>(entry.user_data));
+					Write write         = std::move(found->second);
+					File &file          = files[write.completion->fd];
+
+					inflight.erase(found);
+					file.outstanding--;
+
+					if (entry.res > 0 && write.written + entry.res < write.completion->data.size()) {
+						write.written += entry.res;
+						file.retries.push_back(std::move(write));
+					} else if (entry.res == -ECANCELED) {
+						file.retries.push_back(std::move(write));
+					} else {
+						write.completion->finish(entry.res < 0 ? entry.res : int64_t(write.written + entry.res));
+					}
+				}
+
+				cqHead->store(head, std::memory_order_release);
+
+				for (auto &[fd, file]: files) {
+					if (file.outstanding) {
+						continue;
+					}
+
+					std::sort(file.retries.begin(), file.retries.end(), [](const Write &a, const Write &b) {
+						return a.sequence < b.sequence;
+					});
+
+					file.backlog.insert(file.backlog.begin(), file.retries.begin(), file.retries.end());
+					file.retries.clear();
+
+					while (!file.backlog.empty() && inflight.size() < capacity && place(file.backlog.front())) {
+						file.backlog.pop_front();
+					}
+				}
+			}
+	};
+	#endif
+
+	/**
+	 * Fallback for kernels (or sandboxes) without io_uring: a small pool of threads doing
+	 * blocking pwrite() calls.  Each descriptor always goes to the same thread, so writes to a
+	 * file complete in the order they were submitted.
+	 */
+	class ThreadBackend: public Backend {
+		public:
+			ThreadBackend(unsigned threads = 4) {
+				for (unsigned i = 0; i < threads; i++) {
+					auto shard = std::make_unique<Shard>();
+
+					shard->worker = std::thread([shard = shard.get()]() {
+						work(*shard);
+					});
+
+					shards.push_back(std::move(shard));
+				}
+			}
+
+			~ ThreadBackend() {
+				for (auto &shard: shards) {
+					{
+						std::lock_guard<std::mutex> lock(shard->mutex);
+
+						shard->stopping = true;
+					}
+
+					shard->ready.notify_one();
+					shard->worker.join();
+				}
+			}
+
+			void submit(std::shared_ptr<Completion> completion) override {
+				Shard &shard = *shards[unsigned(completion->fd) % shards.size()];
+
+				{
+					std::lock_guard<std::mutex> lock(shard.mutex);
+
+					shard.queue.push_back(completion);
+					shard.pending[completion->fd]++;
+				}
+
+				shard.ready.notify_one();
+			}
+
+			void poll() override {
+			}
+
+			void drain(int fd) override {
+				Shard &shard = *shards[unsigned(fd) % shards.size()];
+				std::unique_lock<std::mutex> lock(shard.mutex);
+
+				shard.idle.wait(lock, [&shard, fd]() {
+					return !shard.pending.count(fd);
+				});
+			}
+
+		private:
+			struct Shard {
+				std::mutex mutex;
+				std::condition_variable ready;
+				std::condition_variable idle;
+				std::deque<std::shared_ptr<Completion>> queue;
+
+				/**
+				 * Writes queued or being written, by descriptor.
+				 */
+				std::unordered_map<int, unsigned> pending;
+				std::thread worker;
+				bool stopping = false;
+			};
+
+			std::vector<std::unique_ptr<Shard>> shards;
+
+			/**
+			 * The queue is drained before the worker stops.
+			 */
+			static void work(Shard &shard) {
+				for (;;) {
+					std::shared_ptr<Completion> completion;
+
+					{
+						std::unique_lock<std::mutex> lock(shard.mutex);
+
+						shard.ready.wait(lock, [&shard]() {
+							return shard.stopping || !shard.queue.empty();
+						});
+
+						if (shard.queue.empty()) {
+							return;
+						}
+
+						completion = shard.queue.front();
+						shard.queue.pop_front();
+					}
+
+					completion->finish(write(*completion));
+
+					{
+						std::lock_guard<std::mutex> lock(shard.mutex);
+
+						if (--shard.pending[completion->fd] == 0) {
+							shard.pending.erase(completion->fd);
+						}
+					}
+
+					shard.idle.notify_all();
+				}
+			}
+
+			static int64_t write(const Completion &completion) {
+				std::size_t total = 0;
+
+				while (total < completion.data.size()) {
+					const char *data = completion.data.data() + total;
+					std::size_t size = completion.data.size() - total;
+					ssize_t written  = completion.offset < 0
+						? ::write(completion.fd, data, size)
+						: ::pwrite(completion.fd, data, size, completion.offset + int64_t(total));
+
+					if (written < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+
+						return -errno;
+					}
+
+					total += written;
+				}
+
+				return int64_t(total);
+			}
+	};
+
+	/**
+	 * Keeps recently used files open for appending, closing the least recently used one when
+	 * the cache is full, so a logger opening the same file for every entry does not reopen it.
+	 * A file is only closed once the backend has no more writes to it.
+	 */
+	class FileCache {
+		public:
+			FileCache(std::size_t capacity = 64) {
+				this->capacity = capacity;
+			}
+
+			~ FileCache() {
+				for (auto &entry: order) {
+					::close(entry.second);
+				}
+			}
+
+			/**
+			 * Returns -1 (with errno set) if the file cannot be opened.
+			 */
+			int open(const std::string &path, Backend &backend) {
+				auto found = index.find(path);
+
+				if (found != index.end()) {
+					order.splice(order.begin(), order, found->second);
+
+					return found->second->second;
+				}
+
+				int fd = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+
+				if (fd < 0) {
+					return fd;
+				}
+
+				if (order.size() == capacity) {
+					backend.drain(order.back().second);
+					::close(order.back().second);
+					index.erase(order.back().first);
+					order.pop_back();
+				}
+
+				order.emplace_front(path, fd);
+				index[path] = order.begin();
+
+				return fd;
+			}
+
+		private:
+			std::size_t capacity;
+			std::list<std::pair<std::string, int>> order;
+			std::unordered_map<std::string, std::list<std::pair<std::string, int>>::iterator> index;
+	};
+
+	/**
+	 * Asynchronous file output for the `io` unit, using io_uring when the kernel allows it.
+	 */
+	class AsyncFiles {
+		public:
+			AsyncFiles() {
+				#if PINT_IO_URING
+					backend = UringBackend::create();
+				#endif
+
+				if (!backend) {
+					backend = std::make_unique<ThreadBackend>();
+				}
+			}
+
+			AsyncFiles(std::unique_ptr<Backend> backend, std::size_t files = 64): files(files) {
+				this->backend = std::move(backend);
+			}
+
+			/**
+			 * Queues data to be appended to the file at path.
+			 */
+			std::shared_ptr<Completion> append(const std::string &path, std::string data) {
+				int fd = files.open(path, *backend);
+
+				if (fd < 0) {
+					auto failed = std::make_shared<Completion>(fd, std::move(data), -1);
+
+					failed->finish(-errno);
+
+					return failed;
+				}
+
+				return write(fd, std::move(data));
+			}
+
+			std::shared_ptr<Completion> write(int fd, std::string data, int64_t offset = -1) {
+				auto completion = std::make_shared<Completion>(fd, std::move(data), offset);
+
+				backend->submit(completion);
+
+				return completion;
+			}
+
+			void poll() {
+				backend->poll();
+			}
+
+			/**
+			 * Waits until the given write has completed.
+			 */
+			void wait(const Completion &completion) {
+				while (!completion.done()) {
+					poll();
+					std::this_thread::yield();
+				}
+			}
+
+		private:
+			FileCache files;
+
+			/**
+			 * Destroyed first, finishing every write before the files are closed.
+			 */
+			std::unique_ptr<Backend> backend;
+	};
+}
+
+#endif
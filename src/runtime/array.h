@@ -0,0 +1,98 @@
+#ifndef __PINT_RUNTIME_ARRAY_H
+#define __PINT_RUNTIME_ARRAY_H
+
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "types.h"
+
+namespace pint {
+	/**
+	 * Storage for `T[Span]`.  Arrays with a fixed span keep their elements inline, wherever the
+	 * array itself lives (a frame, a record, another array), only a dynamic span (`T[]`) allocates.
+	 *
+	 * operator[] is unchecked and is what the compiler emits once it has proven an index is in
+	 * span, at() is the checked access used everywhere else.
+	 */
+	template <typename T, std::size_t Span = DYNAMIC_SIZE>
+	class Array {
+		public:
+			Array() = default;
+
+			explicit Array(std::size_t span) requires (Span == DYNAMIC_SIZE) {
+				store.resize(span);
+			}
+
+			std::size_t span() const {
+				return store.size();
+			}
+
+			T &operator[](std::size_t index) {
+				return store[index];
+			}
+
+			const T &operator[](std::size_t index) const {
+				return store[index];
+			}
+
+			T &at(std::size_t index) {
+				check(index);
+
+				return store[index];
+			}
+
+			const T &at(std::size_t index) const {
+				check(index);
+
+				return store[index];
+			}
+
+			/**
+			 * Constant indexes into a fixed span are checked at compile time.
+			 */
+			template <std::size_t Index>
+			T &get() requires (Span != DYNAMIC_SIZE) {
+				static_assert(Index < Span, "Index is outside the span of the array");
+
+				return std::get<Index>(store);
+			}
+
+			void push(const T &value) requires (Span == DYNAMIC_SIZE) {
+				store.push_back(value);
+			}
+
+			void resize(std::size_t span) requires (Span == DYNAMIC_SIZE) {
+				store.resize(span);
+			}
+
+			void reserve(std::size_t span) requires (Span == DYNAMIC_SIZE) {
+				store.reserve(span);
+			}
+
+			T *data() {
+				return store.data();
+			}
+
+			const T *data() const {
+				return store.data();
+			}
+
+			auto begin() { return store.begin(); }
+			auto end() { return store.end(); }
+			auto begin() const { return store.begin(); }
+			auto end() const { return store.end(); }
+
+		private:
+			std::conditional_t<Span == DYNAMIC_SIZE, std::vector<T>, std::array<T, Span>> store{};
+
+			void check(std::size_t index) const {
+				if (index >= store.size()) {
+					throw std::out_of_range("Index is outside the span of the array");
+				}
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,241 @@
+#ifndef __PINT_RUNTIME_BITSET_H
+#define __PINT_RUNTIME_BITSET_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "types.h"
+
+namespace pint {
+	/**
+	 * Word-wise kernels shared by all bitsets.  They are written as flat loops over 64-bit words
+	 * with no early exits (except any/all) so the compiler vectorizes them for the target ISA.
+	 */
+	namespace bits {
+		using Word = uint64_t;
+
+		static constexpr std::size_t WORD_BITS = 64;
+
+		constexpr std::size_t words(std::size_t span) {
+			return (span + WORD_BITS - 1) / WORD_BITS;
+		}
+
+		/**
+		 * Mask of the bits in use in the last word of a bitset of the given span.
+		 */
+		constexpr Word tail(std::size_t span) {
+			return span % WORD_BITS ? (Word(1) << (span % WORD_BITS)) - 1 : ~Word(0);
+		}
+
+		inline void conjoin(Word *__restrict a, const Word *__restrict b, std::size_t n) {
+			for (std::size_t i = 0; i < n; i++) a[i] &= b[i];
+		}
+
+		inline void disjoin(Word *__restrict a, const Word *__restrict b, std::size_t n) {
+			for (std::size_t i = 0; i < n; i++) a[i] |= b[i];
+		}
+
+		inline void exclude(Word *__restrict a, const Word *__restrict b, std::size_t n) {
+			for (std::size_t i = 0; i < n; i++) a[i] ^= b[i];
+		}
+
+		inline void negate(Word *a, std::size_t n) {
+			for (std::size_t i = 0; i < n; i++) a[i] = ~a[i];
+		}
+
+		inline std::size_t count(const Word *a, std::size_t n) {
+			std::size_t result = 0;
+
+			for (std::size_t i = 0; i < n; i++) result += std::popcount(a[i]);
+
+			return result;
+		}
+
+		inline bool any(const Word *a, std::size_t n) {
+			for (std::size_t i = 0; i < n; i++) {
+				if (a[i]) return true;
+			}
+
+			return false;
+		}
+
+		inline bool all(const Word *a, std::size_t n, Word last) {
+			for (std::size_t i = 0; i + 1 < n; i++) {
+				if (~a[i]) return false;
+			}
+
+			return n == 0 || (a[n - 1] & last) == last;
+		}
+
+		/**
+		 * Calls back with the index of every set bit, in order.
+		 */
+		template <typename Callback>
+		void each(const Word *a, std::size_t n, Callback callback) {
+			for (std::size_t i = 0; i < n; i++) {
+				for (Word word = a[i]; word; word &= word - 1) {
+					callback(i * WORD_BITS + std::countr_zero(word));
+				}
+			}
+		}
+	}
+
+	/**
+	 * Packed storage for `boolean(N)` / `boolean(1)[N]`, one bit per element.  A Span of 0 gives a
+	 * bitmask with a dynamic span, otherwise the words are stored inline.
+	 */
+	template <std::size_t Span = DYNAMIC_SIZE>
+	class Bits {
+		public:
+			Bits() = default;
+
+			/**
+			 * Only bitmasks with a dynamic span may be constructed with a span.
+			 */
+			explicit Bits(std::size_t span) requires (Span == DYNAMIC_SIZE) {
+				resize(span);
+			}
+
+			std::size_t span() const {
+				if constexpr (Span == DYNAMIC_SIZE) {
+					return length;
+				} else {
+					return Span;
+				}
+			}
+
+			void resize(std::size_t span) requires (Span == DYNAMIC_SIZE) {
+				if (span < length && span % bits::WORD_BITS) {
+					store[span / bits::WORD_BITS] &= bits::tail(span);
+				}
+
+				store.resize(bits::words(span), 0);
+				length = span;
+			}
+
+			bool get(std::size_t index) const {
+				return (store[index / bits::WORD_BITS] >> (index % bits::WORD_BITS)) & 1;
+			}
+
+			bool at(std::size_t index) const {
+				check(index);
+
+				return get(index);
+			}
+
+			void set(std::size_t index, bool value = true) {
+				bits::Word mask = bits::Word(1) << (index % bits::WORD_BITS);
+
+				if (value) {
+					store[index / bits::WORD_BITS] |= mask;
+				} else {
+					store[index / bits::WORD_BITS] &= ~mask;
+				}
+			}
+
+			Bits &operator&=(const Bits &other) {
+				match(other);
+				bits::conjoin(store.data(), other.store.data(), store.size());
+
+				return *this;
+			}
+
+			Bits &operator|=(const Bits &other) {
+				match(other);
+				bits::disjoin(store.data(), other.store.data(), store.size());
+
+				return *this;
+			}
+
+			Bits &operator^=(const Bits &other) {
+				match(other);
+				bits::exclude(store.data(), other.store.data(), store.size());
+
+				return *this;
+			}
+
+			friend Bits operator&(Bits a, const Bits &b) { return a &= b; }
+			friend Bits operator|(Bits a, const Bits &b) { return a |= b; }
+			friend Bits operator^(Bits a, const Bits &b) { return a ^= b; }
+
+			friend Bits operator~(Bits a) {
+				bits::negate(a.store.data(), a.store.size());
+
+				if (!a.store.empty()) {
+					a.store.back() &= bits::tail(a.span());
+				}
+
+				return a;
+			}
+
+			friend bool operator==(const Bits &a, const Bits &b) {
+				return a.span() == b.span() && a.store == b.store;
+			}
+
+			std::size_t count() const {
+				return bits::count(store.data(), store.size());
+			}
+
+			bool any() const {
+				return bits::any(store.data(), store.size());
+			}
+
+			bool all() const {
+				return bits::all(store.data(), store.size(), bits::tail(span()));
+			}
+
+			bool none() const {
+				return !any();
+			}
+
+			template <typename Callback>
+			void each(Callback callback) const {
+				bits::each(store.data(), store.size(), callback);
+			}
+
+			const bits::Word *data() const {
+				return store.data();
+			}
+
+		private:
+			using Store = std::conditional_t<
+				Span == DYNAMIC_SIZE,
+				std::vector<bits::Word>,
+				std::array<bits::Word, bits::words(Span)>
+			>;
+
+			Store store{};
+
+			/**
+			 * Fixed span bitmasks carry nothing but their words.
+			 */
+			[[no_unique_address]] std::conditional_t<Span == DYNAMIC_SIZE, std::size_t, std::monostate> length{};
+
+			void check(std::size_t index) const {
+				if (index >= span()) {
+					throw std::out_of_range("Index is outside the span of the bitmask");
+				}
+			}
+
+			void match(const Bits &other) const {
+				if constexpr (Span == DYNAMIC_SIZE) {
+					if (other.length != length) {
+						throw std::length_error("Bitmasks have different spans");
+					}
+				}
+			}
+	};
+
+	/**
+	 * `boolean(1)` is a plain bool, larger sizes are packed bitmasks.
+	 */
+	template <std::size_t Size = 1>
+	using Boolean = std::conditional_t<Size == 1, bool, Bits<Size>>;
+}
+
+#endif
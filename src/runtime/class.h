@@ -0,0 +1,107 @@
+#ifndef __PINT_RUNTIME_CLASS_H
+#define __PINT_RUNTIME_CLASS_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "result.h"
+
+namespace pint {
+	/**
+	 * A method, cast back to its signature, with the instance first, when called.
+	 */
+	using Method = void (*)();
+
+	/**
+	 * An interface, or an implementation called through an itable.
+	 */
+	struct InterfaceType {
+		std::string name;
+	};
+
+	/**
+	 * The vtable slots of a class holding each method of an interface, in the interface's
+	 * order, see Classes.
+	 */
+	struct Itable {
+		const InterfaceType *interface;
+		const Method *methods;
+	};
+
+	/**
+	 * What the compiler emits for every class: its methods in slot order, those of the first
+	 * implementation it uses being a prefix, and an itable for every interface and
+	 * implementation it uses.
+	 */
+	struct ClassType {
+		std::string name;
+		const Method *vtable;
+		const Itable *itables = nullptr;
+		std::size_t interfaces = 0;
+
+		const Method *itable(const InterfaceType &interface) const {
+			for (std::size_t i = 0; i < interfaces; i++) {
+				if (itables[i].interface == &interface) {
+					return itables[i].methods;
+				}
+			}
+
+			throw std::runtime_error("Class " + name + " does not implement " + interface.name);
+		}
+	};
+
+	/**
+	 * The head of every class instance.
+	 */
+	class Instance: public Boxed {
+		public:
+			const ClassType &getType() const {
+				return *static_cast<const ClassType *>(type);
+			}
+
+			/**
+			 * A call through the vtable, for receivers known to use the implementation whose
+			 * methods start it.
+			 */
+			template <typename R, typename... Args>
+			R invoke(std::size_t slot, Args... args) {
+				return reinterpret_cast<R (*)(Instance &, Args...)>(getType().vtable[slot])(*this, std::forward<Args>(args)...);
+			}
+
+		protected:
+			Instance(const ClassType &type): Boxed(&type) {}
+	};
+
+	/**
+	 * The cache attached to one interface call site.  It keeps the itable of the last class
+	 * seen, so a call on the same class as before is a compare and an indirect call, and only
+	 * a new class searches its itables.
+	 */
+	class ItableCache {
+		public:
+			ItableCache(const InterfaceType &interface) {
+				this->interface = &interface;
+			}
+
+			template <typename R, typename... Args>
+			R invoke(Instance &self, std::size_t slot, Args... args) {
+				const ClassType *type = &self.getType();
+
+				if (type != last) {
+					methods = type->itable(*interface);
+					last    = type;
+				}
+
+				return reinterpret_cast<R (*)(Instance &, Args...)>(methods[slot])(self, std::forward<Args>(args)...);
+			}
+
+		private:
+			const InterfaceType *interface;
+			const ClassType *last = nullptr;
+			const Method *methods = nullptr;
+	};
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef __PINT_RUNTIME_CLOSURE_H
+#define __PINT_RUNTIME_CLOSURE_H
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace pint {
+	template <typename Signature>
+	class Closure;
+
+	/**
+	 * A function value, with the environment of captured locals ClosureEscape chose for it.
+	 * A function capturing nothing carries no environment, one that cannot outlive its frame
+	 * points at a lambda in that frame, and only one that escapes moves its captures to the
+	 * heap, in one allocation shared by every copy.
+	 *
+	 * Calls through a local the function is bound to, when it does not escape, are emitted as
+	 * direct calls of the lambda and never build a Closure.
+	 */
+	template <typename R, typename... Args>
+	class Closure<R(Args...)> {
+		public:
+			template <typename F>
+			requires std::is_empty_v<F> && std::is_default_constructible_v<F>
+			Closure(F) {
+				invoke = &stateless<F>;
+			}
+
+			/**
+			 * The function must outlive the closure.
+			 */
+			template <typename F>
+			static Closure borrow(F &function) {
+				Closure closure;
+
+				closure.invoke      = &stateful<F>;
+				closure.environment = &function;
+
+				return closure;
+			}
+
+			template <typename F>
+			static Closure own(F function) {
+				auto owner   = std::make_shared<F>(std::move(function));
+				auto closure = borrow(*owner);
+
+				closure.owner = std::move(owner);
+
+				return closure;
+			}
+
+			R operator()(Args... args) const {
+				return invoke(environment, std::forward<Args>(args)...);
+			}
+
+		private:
+			R (*invoke)(void *, Args...) = nullptr;
+			void *environment = nullptr;
+			std::shared_ptr<void> owner;
+
+			Closure() = default;
+
+			template <typename F>
+			static R stateless(void *, Args... args) {
+				return F{}(std::forward<Args>(args)...);
+			}
+
+			template <typename F>
+			static R stateful(void *environment, Args... args) {
+				return (*static_cast<F *>(environment))(std::forward<Args>(args)...);
+			}
+	};
+}
+
+#endif
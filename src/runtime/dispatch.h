@@ -0,0 +1,69 @@
+#ifndef __PINT_RUNTIME_DISPATCH_H
+#define __PINT_RUNTIME_DISPATCH_H
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace pint {
+	/**
+	 * Run-time halves of the case dispatches chosen by Cases.  Each returns the index of the
+	 * branch to take, or the fallback.
+	 */
+	namespace dispatch {
+		struct Range {
+			int64_t low;
+			int64_t high;
+			int branch;
+		};
+
+		/**
+		 * Binary search of sorted, disjoint ranges.
+		 */
+		constexpr int search(std::span<const Range> ranges, int64_t value, int fallback) {
+			std::size_t low = 0, high = ranges.size();
+
+			while (low < high) {
+				std::size_t middle = low + (high - low) / 2;
+
+				if (value < ranges[middle].low) {
+					high = middle;
+				} else if (value > ranges[middle].high) {
+					low = middle + 1;
+				} else {
+					return ranges[middle].branch;
+				}
+			}
+
+			return fallback;
+		}
+
+		/**
+		 * The seeded string hash the perfect hash of a case is searched for.  Both the compiler
+		 * and the generated code use it, so it must not change.
+		 */
+		constexpr uint64_t hash(std::string_view key, uint64_t seed) {
+			uint64_t result = seed ^ 0xCBF29CE484222325;
+
+			for (char c: key) {
+				result = (result ^ uint8_t(c)) * 0x100000001B3;
+			}
+
+			result ^= result >> 32;
+			result *= 0x9E3779B97F4A7C15;
+
+			return result ^ (result >> 29);
+		}
+
+		/**
+		 * A case over strings, keys.size() a power of two.
+		 */
+		constexpr int lookup(std::span<const std::string_view> keys, std::span<const int> branches, uint64_t seed, std::string_view value, int fallback) {
+			std::size_t slot = hash(value, seed) & (keys.size() - 1);
+
+			return branches[slot] >= 0 && keys[slot] == value ? branches[slot] : fallback;
+		}
+	}
+}
+
+#endif
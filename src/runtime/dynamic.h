@@ -0,0 +1,276 @@
+#ifndef __PINT_RUNTIME_DYNAMIC_H
+#define __PINT_RUNTIME_DYNAMIC_H
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace pint {
+	/**
+	 * The run-time value of an implicit dynamic variable (`var x;`).
+	 *
+	 * The whole value is a single 64-bit word.  Reals are stored as plain doubles, everything else
+	 * is boxed in the payload of a negative quiet NaN with a 3-bit tag, so creating, copying and
+	 * operating on a dynamic value never allocates and never goes through a virtual call.  Any NaN
+	 * produced by arithmetic is canonicalized to a positive quiet NaN so it cannot collide with a
+	 * boxed value.
+	 *
+	 * Variables with an explicit fixed type and size never use this, see numeric.h.
+	 */
+	class Dynamic {
+		public:
+			enum class Kind: uint8_t {
+				VOID,
+				REAL,
+				INTEGER,
+				BOOLEAN,
+				CHAR,
+				STRING,
+				POINTER,
+				BOXED
+			};
+
+			/**
+			 * Largest number of UTF-8 bytes a string can hold without leaving the word.
+			 */
+			static constexpr std::size_t SHORT_STRING = 5;
+
+			/**
+			 * Integers are kept as 48-bit two's complement, larger results degrade to reals.
+			 */
+			static constexpr int64_t MAX_INTEGER = (int64_t(1) << 47) - 1;
+			static constexpr int64_t MIN_INTEGER = -(int64_t(1) << 47);
+
+			constexpr Dynamic(): bits(box(Kind::VOID, 0)) {}
+
+			static Dynamic fromReal(double value) {
+				Dynamic result;
+
+				result.bits = value != value ? CANONICAL_NAN : std::bit_cast<uint64_t>(value);
+
+				return result;
+			}
+
+			static Dynamic fromInteger(int64_t value) {
+				if (value < MIN_INTEGER || value > MAX_INTEGER) {
+					return fromReal(double(value));
+				}
+
+				return fromBits(box(Kind::INTEGER, uint64_t(value) & PAYLOAD));
+			}
+
+			static Dynamic fromBoolean(bool value) {
+				return fromBits(box(Kind::BOOLEAN, value));
+			}
+
+			static Dynamic fromChar(char32_t value) {
+				return fromBits(box(Kind::CHAR, value));
+			}
+
+			/**
+			 * Short strings are stored inline, the length goes into the top payload byte.
+			 */
+			static Dynamic fromString(std::string_view value) {
+				if (value.size() > SHORT_STRING) {
+					throw std::length_error("String does not fit in a dynamic value");
+				}
+
+				uint64_t payload = uint64_t(value.size()) << 40;
+
+				std::memcpy(&payload, value.data(), value.size());
+
+				return fromBits(box(Kind::STRING, payload));
+			}
+
+			/**
+			 * Heap values are referenced by their (48-bit, canonical) address and owned elsewhere.
+			 */
+			static Dynamic fromPointer(const void *value) {
+				return fromBits(box(Kind::POINTER, reinterpret_cast<uintptr_t>(value) & PAYLOAD));
+			}
+
+			/**
+			 * A reference counted heap value, see Boxed, which its holders retain and release.
+			 */
+			static Dynamic fromBoxed(const void *value) {
+				return fromBits(box(Kind::BOXED, reinterpret_cast<uintptr_t>(value) & PAYLOAD));
+			}
+
+			Kind kind() const {
+				uint64_t tag = (bits & TAG_MASK) >> 48;
+
+				if ((bits & BOX_MASK) != BOX || tag == 0) {
+					return Kind::REAL;
+				}
+
+				return tag == 7 ? Kind::VOID : Kind(tag + 1);
+			}
+
+			bool isVoid() const {
+				return bits == box(Kind::VOID, 0);
+			}
+
+			bool isReal() const {
+				return kind() == Kind::REAL;
+			}
+
+			bool isInteger() const {
+				return (bits & (BOX_MASK | TAG_MASK)) == box(Kind::INTEGER, 0);
+			}
+
+			bool isNumber() const {
+				return isInteger() || isReal();
+			}
+
+			double toReal() const {
+				if (isInteger()) {
+					return double(integer());
+				}
+
+				expect(Kind::REAL);
+
+				return std::bit_cast<double>(bits);
+			}
+
+			int64_t toInteger() const {
+				expect(Kind::INTEGER);
+
+				return integer();
+			}
+
+			bool toBoolean() const {
+				expect(Kind::BOOLEAN);
+
+				return bits & 1;
+			}
+
+			char32_t toChar() const {
+				expect(Kind::CHAR);
+
+				return char32_t(bits & PAYLOAD);
+			}
+
+			std::string toString() const {
+				expect(Kind::STRING);
+
+				std::string result(std::size_t((bits >> 40) & 0xFF), '\0');
+
+				std::memcpy(result.data(), &bits, result.size());
+
+				return result;
+			}
+
+			const void *toPointer() const {
+				expect(Kind::POINTER);
+
+				return reinterpret_cast<const void *>(uintptr_t(bits & PAYLOAD));
+			}
+
+			const void *toBoxed() const {
+				expect(Kind::BOXED);
+
+				return reinterpret_cast<const void *>(uintptr_t(bits & PAYLOAD));
+			}
+
+			uint64_t raw() const {
+				return bits;
+			}
+
+			friend Dynamic operator+(Dynamic a, Dynamic b) {
+				if (a.isInteger() && b.isInteger()) {
+					return fromInteger(a.integer() + b.integer());
+				}
+
+				return fromReal(a.toReal() + b.toReal());
+			}
+
+			friend Dynamic operator-(Dynamic a, Dynamic b) {
+				if (a.isInteger() && b.isInteger()) {
+					return fromInteger(a.integer() - b.integer());
+				}
+
+				return fromReal(a.toReal() - b.toReal());
+			}
+
+			friend Dynamic operator*(Dynamic a, Dynamic b) {
+				int64_t result;
+
+				if (a.isInteger() && b.isInteger()) {
+					if (!__builtin_mul_overflow(a.integer(), b.integer(), &result)) {
+						return fromInteger(result);
+					}
+				}
+
+				return fromReal(a.toReal() * b.toReal());
+			}
+
+			/**
+			 * As in Pascal, `/` always produces a real.
+			 */
+			friend Dynamic operator/(Dynamic a, Dynamic b) {
+				return fromReal(a.toReal() / b.toReal());
+			}
+
+			friend bool operator==(Dynamic a, Dynamic b) {
+				if (a.isNumber() && b.isNumber()) {
+					return a.isInteger() && b.isInteger()
+						? a.bits == b.bits
+						: a.toReal() == b.toReal();
+				}
+
+				return a.bits == b.bits;
+			}
+
+			friend bool operator<(Dynamic a, Dynamic b) {
+				if (a.isInteger() && b.isInteger()) {
+					return a.integer() < b.integer();
+				}
+
+				return a.toReal() < b.toReal();
+			}
+
+		private:
+			static constexpr uint64_t BOX           = 0xFFF8000000000000;
+			static constexpr uint64_t BOX_MASK      = 0xFFF8000000000000;
+			static constexpr uint64_t TAG_MASK      = 0x0007000000000000;
+			static constexpr uint64_t PAYLOAD       = 0x0000FFFFFFFFFFFF;
+			static constexpr uint64_t CANONICAL_NAN = 0x7FF8000000000000;
+
+			/**
+			 * VOID gets tag 7 so that tag 0 stays free for the hardware's default negative NaN.
+			 */
+			static constexpr uint64_t box(Kind kind, uint64_t payload) {
+				uint64_t tag = kind == Kind::VOID ? 7 : uint64_t(kind) - 1;
+
+				return BOX | (tag << 48) | payload;
+			}
+
+			static Dynamic fromBits(uint64_t bits) {
+				Dynamic result;
+
+				result.bits = bits;
+
+				return result;
+			}
+
+			/**
+			 * Sign-extend the 48-bit payload.
+			 */
+			int64_t integer() const {
+				return int64_t(bits << 16) >> 16;
+			}
+
+			void expect(Kind expected) const {
+				if (kind() != expected) {
+					throw std::runtime_error("Dynamic value has an incompatible type");
+				}
+			}
+
+			uint64_t bits;
+	};
+}
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef __PINT_RUNTIME_FORMAT_H
+#define __PINT_RUNTIME_FORMAT_H
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "string.h"
+
+namespace pint {
+	/**
+	 * `'<pattern>'.format(...)`, where `%s` writes an argument as it is, `%d` an integer,
+	 * `%f` a real, `%.<digits>f` one with that many decimals, and `%%` a percent sign.
+	 *
+	 * A literal pattern is parsed when compiling, see Formats, into a Builder reserving the
+	 * units of the text plus an estimate for every argument, so the result is allocated once,
+	 * which the text and each argument in turn are written into, numbers with to_chars.  Only
+	 * patterns known at run-time go through format().
+	 */
+	namespace format {
+		struct Spec {
+			char kind;
+			int precision = -1;
+		};
+
+		/**
+		 * Reads the specifier after the `%` at, leaving at after it.
+		 */
+		inline Spec spec(std::string_view pattern, std::size_t &at) {
+			Spec result = {at < pattern.size() ? pattern[at] : '\0'};
+
+			if (result.kind == '.') {
+				result.precision = 0;
+
+				while (++at < pattern.size() && pattern[at] >= '0' && pattern[at] <= '9') {
+					result.precision = result.precision * 10 + (pattern[at] - '0');
+				}
+
+				result.kind = at < pattern.size() ? pattern[at] : '\0';
+
+				if (result.kind != 'f') {
+					throw std::invalid_argument("Format precision is only for %f");
+				}
+			}
+
+			if (result.kind != 's' && result.kind != 'd' && result.kind != 'f' && result.kind != '%') {
+				throw std::invalid_argument("Unknown format specifier %" + std::string(1, result.kind));
+			}
+
+			at++;
+
+			return result;
+		}
+
+		/**
+		 * A character is written as text, a unit of UTF-8 as it is and a wider one as its code
+		 * point encoded in UTF-8, rather than as the number it holds.
+		 */
+		template <typename T>
+		constexpr bool character = std::is_same_v<T, char> || std::is_same_v<T, char8_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+		/**
+		 * Units an argument usually needs, exact for strings.
+		 */
+		template <typename T>
+		constexpr std::size_t estimate(const T &value, Spec spec) {
+			if constexpr (std::is_same_v<T, String<8>>) {
+				return value.units();
+			} else if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+				return std::string_view(value).size();
+			} else if constexpr (std::is_floating_point_v<T>) {
+				return 24 + (spec.precision > 0 ? spec.precision : 0);
+			} else if constexpr (character<T>) {
+				return 4;
+			} else if constexpr (std::is_integral_v<T>) {
+				return 20;
+			} else {
+				return 0;
+			}
+		}
+
+		class Builder {
+			public:
+				Builder(std::size_t units) {
+					out.reserve(units);
+				}
+
+				Builder &text(std::string_view text) {
+					out += text;
+
+					return *this;
+				}
+
+				template <typename T>
+				Builder &put(const T &value, Spec spec) {
+					if constexpr (std::is_same_v<T, String<8>>) {
+						out += value.view();
+					} else if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+						out += std::string_view(value);
+					} else if constexpr (std::is_same_v<T, bool>) {
+						out += value ? "true" : "false";
+					} else if constexpr (character<T>) {
+						if (spec.kind == 'd' || spec.kind == 'f') {
+							put(std::uint32_t(value), spec);
+						} else if constexpr (sizeof(T) == 1) {
+							out += char(value);
+						} else {
+							utf::encode(char32_t(value), out);
+						}
+					} else if constexpr (std::is_floating_point_v<T>) {
+						if (spec.precision >= 0) {
+							number(value, std::chars_format::fixed, spec.precision);
+						} else {
+							number(value);
+						}
+					} else if constexpr (std::is_integral_v<T>) {
+						if (spec.kind == 'f') {
+							put(double(value), spec);
+						} else {
+							number(value);
+						}
+					} else {
+						out += value.toString();
+					}
+
+					return *this;
+				}
+
+				String<8> done() {
+					return String<8>::trusted(std::move(out), false);
+				}
+
+			private:
+				std::string out;
+
+				template <typename T, typename... Options>
+				void number(T value, Options... options) {
+					char buffer[352];
+					auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value, options...);
+
+					if (error != std::errc()) {
+						throw std::invalid_argument("Format precision is too large");
+					}
+
+					out.append(buffer, end);
+				}
+		};
+
+		/**
+		 * A pattern only known at run-time, parsed on every call.
+		 */
+		template <typename... Args>
+		String<8> format(std::string_view pattern, const Args &...args) {
+			Builder builder(pattern.size() + (estimate(args, {'s'}) + ... + 0));
+			std::size_t next = 0;
+			std::size_t from = 0;
+
+			for (std::size_t at = pattern.find('%'); at != std::string_view::npos; at = pattern.find('%', from)) {
+				builder.text(pattern.substr(from, at - from));
+
+				from = at + 1;
+
+				Spec spec = format::spec(pattern, from);
+
+				if (spec.kind == '%') {
+					builder.text("%");
+					continue;
+				}
+
+				if (next == sizeof...(Args)) {
+					throw std::invalid_argument("Format takes more arguments than it is given");
+				}
+
+				std::size_t index = 0;
+
+				((index++ == next ? (void) builder.put(args, spec) : (void) 0), ...);
+				next++;
+			}
+
+			if (next != sizeof...(Args)) {
+				throw std::invalid_argument("Format takes fewer arguments than it is given");
+			}
+
+			return builder.text(pattern.substr(from)).done();
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,276 @@
+#ifndef __PINT_RUNTIME_INTEGER_H
+#define __PINT_RUNTIME_INTEGER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pint {
+	/**
+	 * Arbitrary precision integer, used only for integers with a dynamic size (`var x: integer;`).
+	 *
+	 * Values that fit in 64 bits are kept inline and operated on with overflow-checked native
+	 * arithmetic, the limbs are only allocated once a result leaves that range.
+	 */
+	class BigInteger {
+		public:
+			BigInteger(int64_t value = 0) {
+				this->small = value;
+			}
+
+			bool isSmall() const {
+				return limbs.empty();
+			}
+
+			/**
+			 * Only meaningful when isSmall().
+			 */
+			int64_t toSmall() const {
+				return small;
+			}
+
+			double toReal() const {
+				if (isSmall()) {
+					return double(small);
+				}
+
+				double result = 0;
+
+				for (auto limb = limbs.rbegin(); limb != limbs.rend(); limb++) {
+					result = result * 4294967296.0 + *limb;
+				}
+
+				return negative ? -result : result;
+			}
+
+			std::string toString() const {
+				if (isSmall()) {
+					return std::to_string(small);
+				}
+
+				std::vector<uint32_t> rest = limbs;
+				std::string result;
+
+				while (!rest.empty()) {
+					uint64_t remainder = 0;
+
+					for (auto limb = rest.rbegin(); limb != rest.rend(); limb++) {
+						uint64_t current = (remainder << 32) | *limb;
+
+						*limb     = uint32_t(current / 1000000000);
+						remainder = current % 1000000000;
+					}
+
+					trim(rest);
+
+					for (int i = 0; i < 9 && (remainder || !rest.empty()); i++) {
+						result.push_back(char('0' + remainder % 10));
+						remainder /= 10;
+					}
+				}
+
+				if (negative) {
+					result.push_back('-');
+				}
+
+				std::reverse(result.begin(), result.end());
+
+				return result;
+			}
+
+			friend BigInteger operator-(const BigInteger &a) {
+				if (a.isSmall() && a.small != INT64_MIN) {
+					return BigInteger(-a.small);
+				}
+
+				BigInteger result = a.widen();
+
+				result.negative = !result.negative;
+
+				return result.normalize();
+			}
+
+			friend BigInteger operator+(const BigInteger &a, const BigInteger &b) {
+				int64_t result;
+
+				if (a.isSmall() && b.isSmall() && !__builtin_add_overflow(a.small, b.small, &result)) {
+					return BigInteger(result);
+				}
+
+				return add(a.widen(), b.widen(), false);
+			}
+
+			friend BigInteger operator-(const BigInteger &a, const BigInteger &b) {
+				int64_t result;
+
+				if (a.isSmall() && b.isSmall() && !__builtin_sub_overflow(a.small, b.small, &result)) {
+					return BigInteger(result);
+				}
+
+				return add(a.widen(), b.widen(), true);
+			}
+
+			friend BigInteger operator*(const BigInteger &a, const BigInteger &b) {
+				int64_t result;
+
+				if (a.isSmall() && b.isSmall() && !__builtin_mul_overflow(a.small, b.small, &result)) {
+					return BigInteger(result);
+				}
+
+				BigInteger x = a.widen();
+				BigInteger y = b.widen();
+				BigInteger product;
+
+				product.limbs.assign(x.limbs.size() + y.limbs.size(), 0);
+				product.negative = x.negative != y.negative;
+
+				for (std::size_t i = 0; i < x.limbs.size(); i++) {
+					uint64_t carry = 0;
+
+					for (std::size_t j = 0; j < y.limbs.size(); j++) {
+						uint64_t current = uint64_t(x.limbs[i]) * y.limbs[j] + product.limbs[i + j] + carry;
+
+						product.limbs[i + j] = uint32_t(current);
+						carry                = current >> 32;
+					}
+
+					product.limbs[i + y.limbs.size()] = uint32_t(carry);
+				}
+
+				return product.normalize();
+			}
+
+			friend bool operator==(const BigInteger &a, const BigInteger &b) {
+				return compare(a, b) == 0;
+			}
+
+			friend bool operator<(const BigInteger &a, const BigInteger &b) {
+				return compare(a, b) < 0;
+			}
+
+		private:
+			int64_t small = 0;
+			bool negative = false;
+			std::vector<uint32_t> limbs;
+
+			/**
+			 * Copy of this value in sign-magnitude form, regardless of size.
+			 */
+			BigInteger widen() const {
+				if (!isSmall()) {
+					return *this;
+				}
+
+				BigInteger result;
+				uint64_t magnitude = small < 0 ? 0 - uint64_t(small) : uint64_t(small);
+
+				result.negative = small < 0;
+				result.limbs    = {uint32_t(magnitude), uint32_t(magnitude >> 32)};
+
+				return result;
+			}
+
+			/**
+			 * Trim leading zero limbs and fall back to the inline form if the value fits.
+			 */
+			BigInteger &normalize() {
+				trim(limbs);
+
+				if (limbs.size() <= 2) {
+					uint64_t magnitude = 0;
+
+					for (std::size_t i = limbs.size(); i > 0; i--) {
+						magnitude = (magnitude << 32) | limbs[i - 1];
+					}
+
+					if (magnitude <= uint64_t(INT64_MAX) || (negative && magnitude == uint64_t(INT64_MAX) + 1)) {
+						small    = negative ? int64_t(0 - magnitude) : int64_t(magnitude);
+						negative = false;
+						limbs.clear();
+					}
+				}
+
+				return *this;
+			}
+
+			static void trim(std::vector<uint32_t> &limbs) {
+				while (!limbs.empty() && limbs.back() == 0) {
+					limbs.pop_back();
+				}
+			}
+
+			static int compareMagnitude(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b) {
+				if (a.size() != b.size()) {
+					return a.size() < b.size() ? -1 : 1;
+				}
+
+				for (std::size_t i = a.size(); i > 0; i--) {
+					if (a[i - 1] != b[i - 1]) {
+						return a[i - 1] < b[i - 1] ? -1 : 1;
+					}
+				}
+
+				return 0;
+			}
+
+			static int compare(const BigInteger &a, const BigInteger &b) {
+				if (a.isSmall() && b.isSmall()) {
+					return (a.small > b.small) - (a.small < b.small);
+				}
+
+				BigInteger x = a.widen();
+				BigInteger y = b.widen();
+
+				trim(x.limbs);
+				trim(y.limbs);
+
+				if (x.limbs.empty() && y.limbs.empty()) {
+					return 0;
+				}
+
+				if (x.negative != y.negative) {
+					return x.negative ? -1 : 1;
+				}
+
+				int result = compareMagnitude(x.limbs, y.limbs);
+
+				return x.negative ? -result : result;
+			}
+
+			/**
+			 * Signed addition (or subtraction) of two widened values.
+			 */
+			static BigInteger add(BigInteger a, BigInteger b, bool subtract) {
+				if (subtract) {
+					b.negative = !b.negative;
+				}
+
+				if (a.negative != b.negative && compareMagnitude(a.limbs, b.limbs) < 0) {
+					std::swap(a, b);
+				}
+
+				BigInteger result;
+				std::size_t size = std::max(a.limbs.size(), b.limbs.size());
+				int64_t carry    = 0;
+
+				result.negative = a.negative;
+				result.limbs.assign(size + 1, 0);
+
+				for (std::size_t i = 0; i < size; i++) {
+					int64_t x = i < a.limbs.size() ? a.limbs[i] : 0;
+					int64_t y = i < b.limbs.size() ? b.limbs[i] : 0;
+					int64_t current = a.negative == b.negative ? x + y + carry : x - y + carry;
+
+					result.limbs[i] = uint32_t(current);
+					carry           = current >> 32;
+				}
+
+				result.limbs[size] = uint32_t(carry);
+
+				return result.normalize();
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,207 @@
+#ifndef __PINT_RUNTIME_IO_H
+#define __PINT_RUNTIME_IO_H
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace pint {
+	/**
+	 * A userspace buffer in front of a file descriptor, backing the `io` unit.
+	 *
+	 * Lines are written as their parts, never joined into an intermediate string first: they are
+	 * copied into the buffer when they fit, otherwise the buffer and the parts go out together in
+	 * a single writev().
+	 */
+	class Output {
+		public:
+			enum class Mode {
+				UNBUFFERED,
+				LINE,
+				FULL
+			};
+
+			static constexpr std::size_t CAPACITY = 64 * 1024;
+
+			Output(int fd, Mode mode, std::size_t capacity = CAPACITY) {
+				this->fd   = fd;
+				this->mode = mode;
+
+				buffer.reserve(mode == Mode::UNBUFFERED ? 0 : capacity);
+			}
+
+			Output(const Output &) = delete;
+
+			~ Output() {
+				try {
+					flush();
+				} catch (...) {
+				}
+			}
+
+			void setMode(Mode mode) {
+				flush();
+
+				this->mode = mode;
+			}
+
+			void write(std::string_view part) {
+				write(std::span<const std::string_view>(&part, 1), {});
+			}
+
+			/**
+			 * Writes the parts followed by the end of line.
+			 */
+			void writeLn(std::span<const std::string_view> parts, std::string_view eol = "\n") {
+				write(parts, eol);
+
+				if (mode == Mode::LINE) {
+					flush();
+				}
+			}
+
+			void flush() {
+				if (!buffer.empty()) {
+					iovec vector = {buffer.data(), buffer.size()};
+
+					send(&vector, 1);
+					buffer.clear();
+				}
+			}
+
+		private:
+			int fd;
+			Mode mode;
+			std::vector<char> buffer;
+
+			void write(std::span<const std::string_view> parts, std::string_view eol) {
+				std::size_t size = eol.size();
+
+				for (auto &part: parts) {
+					size += part.size();
+				}
+
+				if (mode != Mode::UNBUFFERED && buffer.size() + size <= buffer.capacity()) {
+					for (auto &part: parts) {
+						buffer.insert(buffer.end(), part.begin(), part.end());
+					}
+
+					buffer.insert(buffer.end(), eol.begin(), eol.end());
+
+					return;
+				}
+
+				std::vector<iovec> vectors;
+
+				vectors.reserve(parts.size() + 2);
+
+				if (!buffer.empty()) {
+					vectors.push_back({buffer.data(), buffer.size()});
+				}
+
+				for (auto &part: parts) {
+					if (!part.empty()) {
+						vectors.push_back({const_cast<char *>(part.data()), part.size()});
+					}
+				}
+
+				if (!eol.empty()) {
+					vectors.push_back({const_cast<char *>(eol.data()), eol.size()});
+				}
+
+				send(vectors.data(), vectors.size());
+				buffer.clear();
+			}
+
+			/**
+			 * writev() everything, resuming after short writes and interruptions.
+			 */
+			void send(iovec *vectors, std::size_t count) {
+				while (count > 0) {
+					ssize_t written = ::writev(fd, vectors, int(std::min<std::size_t>(count, IOV_MAX)));
+
+					if (written < 0) {
+						if (errno == EINTR) {
+							continue;
+						}
+
+						throw std::runtime_error(std::string("Could not write: ") + std::strerror(errno));
+					}
+
+					while (count > 0 && std::size_t(written) >= vectors->iov_len) {
+						written -= vectors->iov_len;
+						vectors++;
+						count--;
+					}
+
+					if (count > 0) {
+						vectors->iov_base  = static_cast<char *>(vectors->iov_base) + written;
+						vectors->iov_len  -= written;
+					}
+				}
+			}
+	};
+
+	/**
+	 * The open outputs by file descriptor, flushed at exit.
+	 */
+	class Outputs {
+		public:
+			static Output &get(int fd) {
+				auto &outputs = all();
+				auto output   = outputs.find(fd);
+
+				if (output == outputs.end()) {
+					output = outputs.emplace(fd, std::make_unique<Output>(fd, defaultMode(fd))).first;
+				}
+
+				return *output->second;
+			}
+
+			/**
+			 * The standard descriptors are never really closed, so they keep their buffers.
+			 */
+			static void close(int fd) {
+				auto &outputs = all();
+				auto output   = outputs.find(fd);
+
+				if (fd <= STDERR_FILENO) {
+					return;
+				}
+
+				if (output != outputs.end()) {
+					output->second->flush();
+					outputs.erase(output);
+				}
+
+				::close(fd);
+			}
+
+		private:
+			static std::map<int, std::unique_ptr<Output>> &all() {
+				static std::map<int, std::unique_ptr<Output>> outputs;
+
+				return outputs;
+			}
+
+			/**
+			 * Terminals see every line as it is written, files and pipes are fully buffered.
+			 */
+			static Output::Mode defaultMode(int fd) {
+				return fd == STDERR_FILENO || ::isatty(fd) ? Output::Mode::LINE : Output::Mode::FULL;
+			}
+	};
+}
+
+#endif
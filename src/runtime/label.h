@@ -0,0 +1,52 @@
+#ifndef __PINT_RUNTIME_LABEL_H
+#define __PINT_RUNTIME_LABEL_H
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace pint {
+	/**
+	 * The static name table of a label family, emitted once per program.  Label values are
+	 * stored as their code, see Labels, so `Level#INFO` is a constant and turning a value back
+	 * into its name is an index.
+	 */
+	struct LabelFamily {
+		std::string_view name;
+		std::span<const std::string_view> names;
+
+		constexpr std::size_t span() const {
+			return names.size();
+		}
+
+		std::string_view nameOf(std::size_t code) const {
+			if (code >= names.size()) {
+				throw std::out_of_range("Not a value of label " + std::string(name));
+			}
+
+			return names[code];
+		}
+
+		constexpr std::optional<std::size_t> codeOf(std::string_view value) const {
+			for (std::size_t code = 0; code < names.size(); code++) {
+				if (names[code] == value) {
+					return code;
+				}
+			}
+
+			return std::nullopt;
+		}
+	};
+
+	/**
+	 * The type a value of a family with Span codes is stored in.
+	 */
+	template <std::size_t Span>
+	using LabelCode = std::conditional_t<Span <= 0x100, uint8_t, std::conditional_t<Span <= 0x10000, uint16_t, uint32_t>>;
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef __PINT_RUNTIME_MAP_H
+#define __PINT_RUNTIME_MAP_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "array.h"
+#include "string.h"
+
+namespace pint {
+	namespace bytes {
+		/**
+		 * out[i] = table[in[i]] for ASCII input.  With AVX2 the 128 entries are looked up 32 at
+		 * a time with byte shuffles: for every high nibble, bytes with that nibble stay below
+		 * 0x80 after the saturating add and pick their entry, the others are zeroed.  The same
+		 * with 16-byte SSSE3 shuffles was no faster than the scalar loop.
+		 */
+		inline void lookup(const char *in, char *out, std::size_t length, const std::array<uint8_t, 128> &table) {
+			std::size_t i = 0;
+
+			#if defined(__AVX2__)
+				__m256i rows[8];
+
+				for (int row = 0; row < 8; row++) {
+					rows[row] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(table.data() + 16 * row)));
+				}
+
+				for (; i + 32 <= length; i += 32) {
+					__m256i block  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i));
+					__m256i result = _mm256_setzero_si256();
+
+					for (int row = 0; row < 8; row++) {
+						__m256i index = _mm256_adds_epu8(_mm256_xor_si256(block, _mm256_set1_epi8(char(row << 4))), _mm256_set1_epi8(0x70));
+
+						result = _mm256_or_si256(result, _mm256_shuffle_epi8(rows[row], index));
+					}
+
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), result);
+				}
+			#endif
+
+			for (; i < length; i++) {
+				out[i] = char(table[uint8_t(in[i])]);
+			}
+		}
+	}
+
+	/**
+	 * `msg[f]` for a pure `f: function(c: char): char`.  The results for ASCII are tabulated
+	 * once, so mapping an ASCII string whose image is ASCII is a table lookup per byte, done 32
+	 * bytes at a time with AVX2.  Other strings call f per code point and are re-encoded.
+	 */
+	template <typename F>
+	class CharMap {
+		public:
+			CharMap(F function): function(function) {
+				for (char32_t code = 0; code < 128; code++) {
+					char32_t result = function(code);
+
+					table[code] = uint8_t(result);
+					ascii      &= result < 0x80;
+				}
+			}
+
+			String<8> operator()(const String<8> &string) const {
+				auto units = string.view();
+
+				if (ascii && string.isAscii()) {
+					std::string out(units.size(), '\0');
+
+					bytes::lookup(units.data(), out.data(), units.size(), table);
+
+					return String<8>::trusted(std::move(out), true);
+				}
+
+				std::string out;
+
+				out.reserve(units.size());
+
+				string.each([&](char32_t code) {
+					utf::encode(code < 0x80 && ascii ? char32_t(table[code]) : function(code), out);
+				});
+
+				return String<8>::trusted(std::move(out), false);
+			}
+
+		private:
+			F function;
+			std::array<uint8_t, 128> table;
+			bool ascii = true;
+	};
+
+	/**
+	 * `xs.map(f)` or `xs[f]` over an array, written as a plain loop over contiguous elements
+	 * so that an inlined, branch-free f is vectorized by the C++ compiler.
+	 */
+	template <typename T, std::size_t Span, typename F>
+	auto map(const Array<T, Span> &array, F function) {
+		using R = std::invoke_result_t<F &, const T &>;
+
+		Array<R, Span> result;
+
+		if constexpr (Span == DYNAMIC_SIZE) {
+			result.resize(array.span());
+		}
+
+		const T *in = array.data();
+		R *out      = result.data();
+
+		for (std::size_t i = 0; i < array.span(); i++) {
+			out[i] = function(in[i]);
+		}
+
+		return result;
+	}
+}
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef __PINT_RUNTIME_NUMERIC_H
+#define __PINT_RUNTIME_NUMERIC_H
+
+#include <cstdint>
+#include <string_view>
+
+#include "types.h"
+#include "integer.h"
+
+namespace pint {
+	/**
+	 * Storage width, in bits, of a numeric type with a fixed size.  Sizes which are not a
+	 * native width are rounded up to the next one, a dynamic size stays dynamic.
+	 */
+	constexpr std::size_t nativeWidth(std::size_t size) {
+		if (size == DYNAMIC_SIZE) return DYNAMIC_SIZE;
+		if (size <= 8)  return 8;
+		if (size <= 16) return 16;
+		if (size <= 32) return 32;
+		if (size <= 64) return 64;
+
+		return DYNAMIC_SIZE;
+	}
+
+	/**
+	 * Maps a base type and native width to the C++ type used to store and operate on it.
+	 */
+	template <Base B, std::size_t Width>
+	struct Native;
+
+	template <> struct Native<Base::INTEGER, 8>   { using type = int8_t; };
+	template <> struct Native<Base::INTEGER, 16>  { using type = int16_t; };
+	template <> struct Native<Base::INTEGER, 32>  { using type = int32_t; };
+	template <> struct Native<Base::INTEGER, 64>  { using type = int64_t; };
+	template <> struct Native<Base::CARDINAL, 8>  { using type = uint8_t; };
+	template <> struct Native<Base::CARDINAL, 16> { using type = uint16_t; };
+	template <> struct Native<Base::CARDINAL, 32> { using type = uint32_t; };
+	template <> struct Native<Base::CARDINAL, 64> { using type = uint64_t; };
+	template <> struct Native<Base::REAL, 32>     { using type = float; };
+	template <> struct Native<Base::REAL, 64>     { using type = double; };
+
+	/**
+	 * Only integers and cardinals of dynamic size take the arbitrary precision path.
+	 */
+	template <> struct Native<Base::INTEGER, DYNAMIC_SIZE>  { using type = BigInteger; };
+	template <> struct Native<Base::CARDINAL, DYNAMIC_SIZE> { using type = BigInteger; };
+	template <> struct Native<Base::REAL, DYNAMIC_SIZE>     { using type = double; };
+
+	/**
+	 * `integer(N)`, `cardinal(N)` and `real(N)`, e.g. Integer<8> is a plain int8_t.
+	 */
+	template <std::size_t Size = DYNAMIC_SIZE>
+	using Integer = typename Native<Base::INTEGER, nativeWidth(Size)>::type;
+
+	template <std::size_t Size = DYNAMIC_SIZE>
+	using Cardinal = typename Native<Base::CARDINAL, nativeWidth(Size)>::type;
+
+	template <std::size_t Size = DYNAMIC_SIZE>
+	using Real = typename Native<Base::REAL, Size == DYNAMIC_SIZE ? DYNAMIC_SIZE : Size <= 32 ? 32 : 64>::type;
+
+	/**
+	 * Name of the native type a code generator should emit for a numeric base and size.
+	 */
+	constexpr std::string_view nativeName(Base base, std::size_t size) {
+		std::size_t width = nativeWidth(size);
+
+		switch (base) {
+			case Base::INTEGER:
+				return width == 8 ? "int8_t" : width == 16 ? "int16_t" : width == 32 ? "int32_t" : width == 64 ? "int64_t" : "pint::BigInteger";
+			case Base::CARDINAL:
+				return width == 8 ? "uint8_t" : width == 16 ? "uint16_t" : width == 32 ? "uint32_t" : width == 64 ? "uint64_t" : "pint::BigInteger";
+			case Base::REAL:
+				return size == DYNAMIC_SIZE || size > 32 ? "double" : "float";
+			default:
+				return "";
+		}
+	}
+}
+
+#endif
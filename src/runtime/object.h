@@ -0,0 +1,481 @@
+#ifndef __PINT_RUNTIME_OBJECT_H
+#define __PINT_RUNTIME_OBJECT_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "dynamic.h"
+#include "result.h"
+#include "table.h"
+
+namespace pint {
+	/**
+	 * An interned property name.  Two symbols are the same name if and only if they are the same
+	 * pointer, and the hash is computed once, when the name is interned.  Symbols are boxed so a
+	 * name computed at runtime can be held in a Dynamic, and are never freed.
+	 */
+	class Symbol: public Boxed {
+		public:
+			static constexpr char TYPE = 0;
+
+			const std::string name;
+			const std::size_t hash;
+
+			static const Symbol *intern(std::string_view name) {
+				return intern(name, std::hash<std::string_view>()(name));
+			}
+
+			/**
+			 * Interns a name whose hash is already known, e.g. computed at compile time.
+			 */
+			static const Symbol *intern(std::string_view name, std::size_t hash) {
+				auto &table = symbols();
+
+				if (auto found = table.find(hash, [&](const Symbol *symbol) { return symbol->name == name; })) {
+					return *found;
+				}
+
+				auto symbol = new Symbol(std::string(name), hash);
+
+				symbol->retain();
+
+				return table.insert(hash, symbol, symbol);
+			}
+
+			/**
+			 * The symbol named by a dynamic value: a short string or a Symbol.
+			 */
+			static const Symbol *of(Dynamic name) {
+				if (name.kind() == Dynamic::Kind::STRING) {
+					uint64_t bits = name.raw();
+					char text[sizeof(bits)];
+
+					std::memcpy(text, &bits, sizeof(bits));
+
+					return intern(std::string_view(text, std::size_t((bits >> 40) & 0xFF)));
+				}
+
+				if (name.kind() == Dynamic::Kind::BOXED) {
+					auto boxed = static_cast<const Boxed *>(name.toBoxed());
+
+					if (boxed->type == &TYPE) {
+						return static_cast<const Symbol *>(boxed);
+					}
+				}
+
+				throw std::invalid_argument("Dynamic identifier is not a string");
+			}
+
+		private:
+			Symbol(std::string name, std::size_t hash): Boxed(&TYPE), name(name), hash(hash) {}
+
+			static Table<const Symbol *, const Symbol *> &symbols() {
+				static Table<const Symbol *, const Symbol *> table;
+
+				return table;
+			}
+	};
+
+	/**
+	 * A hidden class: the ordered set of properties an object has.  Objects which got the same
+	 * properties in the same order share a shape, found by following the transition for each
+	 * added property from the empty root.  Shapes are never freed.
+	 */
+	class Shape {
+		public:
+			static constexpr uint32_t MISSING = uint32_t(-1);
+
+			static Shape *root() {
+				static Shape empty(nullptr, nullptr);
+
+				return &empty;
+			}
+
+			std::size_t size() const {
+				return slots;
+			}
+
+			/**
+			 * The shape after adding key, shared by every object taking the same transition.
+			 */
+			Shape *with(const Symbol *key) {
+				auto &next = transitions[key];
+
+				if (!next) {
+					next = std::unique_ptr<Shape>(new Shape(this, key));
+				}
+
+				return next.get();
+			}
+
+			/**
+			 * The slot of key, the slow path behind the inline caches.
+			 */
+			uint32_t find(const Symbol *key) const {
+				if (slots <= LINEAR) {
+					for (const Shape *shape = this; shape->key; shape = shape->parent) {
+						if (shape->key == key) {
+							return shape->slots - 1;
+						}
+					}
+
+					return MISSING;
+				}
+
+				if (table.empty()) {
+					for (const Shape *shape = this; shape->key; shape = shape->parent) {
+						table.insert(shape->key->hash, shape->key, shape->slots - 1);
+					}
+				}
+
+				auto found = table.find(key->hash, [&](const Symbol *other) { return other == key; });
+
+				return found ? *found : MISSING;
+			}
+
+			/**
+			 * Keys in slot order, built once per shape.
+			 */
+			const std::vector<const Symbol *> &keys() const {
+				if (order.size() != slots) {
+					order.resize(slots);
+
+					for (const Shape *shape = this; shape->key; shape = shape->parent) {
+						order[shape->slots - 1] = shape->key;
+					}
+				}
+
+				return order;
+			}
+
+		private:
+			/**
+			 * Shapes up to this many properties are searched by walking up to the root, larger ones
+			 * build a table on first use.
+			 */
+			static constexpr std::size_t LINEAR = 8;
+
+			Shape *parent;
+			const Symbol *key;
+			std::size_t slots;
+			std::unordered_map<const Symbol *, std::unique_ptr<Shape>> transitions;
+			mutable Table<const Symbol *, uint32_t> table;
+			mutable std::vector<const Symbol *> order;
+
+			Shape(Shape *parent, const Symbol *key) {
+				this->parent = parent;
+				this->key    = key;
+				this->slots  = parent ? parent->slots + 1 : 0;
+			}
+	};
+
+	/**
+	 * A plain `object`, `new object()` or `(left := x, right := y)`.  Property values are stored
+	 * in slots, in the order given by the object's shape.
+	 */
+	class Object: public Boxed {
+		public:
+			static constexpr char TYPE = 0;
+
+			Object(): Boxed(&TYPE) {
+				shape = Shape::root();
+			}
+
+			Shape *getShape() const {
+				return shape;
+			}
+
+			Dynamic get(const Symbol *key) const {
+				uint32_t slot = shape->find(key);
+
+				return slot == Shape::MISSING ? Dynamic() : slots[slot];
+			}
+
+			void set(const Symbol *key, Dynamic value) {
+				uint32_t slot = shape->find(key);
+
+				if (slot == Shape::MISSING) {
+					add(key, value);
+				} else {
+					slots[slot] = value;
+				}
+			}
+
+			Dynamic &slot(uint32_t index) {
+				return slots[index];
+			}
+
+			const Dynamic &slot(uint32_t index) const {
+				return slots[index];
+			}
+
+			std::size_t size() const {
+				return slots.size();
+			}
+
+			/**
+			 * `for var key of o` and `for var value in o`: calls f with each key and value, in
+			 * the order they were added, straight from the shape and the slots, until f returns
+			 * false.
+			 */
+			template <typename F>
+			void each(F &&f) const {
+				auto &keys = shape->keys();
+
+				for (std::size_t i = 0; i < slots.size(); i++) {
+					if constexpr (std::is_void_v<std::invoke_result_t<F &, const Symbol *, const Dynamic &>>) {
+						f(keys[i], slots[i]);
+					} else if (!f(keys[i], slots[i])) {
+						return;
+					}
+				}
+			}
+
+			/**
+			 * Adds a property known to be missing, moving to the next shape.
+			 */
+			void add(const Symbol *key, Dynamic value) {
+				shape = shape->with(key);
+
+				slots.push_back(value);
+			}
+
+			void transition(Shape *next, Dynamic value) {
+				shape = next;
+
+				slots.push_back(value);
+			}
+
+		private:
+			Shape *shape;
+			std::vector<Dynamic> slots;
+	};
+
+	/**
+	 * The cache attached to one `value.identifier` site.  It remembers the slot of the property
+	 * for up to WAYS shapes (monomorphic with one, polymorphic beyond), so a read on a known
+	 * shape is a shape compare and a load.  Sites seeing more shapes go megamorphic and always
+	 * take the slow path.
+	 */
+	class InlineCache {
+		public:
+			static constexpr std::size_t WAYS = 4;
+
+			InlineCache(const Symbol *key) {
+				this->key = key;
+			}
+
+			/**
+			 * Loads the property, skipping transition entries, which are cached for shapes
+			 * that do not have it.
+			 */
+			Dynamic get(const Object &object) {
+				Shape *shape = object.getShape();
+
+				for (std::size_t i = 0; i < used; i++) {
+					if (entries[i].shape == shape && !entries[i].next) {
+						return object.slot(entries[i].slot);
+					}
+				}
+
+				uint32_t slot = shape->find(key);
+
+				if (slot == Shape::MISSING) {
+					return Dynamic();
+				}
+
+				remember(shape, slot, nullptr);
+
+				return object.slot(slot);
+			}
+
+			/**
+			 * Stores to an existing property, or adds it following a cached transition.
+			 */
+			void set(Object &object, Dynamic value) {
+				Shape *shape = object.getShape();
+
+				for (std::size_t i = 0; i < used; i++) {
+					if (entries[i].shape == shape) {
+						if (entries[i].next) {
+							object.transition(entries[i].next, value);
+						} else {
+							object.slot(entries[i].slot) = value;
+						}
+
+						return;
+					}
+				}
+
+				uint32_t slot = shape->find(key);
+
+				if (slot == Shape::MISSING) {
+					object.add(key, value);
+					remember(shape, 0, object.getShape());
+				} else {
+					object.slot(slot) = value;
+					remember(shape, slot, nullptr);
+				}
+			}
+
+			bool isMonomorphic() const {
+				return used == 1;
+			}
+
+			bool isMegamorphic() const {
+				return megamorphic;
+			}
+
+		private:
+			struct Entry {
+				Shape *shape;
+				uint32_t slot;
+				Shape *next;
+			};
+
+			const Symbol *key;
+			std::array<Entry, WAYS> entries;
+			std::size_t used = 0;
+			bool megamorphic = false;
+
+			void remember(Shape *shape, uint32_t slot, Shape *next) {
+				if (used < WAYS) {
+					entries[used++] = {shape, slot, next};
+				} else {
+					megamorphic = true;
+				}
+			}
+	};
+
+	/**
+	 * The cache attached to one `$name` or `value.$name` site, where the property is only known
+	 * at runtime.  Entries are keyed on the identity of the name value, its Dynamic bits, which
+	 * for short strings are their contents and otherwise the interned Symbol, together with the
+	 * shape, so a repeated lookup neither hashes nor compares strings.
+	 *
+	 * Reflective code walking many names through one site overflows the WAYS entries; the site
+	 * then allocates a direct-mapped table of LINES entries instead of giving up on caching.
+	 */
+	class DynamicCache {
+		public:
+			static constexpr std::size_t WAYS = 4;
+			static constexpr std::size_t LINES = 256;
+
+			Dynamic get(const Object &object, Dynamic name) {
+				Shape *shape = object.getShape();
+
+				if (auto entry = lookup(name, shape)) {
+					return object.slot(entry->slot);
+				}
+
+				uint32_t slot = shape->find(resolve(name));
+
+				if (slot == Shape::MISSING) {
+					return Dynamic();
+				}
+
+				remember(name, shape, slot);
+
+				return object.slot(slot);
+			}
+
+			void set(Object &object, Dynamic name, Dynamic value) {
+				Shape *shape = object.getShape();
+
+				if (auto entry = lookup(name, shape)) {
+					object.slot(entry->slot) = value;
+
+					return;
+				}
+
+				auto key      = resolve(name);
+				uint32_t slot = shape->find(key);
+
+				if (slot == Shape::MISSING) {
+					object.add(key, value);
+				} else {
+					object.slot(slot) = value;
+					remember(name, shape, slot);
+				}
+			}
+
+			/**
+			 * The symbol for name, remembering the last one resolved.
+			 */
+			const Symbol *resolve(Dynamic name) {
+				if (!symbol || name.raw() != last) {
+					symbol = Symbol::of(name);
+					last   = name.raw();
+				}
+
+				return symbol;
+			}
+
+			bool isMegamorphic() const {
+				return lines != nullptr;
+			}
+
+		private:
+			struct Entry {
+				uint64_t name;
+				Shape *shape;
+				uint32_t slot;
+			};
+
+			std::array<Entry, WAYS> entries;
+			std::size_t used = 0;
+			std::unique_ptr<std::array<Entry, LINES>> lines;
+			uint64_t last = 0;
+			const Symbol *symbol = nullptr;
+
+			static std::size_t line(Dynamic name, Shape *shape) {
+				uint64_t key = (name.raw() ^ reinterpret_cast<uintptr_t>(shape)) * 0x9E3779B97F4A7C15;
+
+				return key >> (64 - std::countr_zero(LINES));
+			}
+
+			const Entry *lookup(Dynamic name, Shape *shape) const {
+				for (std::size_t i = 0; i < used; i++) {
+					if (entries[i].name == name.raw() && entries[i].shape == shape) {
+						return &entries[i];
+					}
+				}
+
+				if (lines) {
+					auto &entry = (*lines)[line(name, shape)];
+
+					if (entry.name == name.raw() && entry.shape == shape) {
+						return &entry;
+					}
+				}
+
+				return nullptr;
+			}
+
+			void remember(Dynamic name, Shape *shape, uint32_t slot) {
+				if (used < WAYS) {
+					entries[used++] = {name.raw(), shape, slot};
+
+					return;
+				}
+
+				if (!lines) {
+					lines = std::make_unique<std::array<Entry, LINES>>();
+				}
+
+				(*lines)[line(name, shape)] = {name.raw(), shape, slot};
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef __PINT_RUNTIME_PIPELINE_H
+#define __PINT_RUNTIME_PIPELINE_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "array.h"
+#include "string.h"
+
+namespace pint {
+	namespace pipeline {
+		/**
+		 * The stages of a Pipeline.  Each has the Element type it produces, pushes its elements
+		 * into a sink until the sink returns false, and bounds how many elements it has.
+		 */
+		template <typename T, std::size_t Span>
+		struct Elements {
+			using Element = T;
+
+			const Array<T, Span> &array;
+
+			template <typename Sink>
+			bool each(Sink &sink) const {
+				for (std::size_t i = 0; i < array.span(); i++) {
+					if (!sink(array[i])) {
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			std::size_t bound() const {
+				return array.span();
+			}
+		};
+
+		struct Codes {
+			using Element = char32_t;
+
+			const String<8> &string;
+
+			template <typename Sink>
+			bool each(Sink &sink) const {
+				bool done = true;
+
+				string.each([&](char32_t code) {
+					return done = sink(code);
+				});
+
+				return done;
+			}
+
+			std::size_t bound() const {
+				return string.units();
+			}
+		};
+
+		template <typename S, typename F>
+		struct Mapped {
+			using Element = std::decay_t<std::invoke_result_t<const F &, typename S::Element>>;
+
+			S source;
+			F function;
+
+			template <typename Sink>
+			bool each(Sink &sink) const {
+				auto next = [&](auto &&value) {
+					return sink(function(std::forward<decltype(value)>(value)));
+				};
+
+				return source.each(next);
+			}
+
+			std::size_t bound() const {
+				return source.bound();
+			}
+		};
+
+		template <typename S, typename F>
+		struct Filtered {
+			using Element = typename S::Element;
+
+			S source;
+			F predicate;
+
+			template <typename Sink>
+			bool each(Sink &sink) const {
+				auto next = [&](auto &&value) {
+					return !predicate(value) || sink(std::forward<decltype(value)>(value));
+				};
+
+				return source.each(next);
+			}
+
+			std::size_t bound() const {
+				return source.bound();
+			}
+		};
+	}
+
+	/**
+	 * A fused chain of `map` and `filter` over an array or a string, see Pipelines.  Elements
+	 * are pushed through every stage in a single pass and no stage allocates; only collect()
+	 * builds an array, for a chain whose result is stored or escapes.
+	 */
+	template <typename Source>
+	class Pipeline {
+		public:
+			using Element = typename Source::Element;
+
+			explicit Pipeline(Source source): source(std::move(source)) {}
+
+			template <typename F>
+			auto map(F function) && {
+				return Pipeline<pipeline::Mapped<Source, F>>({std::move(source), std::move(function)});
+			}
+
+			template <typename F>
+			auto filter(F predicate) && {
+				return Pipeline<pipeline::Filtered<Source, F>>({std::move(source), std::move(predicate)});
+			}
+
+			/**
+			 * `for var x in <chain>`: calls f with every element, until f returns false as
+			 * `break` does.
+			 */
+			template <typename F>
+			void each(F &&f) const {
+				auto sink = [&](auto &&value) {
+					if constexpr (std::is_void_v<decltype(f(std::forward<decltype(value)>(value)))>) {
+						f(std::forward<decltype(value)>(value));
+
+						return true;
+					} else {
+						return bool(f(std::forward<decltype(value)>(value)));
+					}
+				};
+
+				source.each(sink);
+			}
+
+			template <typename F, typename R>
+			R reduce(F function, R initial) const {
+				auto sink = [&](auto &&value) {
+					initial = function(std::move(initial), std::forward<decltype(value)>(value));
+
+					return true;
+				};
+
+				source.each(sink);
+
+				return initial;
+			}
+
+			/**
+			 * The elements as an array, reserved for as many as the source has since a filter
+			 * only drops some.
+			 */
+			Array<Element> collect() const {
+				Array<Element> result;
+
+				result.reserve(source.bound());
+
+				auto sink = [&](auto &&value) {
+					result.push(std::forward<decltype(value)>(value));
+
+					return true;
+				};
+
+				source.each(sink);
+
+				return result;
+			}
+
+		private:
+			Source source;
+	};
+
+	/**
+	 * The start of a chain, which must not outlive the array or string.
+	 */
+	template <typename T, std::size_t Span>
+	auto lazy(const Array<T, Span> &array) {
+		return Pipeline<pipeline::Elements<T, Span>>({array});
+	}
+
+	inline auto lazy(const String<8> &string) {
+		return Pipeline<pipeline::Codes>({string});
+	}
+}
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef __PINT_RUNTIME_RECORD_H
+#define __PINT_RUNTIME_RECORD_H
+
+#include <cstddef>
+#include <new>
+#include <string>
+
+#include "result.h"
+
+namespace pint {
+	/**
+	 * What the compiler emits for every record: its fixed layout, see Records, the generated
+	 * constructor which stores the defaults, and the record it extends first, whose fields are
+	 * a prefix of this one's.
+	 */
+	struct RecordType {
+		std::string name;
+		std::size_t bytes;
+		std::size_t align;
+		const RecordType *base = nullptr;
+
+		/**
+		 * Constructs every field in place, in declaration order.  Only records with fields
+		 * that own something need a destroy.
+		 */
+		void (*construct)(std::byte *fields) = nullptr;
+		void (*destroy)(std::byte *fields) = nullptr;
+	};
+
+	/**
+	 * A record instance.  The fields follow the header in the same allocation, so creating a
+	 * record is one allocation and reading a field is one load at a constant offset.
+	 */
+	class Record: public Boxed {
+		public:
+			static Record *make(const RecordType &type) {
+				void *memory = ::operator new(header() + type.bytes);
+				auto record  = new (memory) Record(type);
+
+				if (type.construct) {
+					type.construct(record->fields());
+				}
+
+				return record;
+			}
+
+			~ Record() {
+				if (getType().destroy) {
+					getType().destroy(fields());
+				}
+			}
+
+			static void operator delete(void *memory) {
+				::operator delete(memory);
+			}
+
+			const RecordType &getType() const {
+				return *static_cast<const RecordType *>(type);
+			}
+
+			/**
+			 * `on x is T`, true for T and the records it extends first.
+			 */
+			bool is(const RecordType &other) const {
+				for (auto current = &getType(); current; current = current->base) {
+					if (current == &other) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			template <typename T>
+			T &field(std::size_t offset) {
+				return *std::launder(reinterpret_cast<T *>(fields() + offset));
+			}
+
+			template <typename T>
+			const T &field(std::size_t offset) const {
+				return *std::launder(reinterpret_cast<const T *>(fields() + offset));
+			}
+
+			std::byte *fields() {
+				return reinterpret_cast<std::byte *>(this) + header();
+			}
+
+			const std::byte *fields() const {
+				return reinterpret_cast<const std::byte *>(this) + header();
+			}
+
+		private:
+			static constexpr std::size_t ALIGN = alignof(std::max_align_t);
+
+			/**
+			 * Offset of the fields, so they have any alignment a field can need.
+			 */
+			static constexpr std::size_t header() {
+				return (sizeof(Record) + ALIGN - 1) / ALIGN * ALIGN;
+			}
+
+			Record(const RecordType &type): Boxed(&type) {}
+
+			bool extends(const void *type) const override {
+				return is(*static_cast<const RecordType *>(type));
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef __PINT_RUNTIME_RESULT_H
+#define __PINT_RUNTIME_RESULT_H
+
+#include <string>
+#include <utility>
+
+#include "dynamic.h"
+
+namespace pint {
+	/**
+	 * Head of heap values that can be returned as an alternative.  The type tag makes `on x is T`
+	 * a single comparison for the exact type, only a value of another type follows the types it
+	 * extends.  The reference count lets results share them without a collector.
+	 */
+	class Boxed {
+		public:
+			const void *const type;
+			mutable std::size_t references = 0;
+
+			virtual ~ Boxed() {}
+
+			/**
+			 * `on x is T`, true for a T or a value of a type extending T.
+			 */
+			bool is(const void *type) const {
+				return this->type == type || extends(type);
+			}
+
+			void retain() const {
+				references++;
+			}
+
+			void release() const {
+				if (--references == 0) {
+					delete this;
+				}
+			}
+
+		protected:
+			Boxed(const void *type): type(type) {}
+
+			/**
+			 * Types with no parents never extend another.
+			 */
+			virtual bool extends(const void *) const {
+				return false;
+			}
+	};
+
+	/**
+	 * The built-in Error, chained through getPrevious().  Errors are only ever allocated when a
+	 * function actually fails.
+	 *
+	 * Errors of a more specific kind extend it with a Type naming Error's, or another one's, as
+	 * the parent, so `on x is Error` holds for them too.
+	 */
+	class Error: public Boxed {
+		public:
+			struct Type {
+				const Type *parent;
+			};
+
+			static constexpr Type TYPE = {nullptr};
+
+			Error(std::string message, std::string function = "", const Error *previous = nullptr): Error(&TYPE, std::move(message), std::move(function), previous) {}
+
+			~ Error() {
+				if (previous) {
+					previous->release();
+				}
+			}
+
+			const std::string &getMessage() const {
+				return message;
+			}
+
+			const std::string &getFunction() const {
+				return function;
+			}
+
+			const Error *getPrevious() const {
+				return previous;
+			}
+
+		protected:
+			Error(const Type *type, std::string message, std::string function, const Error *previous): Boxed(type) {
+				this->message  = std::move(message);
+				this->function = std::move(function);
+				this->previous = previous;
+
+				if (previous) {
+					previous->retain();
+				}
+			}
+
+			bool extends(const void *type) const override {
+				for (auto parent = static_cast<const Type *>(this->type)->parent; parent; parent = parent->parent) {
+					if (parent == type) {
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+		private:
+			std::string message;
+			std::string function;
+			const Error *previous;
+	};
+
+	/**
+	 * The return value of a function declared `?T`: either a T or an arbitrary alternative.
+	 *
+	 * The T is stored unboxed next to a single Dynamic word, which is void on success, so the
+	 * success path never allocates and checking it is one compare.  Boxed alternatives are
+	 * reference counted by the results holding them.
+	 */
+	template <typename T>
+	class Result {
+		public:
+			Result(T value): value(std::move(value)) {}
+
+			/**
+			 * Shares a boxed alternative with whoever else holds it.
+			 */
+			Result(Dynamic alternative) {
+				this->alternative = alternative;
+
+				if (auto boxed = this->boxed()) {
+					boxed->retain();
+				}
+			}
+
+			/**
+			 * Takes a newly allocated alternative, e.g. `return new Error(...)`.
+			 */
+			Result(const Boxed *alternative) {
+				alternative->retain();
+
+				this->alternative = Dynamic::fromBoxed(alternative);
+			}
+
+			Result(const Result &other): value(other.value), alternative(other.alternative) {
+				if (auto boxed = other.boxed()) {
+					boxed->retain();
+				}
+			}
+
+			Result &operator=(Result other) {
+				std::swap(value, other.value);
+				std::swap(alternative, other.alternative);
+
+				return *this;
+			}
+
+			~ Result() {
+				if (auto boxed = this->boxed()) {
+					boxed->release();
+				}
+			}
+
+			bool ok() const {
+				return alternative.isVoid();
+			}
+
+			explicit operator bool() const {
+				return ok();
+			}
+
+			const T &get() const {
+				return value;
+			}
+
+			Dynamic getAlternative() const {
+				return alternative;
+			}
+
+			/**
+			 * `on result is B`, the alternative as a B or null.
+			 */
+			template <typename B>
+			const B *is() const {
+				auto boxed = this->boxed();
+
+				return boxed && boxed->is(&B::TYPE) ? static_cast<const B *>(boxed) : nullptr;
+			}
+
+		private:
+			T value{};
+			Dynamic alternative;
+
+			const Boxed *boxed() const {
+				if (alternative.kind() != Dynamic::Kind::BOXED) {
+					return nullptr;
+				}
+
+				return static_cast<const Boxed *>(alternative.toBoxed());
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef __PINT_RUNTIME_ROPE_H
+#define __PINT_RUNTIME_ROPE_H
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "string.h"
+
+namespace pint {
+	/**
+	 * A string built from a deep tree of concatenations.  Concatenating two ropes is O(1), the tree
+	 * is only flattened into a single String the first time it is read, and the flat value then
+	 * replaces the tree.  Pieces are freed with an explicit stack, since a rope built by appending
+	 * in a loop is a spine as deep as the number of appends.
+	 */
+	template <std::size_t Size = 8>
+	class Rope {
+		public:
+			Rope(String<Size> value = {}) {
+				piece = std::make_shared<Piece>();
+
+				piece->units = value.units();
+				piece->flat  = std::move(value);
+			}
+
+			Rope(const Rope &) = default;
+			Rope(Rope &&) = default;
+
+			~Rope() {
+				release(piece);
+			}
+
+			Rope &operator=(Rope other) {
+				std::swap(piece, other.piece);
+
+				return *this;
+			}
+
+			friend Rope operator+(const Rope &a, const Rope &b) {
+				Rope result;
+
+				result.piece->units = a.piece->units + b.piece->units;
+				result.piece->left  = a.piece;
+				result.piece->right = b.piece;
+
+				return result;
+			}
+
+			Rope &operator+=(const Rope &other) {
+				return *this = *this + other;
+			}
+
+			/**
+			 * Code units of the whole rope, known without flattening.
+			 */
+			std::size_t units() const {
+				return piece->units;
+			}
+
+			const String<Size> &flatten() const {
+				if (piece->left) {
+					String<Size> flat;
+					std::vector<const Piece *> stack = {piece.get()};
+
+					flat.reserve(piece->units);
+
+					while (!stack.empty()) {
+						const Piece *current = stack.back();
+
+						stack.pop_back();
+
+						if (current->left) {
+							stack.push_back(current->right.get());
+							stack.push_back(current->left.get());
+						} else {
+							flat += current->flat;
+						}
+					}
+
+					piece->flat = std::move(flat);
+					release(piece->left);
+					release(piece->right);
+				}
+
+				return piece->flat;
+			}
+
+			std::size_t span() const {
+				return flatten().span();
+			}
+
+			char32_t at(std::size_t index) const {
+				return flatten().at(index);
+			}
+
+		private:
+			/**
+			 * Either a leaf holding a flat string or a concatenation of two pieces.
+			 */
+			struct Piece {
+				String<Size> flat;
+				std::shared_ptr<Piece> left;
+				std::shared_ptr<Piece> right;
+				std::size_t units = 0;
+			};
+
+			std::shared_ptr<Piece> piece;
+
+			/**
+			 * Drops the reference, freeing every piece only it kept alive without recursing.
+			 */
+			static void release(std::shared_ptr<Piece> &root) {
+				std::vector<std::shared_ptr<Piece>> stack;
+
+				stack.push_back(std::move(root));
+
+				while (!stack.empty()) {
+					auto current = std::move(stack.back());
+
+					stack.pop_back();
+
+					if (current.use_count() == 1 && current->left) {
+						stack.push_back(std::move(current->left));
+						stack.push_back(std::move(current->right));
+					}
+				}
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,457 @@
+#ifndef __PINT_RUNTIME_STRING_H
+#define __PINT_RUNTIME_STRING_H
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "types.h"
+
+namespace pint {
+	/**
+	 * UTF-8 and UTF-16 kernels.  With SSE2 the UTF-8 ones skip ASCII and count code points 16
+	 * bytes at a time (ASCII is skipped 8 bytes at a time elsewhere), only multi-byte sequences
+	 * are ever decoded one by one.
+	 */
+	namespace utf {
+		struct Scan {
+			std::size_t span;
+			bool ascii;
+		};
+
+		/**
+		 * Number of leading bytes that are ASCII.
+		 */
+		inline std::size_t asciiPrefix(const char *data, std::size_t length) {
+			std::size_t i = 0;
+
+			#if defined(__SSE2__)
+				for (; i + 16 <= length; i += 16) {
+					int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)));
+
+					if (mask) {
+						return i + std::countr_zero(unsigned(mask));
+					}
+				}
+			#else
+				for (; i + 8 <= length; i += 8) {
+					uint64_t word;
+
+					std::memcpy(&word, data + i, 8);
+
+					if (word & 0x8080808080808080) {
+						break;
+					}
+				}
+			#endif
+
+			while (i < length && !(data[i] & 0x80)) {
+				i++;
+			}
+
+			return i;
+		}
+
+		/**
+		 * Code points in valid UTF-8 are the bytes which are not continuation bytes (10xxxxxx).
+		 */
+		inline Scan scan(const char *data, std::size_t length) {
+			std::size_t i             = asciiPrefix(data, length);
+			std::size_t continuations = 0;
+
+			if (i == length) {
+				return {length, true};
+			}
+
+			#if defined(__SSE2__)
+				const __m128i lead = _mm_set1_epi8(int8_t(0xC0));
+
+				for (; i + 16 <= length; i += 16) {
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+
+					continuations += std::popcount(unsigned(_mm_movemask_epi8(_mm_cmplt_epi8(block, lead))));
+				}
+			#endif
+
+			for (; i < length; i++) {
+				continuations += (uint8_t(data[i]) & 0xC0) == 0x80;
+			}
+
+			return {length - continuations, false};
+		}
+
+		inline Scan scan(const char16_t *data, std::size_t length) {
+			std::size_t trailing = 0;
+			bool ascii           = true;
+
+			for (std::size_t i = 0; i < length; i++) {
+				trailing += (data[i] & 0xFC00) == 0xDC00;
+				ascii    &= data[i] < 0x80;
+			}
+
+			return {length - trailing, ascii};
+		}
+
+		/**
+		 * Checks for truncated, overlong and surrogate sequences and out of range code points.
+		 */
+		inline bool validate(const char *data, std::size_t length) {
+			for (std::size_t i = asciiPrefix(data, length); i < length;) {
+				uint8_t lead = data[i];
+
+				if (lead < 0x80) {
+					i += asciiPrefix(data + i, length - i);
+					continue;
+				}
+
+				std::size_t size = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC2 ? 2 : 0;
+
+				if (!size || lead > 0xF4 || i + size > length) {
+					return false;
+				}
+
+				uint32_t code = lead & (0x7F >> size);
+
+				for (std::size_t j = 1; j < size; j++) {
+					if ((uint8_t(data[i + j]) & 0xC0) != 0x80) {
+						return false;
+					}
+
+					code = (code << 6) | (data[i + j] & 0x3F);
+				}
+
+				if ((size == 3 && (code < 0x800 || (code >= 0xD800 && code <= 0xDFFF))) || (size == 4 && (code < 0x10000 || code > 0x10FFFF))) {
+					return false;
+				}
+
+				i += size;
+			}
+
+			return true;
+		}
+
+		inline bool validate(const char16_t *data, std::size_t length) {
+			for (std::size_t i = 0; i < length; i++) {
+				if ((data[i] & 0xFC00) == 0xD800) {
+					if (++i == length || (data[i] & 0xFC00) != 0xDC00) {
+						return false;
+					}
+				} else if ((data[i] & 0xFC00) == 0xDC00) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		/**
+		 * Decodes the code point at offset, advancing offset past it.
+		 */
+		inline char32_t decode(const char *data, std::size_t &offset) {
+			uint8_t lead     = data[offset++];
+			std::size_t size = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+			char32_t code    = size == 1 ? lead : lead & (0x7F >> size);
+
+			for (std::size_t j = 1; j < size; j++) {
+				code = (code << 6) | (data[offset++] & 0x3F);
+			}
+
+			return code;
+		}
+
+		inline char32_t decode(const char16_t *data, std::size_t &offset) {
+			char32_t code = data[offset++];
+
+			if ((code & 0xFC00) == 0xD800) {
+				code = 0x10000 + ((code - 0xD800) << 10) + (data[offset++] - 0xDC00);
+			}
+
+			return code;
+		}
+
+		/**
+		 * Appends the code point, which must be valid, to out.
+		 */
+		inline void encode(char32_t code, std::string &out) {
+			if (code < 0x80) {
+				out += char(code);
+			} else if (code < 0x800) {
+				out += char(0xC0 | (code >> 6));
+				out += char(0x80 | (code & 0x3F));
+			} else if (code < 0x10000) {
+				out += char(0xE0 | (code >> 12));
+				out += char(0x80 | ((code >> 6) & 0x3F));
+				out += char(0x80 | (code & 0x3F));
+			} else {
+				out += char(0xF0 | (code >> 18));
+				out += char(0x80 | ((code >> 12) & 0x3F));
+				out += char(0x80 | ((code >> 6) & 0x3F));
+				out += char(0x80 | (code & 0x3F));
+			}
+		}
+
+		inline void encode(char32_t code, std::u16string &out) {
+			if (code < 0x10000) {
+				out += char16_t(code);
+			} else {
+				out += char16_t(0xD800 + ((code - 0x10000) >> 10));
+				out += char16_t(0xDC00 + ((code - 0x10000) & 0x3FF));
+			}
+		}
+
+		inline bool isContinuation(char unit) {
+			return (uint8_t(unit) & 0xC0) == 0x80;
+		}
+
+		inline bool isContinuation(char16_t unit) {
+			return (unit & 0xFC00) == 0xDC00;
+		}
+	}
+
+	/**
+	 * `string(Size)`, i.e. `char(Size)[]`: code units of Size bits holding valid UTF-8 or UTF-16.
+	 *
+	 * Units live in a std::basic_string, so short strings stay inline (small-string optimization).
+	 * The span (code points) and whether every code point is a single unit are computed lazily
+	 * and cached, and are kept up to date by operations that can do so cheaply.  When every code
+	 * point is a single unit (always the case for ASCII) indexing is O(1).
+	 */
+	template <std::size_t Size = 8>
+	class String {
+		public:
+			static_assert(Size == 8 || Size == 16, "Strings have 8 or 16 bit code units");
+
+			using Unit = std::conditional_t<Size == 8, char, char16_t>;
+
+			String() {
+				cachedSpan = 0;
+				ascii      = YES;
+			}
+
+			/**
+			 * Throws if the units are not valid UTF.
+			 */
+			String(std::basic_string_view<Unit> units) {
+				if (!utf::validate(units.data(), units.size())) {
+					throw std::invalid_argument("String is not valid UTF");
+				}
+
+				this->store = units;
+			}
+
+			String(const Unit *units): String(std::basic_string_view<Unit>(units)) {}
+
+			/**
+			 * Takes units known to be valid, such as the output of a map over a valid string,
+			 * without checking them again.
+			 */
+			static String trusted(std::basic_string<Unit> units, bool ascii) {
+				String result;
+
+				result.store      = std::move(units);
+				result.cachedSpan = ascii ? result.store.size() : UNKNOWN;
+				result.ascii      = ascii ? YES : UNSURE;
+
+				return result;
+			}
+
+			std::size_t span() const {
+				if (cachedSpan == UNKNOWN) {
+					utf::Scan scan = utf::scan(store.data(), store.size());
+
+					cachedSpan = scan.span;
+					ascii      = scan.ascii ? YES : NO;
+				}
+
+				return cachedSpan;
+			}
+
+			bool isAscii() const {
+				if (ascii == UNSURE) {
+					if constexpr (Size == 8) {
+						ascii = span() == store.size() ? YES : NO;
+					} else {
+						ascii = utf::scan(store.data(), store.size()).ascii ? YES : NO;
+					}
+				}
+
+				return ascii == YES;
+			}
+
+			/**
+			 * Bytes or code units, as opposed to the span.
+			 */
+			std::size_t units() const {
+				return store.size();
+			}
+
+			/**
+			 * The code point at index, O(1) when every code point is a single unit.
+			 */
+			char32_t at(std::size_t index) const {
+				if (index >= span()) {
+					throw std::out_of_range("Index is outside the span of the string");
+				}
+
+				std::size_t offset = span() == store.size() ? index : locate(index);
+
+				return utf::decode(store.data(), offset);
+			}
+
+			/**
+			 * Removes and returns the last count code points.
+			 */
+			String pop(std::size_t count) {
+				std::size_t known = cachedSpan;
+				std::size_t start = store.size();
+
+				for (std::size_t i = 0; i < count && start > 0; i++) {
+					while (--start > 0 && utf::isContinuation(store[start]));
+				}
+
+				String result;
+
+				result.store      = store.substr(start);
+				result.cachedSpan = UNKNOWN;
+				result.ascii      = ascii == YES ? YES : UNSURE;
+				store.resize(start);
+
+				if (known != UNKNOWN) {
+					result.cachedSpan = std::min(count, known);
+					cachedSpan        = known - result.cachedSpan;
+				}
+
+				if (ascii != YES) {
+					ascii = UNSURE;
+				}
+
+				return result;
+			}
+
+			/**
+			 * Room for at least this many units, so appending up to it will not reallocate.
+			 */
+			void reserve(std::size_t units) {
+				store.reserve(units);
+			}
+
+			String &operator+=(const String &other) {
+				if (cachedSpan != UNKNOWN && other.cachedSpan != UNKNOWN) {
+					cachedSpan += other.cachedSpan;
+				} else {
+					cachedSpan = UNKNOWN;
+				}
+
+				if (ascii == NO || other.ascii == NO) {
+					ascii = NO;
+				} else if (ascii == UNSURE || other.ascii == UNSURE) {
+					ascii = UNSURE;
+				}
+
+				store += other.store;
+
+				return *this;
+			}
+
+			friend String operator+(String a, const String &b) {
+				return a += b;
+			}
+
+			friend bool operator==(const String &a, const String &b) {
+				return a.store == b.store;
+			}
+
+			std::basic_string_view<Unit> view() const {
+				return store;
+			}
+
+			/**
+			 * `for var c in s`: calls f with every code point in order, without allocating, until
+			 * f returns false.  Strings known to be ASCII are walked a unit at a time, others are
+			 * decoded incrementally with ASCII runs skipped in bulk.
+			 */
+			template <typename F>
+			void each(F &&f) const {
+				const Unit *data   = store.data();
+				std::size_t length = store.size();
+
+				if (ascii == YES) {
+					for (std::size_t i = 0; i < length; i++) {
+						if (!call(f, char32_t(data[i]))) {
+							return;
+						}
+					}
+
+					return;
+				}
+
+				for (std::size_t i = 0; i < length; ) {
+					if constexpr (Size == 8) {
+						std::size_t end = i + utf::asciiPrefix(data + i, length - i);
+
+						for (; i < end; i++) {
+							if (!call(f, char32_t(data[i]))) {
+								return;
+							}
+						}
+
+						if (i == length) {
+							break;
+						}
+					}
+
+					if (!call(f, utf::decode(data, i))) {
+						return;
+					}
+				}
+			}
+
+		private:
+			static constexpr std::size_t UNKNOWN = std::size_t(-1);
+
+			enum Flag: int8_t {
+				UNSURE,
+				YES,
+				NO
+			};
+
+			std::basic_string<Unit> store;
+			mutable std::size_t cachedSpan = UNKNOWN;
+			mutable Flag ascii = UNSURE;
+
+			template <typename F>
+			static bool call(F &f, char32_t code) {
+				if constexpr (std::is_void_v<std::invoke_result_t<F &, char32_t>>) {
+					f(code);
+
+					return true;
+				} else {
+					return f(code);
+				}
+			}
+
+			/**
+			 * Unit offset of the code point at index.
+			 */
+			std::size_t locate(std::size_t index) const {
+				std::size_t offset = 0;
+
+				for (std::size_t i = 0; i < index; i++) {
+					utf::decode(store.data(), offset);
+				}
+
+				return offset;
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef __PINT_RUNTIME_TABLE_H
+#define __PINT_RUNTIME_TABLE_H
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace pint {
+	/**
+	 * An insert-only open addressing hash table in the Swiss table layout.  Every slot has a
+	 * control byte holding 7 bits of its hash, or EMPTY, and a probe compares a whole group of
+	 * 16 control bytes against the hash at once, so only slots whose bits match are compared
+	 * by key.  Callers pass the hash, which is computed once for interned keys.
+	 */
+	template <typename K, typename V>
+	class Table {
+		public:
+			static constexpr std::size_t GROUP = 16;
+
+			Table() {
+				allocate(GROUP);
+			}
+
+			std::size_t size() const {
+				return used;
+			}
+
+			bool empty() const {
+				return used == 0;
+			}
+
+			/**
+			 * The value of the key for which match returns true, or null.
+			 */
+			template <typename Match>
+			V *find(std::size_t hash, Match match) {
+				std::size_t mask  = capacity - 1;
+				std::size_t index = (hash >> 7) & mask;
+				int8_t tag        = int8_t(hash & 0x7F);
+
+				for (std::size_t stride = GROUP; ; stride += GROUP) {
+					for (uint32_t found = compare(index, tag); found; found &= found - 1) {
+						std::size_t slot = (index + std::countr_zero(found)) & mask;
+
+						if (match(keys[slot])) {
+							return &values[slot];
+						}
+					}
+
+					if (compare(index, EMPTY)) {
+						return nullptr;
+					}
+
+					index = (index + stride) & mask;
+				}
+			}
+
+			template <typename Match>
+			const V *find(std::size_t hash, Match match) const {
+				return const_cast<Table *>(this)->find(hash, match);
+			}
+
+			/**
+			 * Adds a key which is known to be missing.
+			 */
+			V &insert(std::size_t hash, K key, V value) {
+				if ((used + 1) * 8 > capacity * 7) {
+					grow();
+				}
+
+				std::size_t slot = place(hash);
+
+				keys[slot]   = std::move(key);
+				values[slot] = std::move(value);
+				used++;
+
+				return values[slot];
+			}
+
+		private:
+			static constexpr int8_t EMPTY = -128;
+
+			/**
+			 * Control bytes, with the first group repeated after the last slot so a group can
+			 * be loaded at any index without wrapping.
+			 */
+			std::vector<int8_t> control;
+			std::vector<std::size_t> hashes;
+			std::vector<K> keys;
+			std::vector<V> values;
+			std::size_t capacity = 0;
+			std::size_t used = 0;
+
+			void allocate(std::size_t capacity) {
+				this->capacity = capacity;
+
+				control.assign(capacity + GROUP, EMPTY);
+				hashes.assign(capacity, 0);
+				keys.assign(capacity, K());
+				values.assign(capacity, V());
+			}
+
+			/**
+			 * Bit i is set if control byte index + i equals tag.
+			 */
+			uint32_t compare(std::size_t index, int8_t tag) const {
+			#if defined(__SSE2__)
+				__m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(control.data() + index));
+
+				return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(tag))));
+			#else
+				uint32_t result = 0;
+
+				for (std::size_t i = 0; i < GROUP; i++) {
+					result |= uint32_t(control[index + i] == tag) << i;
+				}
+
+				return result;
+			#endif
+			}
+
+			std::size_t place(std::size_t hash) {
+				std::size_t mask  = capacity - 1;
+				std::size_t index = (hash >> 7) & mask;
+
+				for (std::size_t stride = GROUP; ; stride += GROUP) {
+					if (uint32_t empty = compare(index, EMPTY)) {
+						std::size_t slot = (index + std::countr_zero(empty)) & mask;
+						int8_t tag       = int8_t(hash & 0x7F);
+
+						control[slot] = tag;
+
+						if (slot < GROUP) {
+							control[capacity + slot] = tag;
+						}
+
+						hashes[slot] = hash;
+
+						return slot;
+					}
+
+					index = (index + stride) & mask;
+				}
+			}
+
+			void grow() {
+				auto oldControl = std::move(control);
+				auto oldHashes  = std::move(hashes);
+				auto oldKeys    = std::move(keys);
+				auto oldValues  = std::move(values);
+				auto oldSize    = capacity;
+
+				allocate(capacity * 2);
+
+				for (std::size_t i = 0; i < oldSize; i++) {
+					if (oldControl[i] != EMPTY) {
+						std::size_t slot = place(oldHashes[i]);
+
+						keys[slot]   = std::move(oldKeys[i]);
+						values[slot] = std::move(oldValues[i]);
+					}
+				}
+			}
+	};
+}
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef __PINT_RUNTIME_TYPES_H
+#define __PINT_RUNTIME_TYPES_H
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace pint {
+	/**
+	 * The base types, as matched by the TYPE_BASE token.
+	 */
+	enum class Base {
+		INTEGER,
+		CARDINAL,
+		REAL,
+		CHAR,
+		STRING,
+		BOOLEAN
+	};
+
+	/**
+	 * A size of 0 means the size was not fixed and may change at run-time.
+	 */
+	static constexpr std::size_t DYNAMIC_SIZE = 0;
+
+	/**
+	 * Default sizes for declarations without an explicit size and for constants in code.
+	 */
+	constexpr std::size_t defaultSize(Base base) {
+		switch (base) {
+			case Base::INTEGER:
+			case Base::CARDINAL:
+			case Base::REAL:
+				return 32;
+			case Base::CHAR:
+			case Base::STRING:
+				return 8;
+			case Base::BOOLEAN:
+				return 1;
+		}
+
+		return DYNAMIC_SIZE;
+	}
+
+	/**
+	 * The base type named by a TYPE_BASE token, if it is one.
+	 */
+	constexpr std::optional<Base> toBase(std::string_view name) {
+		if (name == "integer")  return Base::INTEGER;
+		if (name == "cardinal") return Base::CARDINAL;
+		if (name == "real")     return Base::REAL;
+		if (name == "char")     return Base::CHAR;
+		if (name == "string")   return Base::STRING;
+		if (name == "boolean")  return Base::BOOLEAN;
+
+		return std::nullopt;
+	}
+}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef __PINT_RUNTIME_VARIADIC_H
+#define __PINT_RUNTIME_VARIADIC_H
+
+#include <initializer_list>
+#include <span>
+
+#include "array.h"
+
+namespace pint {
+	/**
+	 * The `...parts: T` of a call: a pointer and a count over arguments the caller laid out on
+	 * its own stack, e.g. `writeLn(fd, {'x is equal to ', x})`.  Nothing is allocated unless the
+	 * callee lets the list escape, in which case it calls escape() once on entry.
+	 */
+	template <typename T>
+	class Variadic {
+		public:
+			constexpr Variadic(std::initializer_list<T> values) {
+				this->values = std::span<const T>(values.begin(), values.size());
+			}
+
+			constexpr Variadic(std::span<const T> values) {
+				this->values = values;
+			}
+
+			constexpr std::size_t span() const {
+				return values.size();
+			}
+
+			constexpr const T &operator[](std::size_t index) const {
+				return values[index];
+			}
+
+			constexpr auto begin() const { return values.begin(); }
+			constexpr auto end() const { return values.end(); }
+
+			constexpr operator std::span<const T>() const {
+				return values;
+			}
+
+			/**
+			 * A heap copy of the arguments that may outlive the call.
+			 */
+			Array<T> escape() const {
+				Array<T> copy(values.size());
+
+				for (std::size_t i = 0; i < values.size(); i++) {
+					copy[i] = values[i];
+				}
+
+				return copy;
+			}
+
+		private:
+			std::span<const T> values;
+	};
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef __PINT_SITES_H
+#define __PINT_SITES_H
+
+#include "tree.h"
+
+namespace pint {
+	/**
+	 * Numbers every `value.identifier`, `value.$name` and `$name` site, so code generation can
+	 * give each its own InlineCache, or DynamicCache when the name is dynamic, in a table of
+	 * the returned size.
+	 */
+	class CacheSites {
+		public:
+			std::size_t run(std::shared_ptr<Node> node) {
+				sites = 0;
+
+				visit(node);
+
+				return sites;
+			}
+
+		private:
+			std::size_t sites = 0;
+
+			void visit(std::shared_ptr<Node> node) {
+				if (!node) {
+					return;
+				}
+
+				if (auto member = as(MemberNode, node)) {
+					member->cache = int(sites++);
+				} else if (auto identifier = as(IdentifierNode, node); identifier && identifier->dynamic) {
+					identifier->cache = int(sites++);
+				}
+
+				for (auto &child: node->children()) {
+					visit(child);
+				}
+			}
+	};
+}
+
+#endif
@@ -1,7 +1,9 @@
 #ifndef __PINT_TREE_H
 #define __PINT_TREE_H
 
+#include <cstdint>
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 #include <memory>
@@ -15,6 +17,13 @@ namespace pint {
 	class Node {
 		public:
 			virtual ~ Node() {}
+
+			/**
+			 * The nodes directly beneath this one, in source order.
+			 */
+			virtual std::vector<std::shared_ptr<Node>> children() const {
+				return {};
+			}
 	};
 
 
@@ -29,12 +38,22 @@ namespace pint {
 			ListNode(std::shared_ptr<Node> item) {
 				this->list = std::vector<std::shared_ptr<Node>>{item};
 			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return list;
+			}
 	};
 
 	class IdentifierNode: public Node {
 		public:
 			std::string name;
 
+			/**
+			 * Set for `$name`, which is resolved at runtime through the DynamicCache numbered `cache`.
+			 */
+			bool dynamic = false;
+			int cache = -1;
+
 			IdentifierNode(std::string name) {
 				this->name = name;
 			}
@@ -47,6 +66,20 @@ namespace pint {
 			UnitNode(std::shared_ptr<ListNode> path) {
 				this->path = path;
 			}
+
+			/**
+			 * The path joined by dots, `crypt.rot13`, which names declared in the unit are
+			 * qualified with.
+			 */
+			std::string name() const {
+				std::string result;
+
+				for (auto &part: path->list) {
+					result += (result.empty() ? "" : ".") + as(IdentifierNode, part)->name;
+				}
+
+				return result;
+			}
 	};
 
 	class UsesNode: public Node {
@@ -83,6 +116,718 @@ namespace pint {
 				this->alias = alias;
 			}
 	};
+
+	/**
+	 * A type signature, `<type>(<size>)` or `<cast>[<span>]` for arrays.
+	 */
+	class TypeNode: public Node {
+		public:
+			std::string name;
+			bool fixedType = false;
+			bool fixedSize = false;
+			std::size_t size = 0;
+			std::shared_ptr<TypeNode> element;
+			std::size_t span = 0;
+
+			/**
+			 * The type arguments of a generic, `Repository<Person>`, and the instance of the
+			 * generic they select, see Generics.
+			 */
+			std::shared_ptr<ListNode> arguments;
+			int instance = -1;
+
+			/**
+			 * A size given by a constant, `char(WIDTH)`, until Constants folds it into size.
+			 */
+			std::shared_ptr<Node> expression;
+
+			/**
+			 * Implicit dynamic type, `var x;`
+			 */
+			TypeNode() {}
+
+			TypeNode(std::string name) {
+				this->name      = name;
+				this->fixedType = true;
+			}
+
+			/**
+			 * An array of element, a span of 0 is a dynamic span.
+			 */
+			TypeNode(std::shared_ptr<TypeNode> element, std::size_t span) {
+				this->element   = element;
+				this->span      = span;
+				this->fixedType = true;
+			}
+
+			/**
+			 * A size of 0 is an implicit fixed size, `()`.
+			 */
+			void setSize(std::size_t size) {
+				this->fixedSize = true;
+				this->size      = size;
+			}
+
+			bool isArray() const {
+				return element != nullptr;
+			}
+	};
+
+	class LiteralNode: public Node {
+		public:
+			enum class Kind {
+				INTEGER,
+				REAL,
+				STRING,
+				BOOLEAN
+			};
+
+			Kind kind;
+			std::string text;
+
+			LiteralNode(Kind kind, std::string text) {
+				this->kind = kind;
+				this->text = text;
+			}
+	};
+
+	/**
+	 * `<left> <op> <right>`
+	 */
+	class BinaryNode: public Node {
+		public:
+			std::string op;
+			std::shared_ptr<Node> left;
+			std::shared_ptr<Node> right;
+
+			/**
+			 * Whether arithmetic on sized integers is checked for overflow, until an analysis
+			 * proves the result fits, see BoundsCheck.
+			 */
+			bool checked = true;
+
+			BinaryNode(std::string op, std::shared_ptr<Node> left, std::shared_ptr<Node> right) {
+				this->op    = op;
+				this->left  = left;
+				this->right = right;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {left, right};
+			}
+	};
+
+	/**
+	 * `<value>:<type>`, e.g. `10:char(8)`.
+	 */
+	class CastNode: public Node {
+		public:
+			std::shared_ptr<Node> value;
+			std::shared_ptr<TypeNode> type;
+
+			CastNode(std::shared_ptr<Node> value, std::shared_ptr<TypeNode> type) {
+				this->value = value;
+				this->type  = type;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {value};
+			}
+	};
+
+	class FunctionNode;
+
+	/**
+	 * `<target>[<index>]`, checked until an analysis proves the index is within the span.
+	 */
+	class IndexNode: public Node {
+		public:
+			std::shared_ptr<Node> target;
+			std::shared_ptr<Node> index;
+			bool checked = true;
+
+			/**
+			 * Set when the index is a function, `msg[encode]`, applied to every element.
+			 */
+			std::shared_ptr<FunctionNode> mapper;
+
+			IndexNode(std::shared_ptr<Node> target, std::shared_ptr<Node> index) {
+				this->target = target;
+				this->index  = index;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {target, index};
+			}
+	};
+
+	/**
+	 * A `var` or `set` declaration of a single name.
+	 */
+	class VarNode: public Node {
+		public:
+			std::shared_ptr<IdentifierNode> name;
+			std::shared_ptr<TypeNode> type;
+			std::shared_ptr<Node> value;
+			bool constant = false;
+			bool variadic = false;
+
+			/**
+			 * Whether the value may outlive the frame it is declared in, until proven otherwise.
+			 */
+			bool escapes = true;
+
+			VarNode(std::shared_ptr<IdentifierNode> name, std::shared_ptr<TypeNode> type) {
+				this->name = name;
+				this->type = type;
+			}
+
+			void setValue(std::shared_ptr<Node> value) {
+				this->value = value;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				if (value) {
+					return {value};
+				}
+
+				return {};
+			}
+	};
+
+	/**
+	 * `<target>.<name>`
+	 */
+	class MemberNode: public Node {
+		public:
+			std::shared_ptr<Node> target;
+			std::shared_ptr<IdentifierNode> name;
+
+			/**
+			 * Index of the inline cache for this site, see CacheSites.
+			 */
+			int cache = -1;
+
+			MemberNode(std::shared_ptr<Node> target, std::shared_ptr<IdentifierNode> name) {
+				this->target = target;
+				this->name   = name;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {target};
+			}
+	};
+
+	class CallNode: public Node {
+		public:
+			std::shared_ptr<Node> target;
+			std::shared_ptr<ListNode> args;
+
+			/**
+			 * Set for `<target>.map(<function>)`, the function applied to every element.
+			 */
+			std::shared_ptr<FunctionNode> mapper;
+
+			/**
+			 * For the last call of a chain of `map`, `filter` and `reduce`, every call in the
+			 * chain from the first, see Pipelines.  The calls before it are fused into it and
+			 * its result is only built as an array when materialize is set.  A chain whose
+			 * result is discarded is drained, run through Pipeline::each keeping nothing.
+			 */
+			std::vector<std::shared_ptr<CallNode>> stages;
+			bool fused = false;
+			bool materialize = false;
+			bool drained = false;
+
+			/**
+			 * How a method call `<receiver>.<name>(...)` is made, see Classes: straight to
+			 * callee, which is inlined when small, through the receiver's vtable or through
+			 * the itable of the receiver's interface, each at slot.  Calls on receivers of
+			 * unknown type look the method up by name.
+			 */
+			enum class Dispatch {
+				DYNAMIC,
+				DIRECT,
+				VIRTUAL,
+				INTERFACE
+			};
+
+			Dispatch dispatch = Dispatch::DYNAMIC;
+			int slot = -1;
+			std::shared_ptr<FunctionNode> callee;
+			bool inlined = false;
+
+			/**
+			 * For `'<pattern>'.format(...)` on a literal pattern, the pattern parsed when
+			 * compiling, see Formats: the text before each argument and how the argument is
+			 * written, the text after the last one, and the units of all the text.
+			 */
+			struct Piece {
+				std::string text;
+				char spec;
+				int precision;
+			};
+
+			std::vector<Piece> pieces;
+			std::string tail;
+			std::size_t units = 0;
+			bool formatted = false;
+
+			CallNode(std::shared_ptr<Node> target, std::shared_ptr<ListNode> args) {
+				this->target = target;
+				this->args   = args;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {target, args};
+			}
+	};
+
+	/**
+	 * A registered function or a function literal.  Parameters are VarNodes.
+	 */
+	class FunctionNode: public Node {
+		public:
+			std::shared_ptr<IdentifierNode> name;
+			std::shared_ptr<ListNode> params;
+			std::shared_ptr<TypeNode> type;
+			std::shared_ptr<ListNode> body;
+
+			/**
+			 * No side effects, loops or calls other than to pure functions and few enough
+			 * branches to inline into a loop over elements, see Mapping.
+			 */
+			bool pure = false;
+
+			/**
+			 * Where the captured locals of enclosing functions are kept, see ClosureEscape:
+			 * nowhere when there are none, in the declaring frame while the function cannot
+			 * outlive it, and in a heap allocation otherwise.
+			 */
+			enum class Environment {
+				NONE,
+				STACK,
+				HEAP
+			};
+
+			std::vector<std::string> captures;
+			Environment environment = Environment::HEAP;
+
+			FunctionNode(std::shared_ptr<ListNode> params, std::shared_ptr<TypeNode> type, std::shared_ptr<ListNode> body) {
+				this->params = params;
+				this->type   = type;
+				this->body   = body;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {params, body};
+			}
+	};
+
+	/**
+	 * `if <condition> do ... else ...`
+	 */
+	class IfNode: public Node {
+		public:
+			std::shared_ptr<Node> condition;
+			std::shared_ptr<ListNode> then;
+			std::shared_ptr<ListNode> otherwise;
+
+			IfNode(std::shared_ptr<Node> condition, std::shared_ptr<ListNode> then, std::shared_ptr<ListNode> otherwise) {
+				this->condition = condition;
+				this->then      = then;
+				this->otherwise = otherwise;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {condition, then, otherwise};
+			}
+	};
+
+	/**
+	 * `return <value>`
+	 */
+	class ReturnNode: public Node {
+		public:
+			std::shared_ptr<Node> value;
+
+			ReturnNode(std::shared_ptr<Node> value) {
+				this->value = value;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {value};
+			}
+	};
+
+	/**
+	 * `<targets> = <value>`, or a compound assignment such as `+=`.
+	 */
+	class AssignNode: public Node {
+		public:
+			std::shared_ptr<ListNode> targets;
+			std::shared_ptr<Node> value;
+			std::string op;
+
+			AssignNode(std::shared_ptr<ListNode> targets, std::shared_ptr<Node> value, std::string op = "=") {
+				this->targets = targets;
+				this->value   = value;
+				this->op      = op;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {targets, value};
+			}
+	};
+
+	/**
+	 * Appends each of the parts, in order, to target in place.  Not written in code, this is what
+	 * accumulating assignments like `x = x + a + b` are lowered to.
+	 */
+	class AppendNode: public Node {
+		public:
+			std::shared_ptr<IdentifierNode> target;
+			std::shared_ptr<ListNode> parts;
+
+			AppendNode(std::shared_ptr<IdentifierNode> target, std::shared_ptr<ListNode> parts) {
+				this->target = target;
+				this->parts  = parts;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {target, parts};
+			}
+	};
+
+	/**
+	 * `[<items>]`
+	 */
+	class ArrayNode: public Node {
+		public:
+			std::shared_ptr<ListNode> items;
+
+			ArrayNode(std::shared_ptr<ListNode> items) {
+				this->items = items;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {items};
+			}
+	};
+
+	/**
+	 * `for var <variable> = <subject> to <limit>`, `for var <variable> in <subject>` (values) and
+	 * `for var <variable> of <subject>` (indexes or keys).
+	 */
+	class ForNode: public Node {
+		public:
+			enum class Kind {
+				TO,
+				IN,
+				OF
+			};
+
+			/**
+			 * What the subject is, once known, see Loops.
+			 */
+			enum class Over {
+				UNKNOWN,
+				ARRAY,
+				STRING,
+				OBJECT,
+				PIPELINE
+			};
+
+			Kind kind;
+			std::shared_ptr<IdentifierNode> variable;
+			std::shared_ptr<Node> subject;
+			std::shared_ptr<Node> limit;
+			std::shared_ptr<ListNode> body;
+			Over over = Over::UNKNOWN;
+
+			ForNode(Kind kind, std::shared_ptr<IdentifierNode> variable, std::shared_ptr<Node> subject, std::shared_ptr<ListNode> body) {
+				this->kind     = kind;
+				this->variable = variable;
+				this->subject  = subject;
+				this->body     = body;
+			}
+
+			void setLimit(std::shared_ptr<Node> limit) {
+				this->limit = limit;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				if (limit) {
+					return {subject, limit, body};
+				}
+
+				return {subject, body};
+			}
+	};
+
+	/**
+	 * `register <name>: record(<extends>) = (<fields>);`, each field a VarNode whose value is
+	 * its default.  Records passes fill in the layout and the constructor.
+	 */
+	class RecordNode: public Node {
+		public:
+			struct Field {
+				std::shared_ptr<VarNode> var;
+				std::size_t offset;
+				std::size_t bytes;
+				std::size_t align;
+			};
+
+			std::shared_ptr<IdentifierNode> name;
+			std::shared_ptr<ListNode> extends;
+			std::shared_ptr<ListNode> fields;
+
+			/**
+			 * Every field including the inherited ones, in storage order, and the total size.
+			 */
+			std::vector<Field> layout;
+			std::size_t bytes = 0;
+			std::size_t align = 1;
+
+			/**
+			 * Takes the fields in declaration order, with defaults, and stores them.
+			 */
+			std::shared_ptr<FunctionNode> constructor;
+
+			RecordNode(std::shared_ptr<IdentifierNode> name, std::shared_ptr<ListNode> extends, std::shared_ptr<ListNode> fields) {
+				this->name    = name;
+				this->extends = extends;
+				this->fields  = fields;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {fields};
+			}
+	};
+
+	/**
+	 * `register <name>: class|interface|implementation<<parameters>>(<bases>) begin ... end`.
+	 * Type parameters are VarNodes typed with their bound, `T of Entity`, and bases are
+	 * identifiers or, for generics, TypeNodes with arguments.
+	 */
+	class ClassNode: public Node {
+		public:
+			enum class Kind {
+				CLASS,
+				INTERFACE,
+				IMPLEMENTATION
+			};
+
+			/**
+			 * A distinct list of type arguments of a generic.  Boxed instances all share the
+			 * code compiled with every parameter as a Dynamic, see Generics.
+			 */
+			struct Instance {
+				std::string key;
+				std::vector<std::shared_ptr<TypeNode>> arguments;
+				std::size_t uses = 0;
+				bool boxed = false;
+			};
+
+			/**
+			 * A method, its function is missing for methods an interface only declares.
+			 */
+			struct Method {
+				std::string name;
+				std::shared_ptr<FunctionNode> function;
+			};
+
+			Kind kind;
+			std::shared_ptr<IdentifierNode> name;
+			std::shared_ptr<ListNode> parameters;
+			std::shared_ptr<ListNode> bases;
+			std::shared_ptr<ListNode> body;
+			std::vector<Instance> instances;
+
+			/**
+			 * The methods in slot order, see Classes, the first implementation used being
+			 * a prefix, and for every interface and implementation used the vtable slot of
+			 * each of its methods in their order.
+			 */
+			std::vector<Method> vtable;
+			std::map<std::string, std::vector<int>> itables;
+
+			ClassNode(Kind kind, std::shared_ptr<IdentifierNode> name, std::shared_ptr<ListNode> parameters, std::shared_ptr<ListNode> bases, std::shared_ptr<ListNode> body) {
+				this->kind       = kind;
+				this->name       = name;
+				this->parameters = parameters;
+				this->bases      = bases;
+				this->body       = body;
+			}
+
+			bool isGeneric() const {
+				return parameters && !parameters->list.empty();
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {body};
+			}
+	};
+
+	/**
+	 * `register <name>: label(<extends>) = (<values>);`.  The Labels pass numbers the values of
+	 * a label and of every label extending it, its family, densely from 0 when it sees every
+	 * unit of the program.
+	 */
+	class LabelNode: public Node {
+		public:
+			std::shared_ptr<IdentifierNode> name;
+			std::shared_ptr<ListNode> extends;
+			std::shared_ptr<ListNode> values;
+
+			/**
+			 * The label the family is rooted at, the code of each value including the inherited
+			 * ones, and the number of codes used by the whole family.
+			 */
+			std::string family;
+			std::map<std::string, std::size_t> codes;
+			std::size_t span = 0;
+
+			/**
+			 * The value names of the whole family by code, shared by all its labels.
+			 */
+			std::shared_ptr<const std::vector<std::string>> names;
+
+			LabelNode(std::shared_ptr<IdentifierNode> name, std::shared_ptr<ListNode> extends, std::shared_ptr<ListNode> values) {
+				this->name    = name;
+				this->extends = extends;
+				this->values  = values;
+			}
+	};
+
+	/**
+	 * `<label>#<value>`, e.g. `Level#INFO`.
+	 */
+	class LabelValueNode: public Node {
+		public:
+			std::shared_ptr<Node> label;
+			std::shared_ptr<IdentifierNode> value;
+
+			/**
+			 * The dense code of the value within its family, once known.
+			 */
+			std::string family;
+			int code = -1;
+
+			LabelValueNode(std::shared_ptr<Node> label, std::shared_ptr<IdentifierNode> value) {
+				this->label = label;
+				this->value = value;
+			}
+	};
+
+	/**
+	 * `<low>..<high>`, both included, as a case value.
+	 */
+	class RangeNode: public Node {
+		public:
+			std::shared_ptr<Node> low;
+			std::shared_ptr<Node> high;
+
+			RangeNode(std::shared_ptr<Node> low, std::shared_ptr<Node> high) {
+				this->low  = low;
+				this->high = high;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {low, high};
+			}
+	};
+
+	/**
+	 * `continue`, which at the end of a case branch falls through to the next one.
+	 */
+	class ContinueNode: public Node {};
+
+	/**
+	 * One branch of a case, without values for the default branch.  A value may be a constant,
+	 * a RangeNode or a ListNode, a set of values.
+	 */
+	class WhenNode: public Node {
+		public:
+			std::shared_ptr<ListNode> values;
+			std::shared_ptr<ListNode> body;
+
+			/**
+			 * The body ends with `continue`, so the next branch is run after it.
+			 */
+			bool fallthrough = false;
+
+			WhenNode(std::shared_ptr<ListNode> values, std::shared_ptr<ListNode> body) {
+				this->values = values;
+				this->body   = body;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {values, body};
+			}
+	};
+
+	/**
+	 * `case <subject> ...`, a list of WhenNodes, either a statement or, with `=>` arms, an
+	 * expression.  Cases passes choose how it is dispatched.
+	 */
+	class CaseNode: public Node {
+		public:
+			enum class Dispatch {
+				/**
+				 * Compare the subject against every value in turn.
+				 */
+				CHAIN,
+
+				/**
+				 * Index table by the subject minus first, giving the branch to take.
+				 */
+				TABLE,
+
+				/**
+				 * Binary search of the sorted, disjoint ranges.
+				 */
+				SEARCH,
+
+				/**
+				 * Compare the string with the one key at its perfect hash under seed, and take
+				 * the branch at the same index in table.  See dispatch::hash.
+				 */
+				HASH
+			};
+
+			struct Range {
+				long low;
+				long high;
+				int branch;
+			};
+
+			std::shared_ptr<Node> subject;
+			std::shared_ptr<ListNode> branches;
+			bool expression = false;
+
+			Dispatch dispatch = Dispatch::CHAIN;
+
+			/**
+			 * The branch taken when no value matches, or -1.
+			 */
+			int fallback = -1;
+
+			long first = 0;
+			std::vector<int> table;
+			std::vector<Range> ranges;
+			std::vector<std::string> keys;
+			uint64_t seed = 0;
+
+			CaseNode(std::shared_ptr<Node> subject, std::shared_ptr<ListNode> branches) {
+				this->subject  = subject;
+				this->branches = branches;
+			}
+
+			std::vector<std::shared_ptr<Node>> children() const override {
+				return {subject, branches};
+			}
+	};
 }
 
 #endif
@@ -0,0 +1,16 @@
+#!/bin/bash
+
+status=0
+
+for test in ${@:-tests/*.cpp}; do
+	name=$(basename "$test" .cpp)
+
+	${CXX:-clang-18} -g -O1 -std=c++23 -Isrc -o "bin/test-$name" "tests/$name.cpp" -lstdc++ -lpthread && "bin/test-$name"
+
+	if [ $? -ne 0 ]; then
+		echo "FAILED: $name"
+		status=1
+	fi
+done
+
+exit $status
@@ -0,0 +1,85 @@
+#include <cassert>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "runtime/aio.h"
+
+using namespace pint;
+
+static std::string read(const std::string &path) {
+	std::ifstream file(path);
+	std::stringstream contents;
+
+	contents << file.rdbuf();
+
+	return contents.str();
+}
+
+static std::string path(int index) {
+	return "/tmp/pint-test-aio-" + std::to_string(::getpid()) + "-" + std::to_string(index);
+}
+
+/**
+ * Appends to many more files than the cache keeps open, interleaved, so files are evicted
+ * while they still have writes queued.
+ */
+static void keepsOrder(std::unique_ptr<Backend> backend) {
+	const int FILES = 20, LINES = 500;
+	std::string expected[FILES];
+
+	{
+		AsyncFiles files(std::move(backend), 4);
+		std::vector<std::shared_ptr<Completion>> completions;
+
+		for (int line = 0; line < LINES; line++) {
+			for (int file = 0; file < FILES; file++) {
+				std::string entry = "entry " + std::to_string(line) + "\n";
+
+				completions.push_back(files.append(path(file), entry));
+				expected[file] += entry;
+			}
+		}
+
+		for (auto &completion: completions) {
+			files.wait(*completion);
+			assert(completion->result() == int64_t(completion->data.size()));
+		}
+	}
+
+	for (int file = 0; file < FILES; file++) {
+		assert(read(path(file)) == expected[file]);
+		::unlink(path(file).c_str());
+	}
+}
+
+/**
+ * A write reaches the file without anything polling for it.
+ */
+static void submitsEagerly(std::unique_ptr<Backend> backend) {
+	AsyncFiles files(std::move(backend));
+	auto completion = files.append(path(0), "eager\n");
+
+	for (int tries = 0; tries < 200 && read(path(0)).empty(); tries++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	assert(read(path(0)) == "eager\n");
+
+	files.wait(*completion);
+	::unlink(path(0).c_str());
+}
+
+int main() {
+	keepsOrder(std::make_unique<ThreadBackend>());
+	submitsEagerly(std::make_unique<ThreadBackend>());
+
+	#if PINT_IO_URING
+		if (auto backend = UringBackend::create()) {
+			keepsOrder(std::move(backend));
+			submitsEagerly(UringBackend::create());
+		}
+	#endif
+}
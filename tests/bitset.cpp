@@ -0,0 +1,62 @@
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+
+#include "runtime/bitset.h"
+
+using namespace pint;
+
+static_assert(sizeof(Bits<64>) == 8);
+static_assert(sizeof(Bits<1000>) == 128);
+static_assert(std::is_same_v<Boolean<1>, bool>);
+
+static void fixed() {
+	Bits<70> bits;
+	std::vector<std::size_t> set;
+
+	bits.set(3);
+	bits.set(69);
+
+	assert(bits.count() == 2 && bits.get(69) && !bits.get(68));
+
+	auto inverse = ~bits;
+
+	assert(inverse.count() == 68 && !inverse.all());
+	assert((inverse | bits).all());
+	assert((inverse & bits).none());
+
+	bits.each([&](std::size_t index) {
+		set.push_back(index);
+	});
+
+	assert(set == std::vector<std::size_t>({3, 69}));
+}
+
+static void dynamic() {
+	Bits<> bits(130);
+	Bits<> other(100);
+
+	bits.set(129);
+	assert(bits.count() == 1);
+
+	bits.resize(100);
+	assert(bits.none());
+
+	bits.resize(200);
+	assert(bits.none());
+
+	try {
+		bits &= other;
+		assert(false);
+	} catch (const std::length_error &) {}
+
+	try {
+		bits.at(500);
+		assert(false);
+	} catch (const std::out_of_range &) {}
+}
+
+int main() {
+	fixed();
+	dynamic();
+}
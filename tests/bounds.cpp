@@ -0,0 +1,139 @@
+#include <cassert>
+
+#include "bounds.h"
+#include "cases.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<TypeNode> array(std::size_t span) {
+	return std::make_shared<TypeNode>(type("integer"), span);
+}
+
+static std::shared_ptr<IndexNode> index(std::string target, std::shared_ptr<Node> index) {
+	return std::make_shared<IndexNode>(identifier(target), index);
+}
+
+static std::shared_ptr<ForNode> to(std::string variable, std::string low, std::string high, std::shared_ptr<ListNode> body) {
+	auto loop = std::make_shared<ForNode>(ForNode::Kind::TO, identifier(variable), integer(low), body);
+
+	loop->limit = integer(high);
+
+	return loop;
+}
+
+static std::shared_ptr<ForNode> of(std::string variable, std::string subject, std::shared_ptr<ListNode> body) {
+	return std::make_shared<ForNode>(ForNode::Kind::OF, identifier(variable), identifier(subject), body);
+}
+
+static void removesChecks() {
+	auto shifted = index("arr", binary("-", identifier("i"), integer("1")));
+	auto beyond  = index("arr", identifier("i"));
+	auto element = index("list", identifier("x"));
+	auto sum     = binary("+", identifier("a"), identifier("b"));
+
+	BoundsCheck().run(list({
+		var("arr", array(5)),
+		var("list", array(0)),
+		var("a", type("integer", 8), integer("100")),
+		var("b", type("integer", 16), integer("100")),
+		to("i", "1", "5", list({shifted, beyond})),
+		of("x", "list", list({element})),
+		var("c", type("integer", 8), sum)
+	}));
+
+	assert(!shifted->checked && beyond->checked && !element->checked && !sum->checked);
+}
+
+/**
+ * `for var x of arr` only indexes arr when the body leaves both names bound as they were.
+ */
+static void keepsRebound() {
+	auto assigned   = index("arr", identifier("x"));
+	auto redeclared = index("arr", identifier("x"));
+	auto shadowed   = index("arr", identifier("x"));
+	auto replaced   = index("arr", identifier("x"));
+	auto nested     = index("arr", identifier("x"));
+
+	BoundsCheck().run(list({
+		var("arr", array(0)),
+		of("x", "arr", list({assign("x", integer("99")), assigned})),
+		of("x", "arr", list({var("arr", array(2)), redeclared})),
+		of("x", "arr", list({var("x", type("integer"), integer("99")), shadowed})),
+		of("x", "arr", list({assign("arr", identifier("other")), replaced})),
+		of("x", "arr", list({function(list({var("arr", array(2))}), nullptr, list({nested}))}))
+	}));
+
+	assert(assigned->checked && redeclared->checked && shadowed->checked && replaced->checked && nested->checked);
+}
+
+/**
+ * A string appended to in place is assigned, lowered or not.
+ */
+static void seesAppends() {
+	auto appended = index("arr", identifier("i"));
+
+	BoundsCheck().run(list({
+		var("arr", array(5)),
+		to("i", "0", "4", list({std::make_shared<AppendNode>(identifier("i"), list({string("x")})), appended}))
+	}));
+
+	assert(appended->checked);
+}
+
+/**
+ * A branch reached by falling through from `when 100` holds 100 too, which Cases has to have
+ * marked before the ranges are worked out.
+ */
+static void followsFallthrough() {
+	auto reached = index("arr", identifier("i"));
+	auto match   = std::make_shared<CaseNode>(identifier("i"), list({
+		std::make_shared<WhenNode>(list({integer("100")}), list({std::make_shared<ContinueNode>()})),
+		std::make_shared<WhenNode>(list({std::make_shared<RangeNode>(integer("1"), integer("3"))}), list({reached}))
+	}));
+	auto root = list({var("arr", array(5)), var("i", type("integer", 8)), match});
+
+	Cases().run(root);
+	BoundsCheck().run(root);
+
+	assert(reached->checked);
+}
+
+/**
+ * A call may shrink any array it can reach, which is all but fresh locals no other function mentions.
+ */
+static void seesCalls() {
+	auto call     = [] { return std::make_shared<CallNode>(identifier("shrink"), list({})); };
+	auto global   = index("arr", identifier("x"));
+	auto local    = index("arr", identifier("x"));
+	auto captured = index("held", identifier("x"));
+	auto param    = index("given", identifier("x"));
+
+	BoundsCheck().run(list({
+		var("arr", array(0)),
+		of("x", "arr", list({call(), global})),
+		function(list({}), nullptr, list({
+			var("arr", array(0)),
+			of("x", "arr", list({call(), local}))
+		})),
+		function(list({}), nullptr, list({
+			var("held", array(0)),
+			var("shrink", type("function"), function(list({}), nullptr, list({identifier("held")}))),
+			of("x", "held", list({call(), captured}))
+		})),
+		function(list({var("given", array(0))}), nullptr, list({
+			of("x", "given", list({call(), param}))
+		}))
+	}));
+
+	assert(global->checked && !local->checked && captured->checked && param->checked);
+}
+
+int main() {
+	removesChecks();
+	keepsRebound();
+	seesAppends();
+	followsFallthrough();
+	seesCalls();
+}
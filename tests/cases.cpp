@@ -0,0 +1,139 @@
+#include <cassert>
+#include <string_view>
+#include <vector>
+
+#include "cases.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<RangeNode> range(long low, long high) {
+	return std::make_shared<RangeNode>(integer(std::to_string(low)), integer(std::to_string(high)));
+}
+
+static std::shared_ptr<WhenNode> when(std::initializer_list<std::shared_ptr<Node>> values, bool fallthrough = false) {
+	auto body = list({});
+
+	if (fallthrough) {
+		body->list.push_back(std::make_shared<ContinueNode>());
+	}
+
+	return std::make_shared<WhenNode>(values.size() ? list(values) : nullptr, body);
+}
+
+static std::shared_ptr<CaseNode> match(std::initializer_list<std::shared_ptr<Node>> branches) {
+	return std::make_shared<CaseNode>(identifier("x"), list(branches));
+}
+
+static std::shared_ptr<LabelValueNode> label(std::string family, int code) {
+	auto value = std::make_shared<LabelValueNode>(identifier("Level"), identifier("V" + std::to_string(code)));
+
+	value->family = family;
+	value->code   = code;
+
+	return value;
+}
+
+/**
+ * The branch the chain of comparisons takes, first match wins.
+ */
+static int chain(const CaseNode &match, long value) {
+	for (std::size_t i = 0; i < match.branches->list.size(); i++) {
+		auto when = as(WhenNode, match.branches->list[i]);
+		std::vector<std::shared_ptr<Node>> values;
+
+		if (!when->values) {
+			continue;
+		}
+
+		for (auto &item: when->values->list) {
+			if (auto set = as(ListNode, item)) {
+				values.insert(values.end(), set->list.begin(), set->list.end());
+			} else {
+				values.push_back(item);
+			}
+		}
+
+		for (auto &item: values) {
+			auto range = as(RangeNode, item);
+			auto low   = std::stol(as(LiteralNode, range ? range->low : item)->text);
+			auto high  = std::stol(as(LiteralNode, range ? range->high : item)->text);
+
+			if (value >= low && value <= high) {
+				return int(i);
+			}
+		}
+	}
+
+	return match.fallback;
+}
+
+static int dispatched(const CaseNode &match, long value) {
+	if (match.dispatch == CaseNode::Dispatch::TABLE) {
+		return value < match.first || value - match.first >= long(match.table.size()) ? match.fallback : match.table[value - match.first];
+	}
+
+	std::vector<dispatch::Range> ranges;
+
+	for (auto &range: match.ranges) {
+		ranges.push_back({range.low, range.high, range.branch});
+	}
+
+	return dispatch::search(ranges, value, match.fallback);
+}
+
+static void dispatchesIntegers() {
+	auto dense  = match({when({integer("1")}, true), when({list({integer("2"), integer("3"), integer("4")})}), when({range(5, 10)}), when({})});
+	auto sparse = match({when({integer("1")}), when({range(100, 200), integer("5000")}), when({range(150, 100000)}), when({integer("-7"), integer("3")}), when({})});
+	auto few    = match({when({integer("1")}), when({integer("2")})});
+
+	assert(Cases().run(list({dense, sparse, few})) == 2);
+	assert(dense->dispatch == CaseNode::Dispatch::TABLE && dense->fallback == 3);
+	assert(as(WhenNode, dense->branches->list[0])->fallthrough);
+	assert(sparse->dispatch == CaseNode::Dispatch::SEARCH && few->dispatch == CaseNode::Dispatch::CHAIN);
+
+	for (auto &match: {dense, sparse}) {
+		for (long value = -10; value <= 100010; value++) {
+			assert(dispatched(*match, value) == chain(*match, value));
+		}
+	}
+}
+
+static void dispatchesStrings() {
+	auto methods = match({
+		when({string("GET")}),
+		when({string("POST"), string("PUT")}),
+		when({string("DELETE")}),
+		when({string("PATCH"), string("GET")}),
+		when({})
+	});
+
+	assert(Cases().run(methods) == 1 && methods->dispatch == CaseNode::Dispatch::HASH);
+
+	std::vector<std::string_view> keys(methods->keys.begin(), methods->keys.end());
+	auto lookup = [&](std::string_view value) {
+		return dispatch::lookup(keys, methods->table, methods->seed, value, methods->fallback);
+	};
+
+	assert(lookup("GET") == 0 && lookup("PUT") == 1 && lookup("DELETE") == 2 && lookup("PATCH") == 3);
+	assert(lookup("HEAD") == 4 && lookup("") == 4);
+}
+
+static void dispatchesLabels() {
+	auto levels = match({when({label("Logger.Level", 0)}), when({label("Logger.Level", 2), label("Logger.Level", 1)}), when({label("Logger.Level", 3)})});
+	auto other  = match({when({label("Logger.Level", 0)}), when({label("Color", 1)}), when({label("Logger.Level", 2)})});
+	auto mixed  = match({when({label("Logger.Level", 0)}), when({integer("1")}), when({integer("2")})});
+	auto both   = match({when({integer("1")}), when({string("x")}), when({integer("2")})});
+
+	assert(Cases().run(list({levels, other, mixed, both})) == 1);
+	assert(levels->dispatch == CaseNode::Dispatch::TABLE && levels->table == std::vector<int>({0, 1, 1, 2}));
+	assert(other->dispatch == CaseNode::Dispatch::CHAIN && mixed->dispatch == CaseNode::Dispatch::CHAIN);
+	assert(both->dispatch == CaseNode::Dispatch::CHAIN);
+}
+
+int main() {
+	dispatchesIntegers();
+	dispatchesStrings();
+	dispatchesLabels();
+}
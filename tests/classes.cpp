@@ -0,0 +1,138 @@
+#include <cassert>
+#include <stdexcept>
+
+#include "classes.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+using Kind     = ClassNode::Kind;
+using Dispatch = CallNode::Dispatch;
+
+static std::shared_ptr<ClassNode> form(Kind kind, std::string name, std::shared_ptr<ListNode> bases, std::shared_ptr<ListNode> body) {
+	return std::make_shared<ClassNode>(kind, identifier(name), list({}), bases, body);
+}
+
+static std::shared_ptr<VarNode> method(std::string name, std::shared_ptr<FunctionNode> function) {
+	return var(name, nullptr, function);
+}
+
+static std::shared_ptr<FunctionNode> empty() {
+	return function(nullptr, nullptr, list({}));
+}
+
+static std::shared_ptr<CallNode> call(std::string receiver, std::string name) {
+	return std::make_shared<CallNode>(std::make_shared<MemberNode>(identifier(receiver), identifier(name)), list({}));
+}
+
+/**
+ * `Log` is an interface implemented by `FileLogger` and `NetLogger`, `Application` and
+ * `Service` use FileLogger first and `Remote` uses `Audit` before NetLogger.
+ */
+struct Program {
+	std::shared_ptr<FunctionNode> fileLog = empty(), fileFlush = empty(), netLog = empty(), netFlush = empty(), audit = empty(), run = empty();
+	std::shared_ptr<CallNode> inside = call("this", "flush");
+	std::shared_ptr<ClassNode> application, service, remote;
+	std::shared_ptr<ListNode> forms;
+
+	Program(std::shared_ptr<FunctionNode> serviceLog = nullptr) {
+		fileLog->body->list.push_back(inside);
+
+		application = form(Kind::CLASS, "Application", list({identifier("FileLogger")}), list({var("name", type("string")), method("run", run)}));
+		service     = form(Kind::CLASS, "Service", list({identifier("FileLogger")}), serviceLog ? list({method("log", serviceLog)}) : list({}));
+		remote      = form(Kind::CLASS, "Remote", list({identifier("Audit"), identifier("NetLogger")}), list({}));
+		forms       = list({
+			form(Kind::INTERFACE, "Log", list({}), list({var("log", nullptr), var("flush", nullptr)})),
+			form(Kind::IMPLEMENTATION, "FileLogger", list({identifier("Log")}), list({method("log", fileLog), method("flush", fileFlush)})),
+			form(Kind::IMPLEMENTATION, "NetLogger", list({identifier("Log")}), list({method("log", netLog), method("flush", netFlush)})),
+			form(Kind::IMPLEMENTATION, "Audit", list({}), list({method("audit", audit)})),
+			application, service, remote
+		});
+	}
+
+	std::shared_ptr<ListNode> with(std::initializer_list<std::shared_ptr<Node>> statements) {
+		auto root = list({});
+
+		root->list = forms->list;
+		root->list.push_back(function(nullptr, nullptr, list({
+			var("app", type("Application")), var("logger", type("Log")), var("file", type("FileLogger")), var("other", type("Audit"))
+		})));
+
+		auto &body = as(FunctionNode, root->list.back())->body->list;
+
+		body.insert(body.end(), statements);
+
+		return root;
+	}
+};
+
+static void laysOut() {
+	Program program;
+
+	Classes().run(program.with({}));
+
+	assert(program.application->vtable.size() == 3 && program.application->vtable[0].name == "log");
+	assert(program.application->vtable[2].name == "run" && program.application->itables["Log"] == std::vector<int>({0, 1}));
+	assert(program.remote->vtable[0].name == "audit" && program.remote->itables["NetLogger"] == std::vector<int>({1, 2}));
+}
+
+static void devirtualizesClosed() {
+	Program program;
+	auto run    = call("app", "run");
+	auto logged = call("logger", "log");
+	auto file   = call("file", "log");
+	auto app    = call("app", "log");
+	auto other  = call("other", "audit");
+
+	assert(Classes(true).run(program.with({run, logged, file, app, other})) == 5);
+	assert(run->dispatch == Dispatch::DIRECT && run->callee == program.run && run->inlined);
+	assert(logged->dispatch == Dispatch::INTERFACE && logged->slot == 0);
+	assert(file->dispatch == Dispatch::DIRECT && file->callee == program.fileLog);
+	assert(program.inside->dispatch == Dispatch::DIRECT && program.inside->callee == program.fileFlush);
+	assert(app->dispatch == Dispatch::DIRECT && other->dispatch == Dispatch::DIRECT && other->callee == program.audit);
+
+	Program overridden(empty());
+	auto through = call("file", "log");
+
+	Classes(true).run(overridden.with({through}));
+
+	assert(through->dispatch == Dispatch::VIRTUAL && through->slot == 0);
+}
+
+/**
+ * Another unit may add classes using an interface or implementation, so only calls on
+ * classes are direct.
+ */
+static void keepsOpen() {
+	Program program;
+	auto run  = call("app", "run");
+	auto file = call("file", "log");
+	auto app  = call("app", "log");
+
+	assert(Classes().run(program.with({run, file, app})) == 2);
+	assert(run->dispatch == Dispatch::DIRECT && app->dispatch == Dispatch::DIRECT);
+	assert(file->dispatch == Dispatch::INTERFACE && file->slot == 0);
+	assert(program.inside->dispatch == Dispatch::INTERFACE && program.inside->slot == 1);
+}
+
+static void rejects() {
+	auto log = form(Kind::INTERFACE, "Log", list({}), list({var("log", nullptr), var("flush", nullptr)}));
+
+	try {
+		Classes().run(list({log, form(Kind::CLASS, "Bad", list({identifier("Log")}), list({method("log", empty())}))}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+
+	try {
+		Classes().run(list({form(Kind::IMPLEMENTATION, "Loop", list({identifier("Loop")}), list({}))}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+}
+
+int main() {
+	laysOut();
+	devirtualizesClosed();
+	keepsOpen();
+	rejects();
+}
@@ -0,0 +1,25 @@
+#include <cassert>
+
+#include "runtime/closure.h"
+
+using namespace pint;
+
+int main() {
+	Closure<char(char, char)> none = [](char c, char offset) {
+		return char(c + offset);
+	};
+	int extra = 3;
+	auto local = [&](char c, char offset) {
+		return char(c + offset + extra);
+	};
+	auto borrowed = Closure<char(char, char)>::borrow(local);
+	auto owned    = Closure<char(char, char)>::own([extra](char c, char offset) {
+		return char(c + offset - extra);
+	});
+	auto copy = owned;
+
+	extra = 4;
+
+	assert(none('a', 1) == 'b' && borrowed('a', 0) == 'e');
+	assert(owned('d', 0) == 'a' && copy('e', 0) == 'b');
+}
@@ -0,0 +1,53 @@
+#include <cassert>
+
+#include "concat.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static void lowersStrings() {
+	auto root = list({
+		var("s", type("string")),
+		assign("s", binary("+", binary("+", identifier("s"), identifier("a")), identifier("b"))),
+		assign("s", identifier("a"), "+="),
+		assign("s", binary("+", binary("+", identifier("s"), identifier("a")), identifier("s"))),
+		assign("s", binary("+", identifier("a"), identifier("s")))
+	});
+
+	assert(Concatenation().run(root) == 2);
+	assert(as(AppendNode, root->list[1]) && as(AppendNode, root->list[2]));
+	assert(as(AssignNode, root->list[3]) && as(AssignNode, root->list[4]));
+}
+
+static void lowersReturn() {
+	auto body = list({assign("return", binary("+", identifier("return"), identifier("part")))});
+	auto root = list({
+		function(nullptr, type("string"), list({
+			std::make_shared<ForNode>(ForNode::Kind::IN, identifier("part"), identifier("parts"), body)
+		}))
+	});
+
+	assert(Concatenation().run(root) == 1 && as(AppendNode, body->list[0]));
+}
+
+static void keepsArithmetic() {
+	auto root = list({
+		var("i", type("integer", 8)),
+		var("d", nullptr),
+		assign("i", binary("+", identifier("i"), integer("1"))),
+		assign("i", integer("1"), "+="),
+		assign("d", binary("+", identifier("d"), string("a"))),
+		function(nullptr, type("integer"), list({
+			assign("return", binary("+", identifier("return"), integer("1")))
+		}))
+	});
+
+	assert(Concatenation().run(root) == 0);
+}
+
+int main() {
+	lowersStrings();
+	lowersReturn();
+	keepsArithmetic();
+}
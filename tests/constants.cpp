@@ -0,0 +1,101 @@
+#include <cassert>
+
+#include "constants.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<VarNode> constant(std::string name, std::shared_ptr<TypeNode> type, std::shared_ptr<Node> value) {
+	auto result = var(name, type, value);
+
+	result->constant = true;
+
+	return result;
+}
+
+static std::shared_ptr<MemberNode> member(std::string target, std::string name) {
+	return std::make_shared<MemberNode>(identifier(target), identifier(name));
+}
+
+static std::string folded(std::shared_ptr<VarNode> var) {
+	auto literal = as(LiteralNode, var->value);
+
+	return literal ? literal->text : "";
+}
+
+static void folds() {
+	auto sum      = var("sum", nullptr, binary("+", identifier("WIDTH"), integer("2")));
+	auto exact    = var("exact", nullptr, binary("/", integer("12"), integer("4")));
+	auto inexact  = var("inexact", nullptr, binary("/", integer("7"), integer("2")));
+	auto joined   = var("joined", nullptr, binary("+", string("ab"), member("io", "EOL")));
+	auto shadowed = var("shadowed", nullptr, identifier("WIDTH"));
+	auto root     = list({
+		list({unit("io"), constant("EOL", type("string"), string("\n"))}),
+		list({
+			unit("main"),
+			constant("WIDTH", nullptr, binary("*", integer("4"), integer("8"))),
+			sum, exact, inexact, joined,
+			function(list({var("WIDTH", nullptr)}), nullptr, list({shadowed}))
+		})
+	});
+
+	Constants().run(root);
+
+	assert(folded(sum) == "34" && folded(exact) == "3" && folded(joined) == "ab\n");
+	assert(as(BinaryNode, inexact->value) && as(IdentifierNode, shadowed->value));
+}
+
+/**
+ * Arithmetic on a sized constant overflows at its size, literals alone at 64 bits.
+ */
+static void keepsOverflows() {
+	auto over    = var("over", nullptr, binary("+", identifier("A"), integer("1")));
+	auto within  = var("within", nullptr, binary("-", identifier("A"), integer("1")));
+	auto chained = var("chained", nullptr, binary("+", binary("-", identifier("B"), integer("50")), integer("100")));
+	auto wider   = var("wider", nullptr, binary("+", identifier("A"), identifier("W")));
+	auto under   = var("under", nullptr, binary("-", identifier("U"), integer("1")));
+	auto plain   = var("plain", nullptr, binary("+", identifier("I"), integer("1")));
+	auto literal = var("literal", nullptr, binary("+", integer("2147483647"), integer("1")));
+	auto huge    = var("huge", nullptr, binary("+", integer("9223372036854775807"), integer("1")));
+
+	Constants().run(list({
+		constant("A", type("integer", 8), integer("127")),
+		constant("B", type("integer", 8), integer("100")),
+		constant("W", type("integer", 16), integer("1")),
+		constant("U", type("cardinal", 8), integer("0")),
+		constant("I", type("integer"), integer("2147483647")),
+		over, within, chained, wider, under, plain, literal, huge
+	}));
+
+	assert(as(BinaryNode, over->value) && folded(within) == "126" && folded(wider) == "128");
+	assert(as(BinaryNode, chained->value) && as(LiteralNode, as(BinaryNode, chained->value)->left));
+	assert(as(BinaryNode, under->value) && as(BinaryNode, plain->value));
+	assert(folded(literal) == "2147483648" && as(BinaryNode, huge->value));
+}
+
+static std::shared_ptr<CallNode> formatted(std::string pattern, std::initializer_list<std::shared_ptr<Node>> args) {
+	return std::make_shared<CallNode>(std::make_shared<MemberNode>(string(pattern), identifier("format")), list(args));
+}
+
+static void foldsFormats() {
+	auto real     = std::make_shared<LiteralNode>(LiteralNode::Kind::REAL, "1.50");
+	auto shortest = var("shortest", nullptr, formatted("%s", {real}));
+	auto fixed    = var("fixed", nullptr, formatted("%d%% of %.2f", {integer("7"), real}));
+	auto whole    = var("whole", nullptr, formatted("%f", {integer("7")}));
+	auto mismatch = var("mismatch", nullptr, formatted("%d", {real}));
+	auto unknown  = var("unknown", nullptr, formatted("%q", {integer("7")}));
+	auto missing  = var("missing", nullptr, formatted("%s %s", {integer("7")}));
+
+	Constants().run(list({list({unit("main"), shortest, fixed, whole, mismatch, unknown, missing})}));
+
+	assert(folded(shortest) == std::string_view(format::format("%s", 1.50).view()));
+	assert(folded(shortest) == "1.5" && folded(fixed) == "7% of 1.50" && folded(whole) == "7");
+	assert(as(CallNode, mismatch->value) && as(CallNode, unknown->value) && as(CallNode, missing->value));
+}
+
+int main() {
+	folds();
+	keepsOverflows();
+	foldsFormats();
+}
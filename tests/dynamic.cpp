@@ -0,0 +1,34 @@
+#include <cassert>
+#include <cstdint>
+
+#include "runtime/dynamic.h"
+
+using namespace pint;
+
+static_assert(sizeof(Dynamic) == 8);
+
+static void boxes() {
+	int pointee = 0;
+
+	assert(Dynamic().isVoid());
+	assert(Dynamic::fromInteger(-5).toInteger() == -5);
+	assert(Dynamic::fromReal(-1.5).toReal() == -1.5);
+	assert(Dynamic::fromReal(0.0 / 0.0).isReal());
+	assert(Dynamic::fromBoolean(true).toBoolean());
+	assert(Dynamic::fromChar(U'é').toChar() == U'é');
+	assert(Dynamic::fromString("hé").toString() == "hé");
+	assert(Dynamic::fromPointer(&pointee).toPointer() == &pointee);
+}
+
+static void arithmetic() {
+	assert((Dynamic::fromInteger(2) + Dynamic::fromInteger(3)).toInteger() == 5);
+	assert((Dynamic::fromInteger(3) / Dynamic::fromInteger(2)).toReal() == 1.5);
+	assert((Dynamic::fromInteger(Dynamic::MAX_INTEGER) + Dynamic::fromInteger(1)).isReal());
+	assert(Dynamic::fromInteger(1) == Dynamic::fromReal(1.0));
+	assert(Dynamic::fromInteger(1) < Dynamic::fromReal(1.5));
+}
+
+int main() {
+	boxes();
+	arithmetic();
+}
@@ -0,0 +1,144 @@
+#include <cassert>
+
+#include "escape.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<FunctionNode> variadic(std::shared_ptr<ListNode> body) {
+	auto parts = var("parts", nullptr);
+
+	parts->variadic = true;
+
+	return function(list({parts}), nullptr, body);
+}
+
+static bool escapes(std::shared_ptr<FunctionNode> function) {
+	return as(VarNode, function->params->list.front())->escapes;
+}
+
+static void containsVariadics() {
+	auto iterated = variadic(list({
+		std::make_shared<ForNode>(ForNode::Kind::IN, identifier("part"), identifier("parts"), list({
+			assign("return", binary("+", identifier("return"), identifier("part")))
+		}))
+	}));
+	auto stored = variadic(list({assign("saved", identifier("parts"))}));
+	auto counted = variadic(list({
+		std::make_shared<CallNode>(identifier("g"), list({std::make_shared<MemberNode>(identifier("parts"), identifier("length"))}))
+	}));
+	auto first    = std::make_shared<ReturnNode>(std::make_shared<IndexNode>(identifier("parts"), integer("0")));
+	auto captured = variadic(list({std::make_shared<ReturnNode>(function(list({}), nullptr, list({first})))}));
+	auto shadowed = variadic(list({std::make_shared<ReturnNode>(function(list({var("parts", nullptr)}), nullptr, list({first})))}));
+
+	assert(VariadicEscape().run(list({iterated, stored, counted, captured, shadowed})) == 3);
+	assert(!escapes(iterated) && escapes(stored) && !escapes(counted));
+	assert(escapes(captured) && !escapes(shadowed));
+}
+
+static void skipsMissingParams() {
+	auto body = list({variadic(list({}))});
+
+	assert(VariadicEscape().run(list({std::make_shared<FunctionNode>(nullptr, nullptr, body)})) == 1);
+}
+
+static std::shared_ptr<CallNode> call(std::shared_ptr<Node> target, std::shared_ptr<ListNode> args) {
+	return std::make_shared<CallNode>(target, args);
+}
+
+static std::shared_ptr<FunctionNode> adding() {
+	return function(list({var("x", nullptr)}), nullptr, list({std::make_shared<ReturnNode>(binary("+", identifier("x"), identifier("n")))}));
+}
+
+/**
+ * Literals in `function(xs: integer[], o: object)` capturing its local `n`.
+ */
+static std::shared_ptr<FunctionNode> outer(std::initializer_list<std::shared_ptr<Node>> statements) {
+	auto body = list({var("n", type("integer"), integer("1"))});
+
+	body->list.insert(body->list.end(), statements);
+
+	return function(list({var("xs", std::make_shared<TypeNode>(type("integer"), 0)), var("o", type("object"))}), nullptr, body);
+}
+
+static std::shared_ptr<CallNode> apply(std::string receiver, std::string method, std::shared_ptr<Node> function) {
+	return call(std::make_shared<MemberNode>(identifier(receiver), identifier(method)), list({function}));
+}
+
+static void placesEnvironments() {
+	auto called   = adding();
+	auto bound    = var("f", nullptr, called);
+	auto returned = adding();
+	auto mapped   = adding();
+	auto chained  = adding();
+	auto kept     = adding();
+	auto plain    = function(list({var("x", nullptr)}), nullptr, list({std::make_shared<ReturnNode>(identifier("x"))}));
+	auto root     = outer({
+		bound,
+		call(identifier("f"), list({integer("2")})),
+		std::make_shared<ReturnNode>(returned),
+		apply("xs", "map", mapped),
+		call(std::make_shared<MemberNode>(apply("xs", "filter", identifier("g")), identifier("map")), list({chained})),
+		apply("o", "map", kept),
+		apply("o", "map", plain)
+	});
+
+	assert(ClosureEscape().run(root) == 5);
+	assert(called->environment == FunctionNode::Environment::STACK && !bound->escapes);
+	assert(returned->environment == FunctionNode::Environment::HEAP);
+	assert(mapped->environment == FunctionNode::Environment::STACK && chained->environment == FunctionNode::Environment::STACK);
+	assert(kept->environment == FunctionNode::Environment::HEAP && plain->environment == FunctionNode::Environment::NONE);
+	assert(called->captures == std::vector<std::string>({"n"}));
+}
+
+/**
+ * `set twice = function(x) = add(add(x))` holds add in its environment, so add escapes when
+ * twice does.
+ */
+static void followsCaptures() {
+	auto kept     = adding();
+	auto twice    = function(list({var("x", nullptr)}), nullptr, list({
+		std::make_shared<ReturnNode>(call(identifier("add"), list({call(identifier("add"), list({identifier("x")}))})))
+	}));
+	auto gone     = adding();
+	auto later    = function(list({}), nullptr, list({std::make_shared<ReturnNode>(call(identifier("add"), list({identifier("n")})))}));
+	auto add      = var("add", nullptr, kept);
+	auto addLater = var("add", nullptr, gone);
+	auto laterVar = var("later", nullptr, later);
+
+	ClosureEscape().run(list({
+		outer({add, var("twice", nullptr, twice), std::make_shared<ReturnNode>(call(identifier("twice"), list({integer("1")})))}),
+		outer({addLater, laterVar, std::make_shared<ReturnNode>(identifier("later"))})
+	}));
+
+	assert(kept->environment == FunctionNode::Environment::STACK && twice->environment == FunctionNode::Environment::STACK);
+	assert(twice->captures == std::vector<std::string>({"add"}) && !add->escapes);
+	assert(later->environment == FunctionNode::Environment::HEAP && gone->environment == FunctionNode::Environment::HEAP);
+	assert(laterVar->escapes && addLater->escapes);
+}
+
+/**
+ * A function registered inside another keeps its captures on the heap, one capturing
+ * nothing needs no environment.
+ */
+static void placesNamed() {
+	auto nested = adding();
+	auto alone  = function(list({}), nullptr, list({}));
+
+	nested->name = identifier("add");
+	alone->name  = identifier("alone");
+
+	ClosureEscape().run(list({outer({nested}), alone}));
+
+	assert(nested->environment == FunctionNode::Environment::HEAP && nested->captures.size() == 1);
+	assert(alone->environment == FunctionNode::Environment::NONE);
+}
+
+int main() {
+	containsVariadics();
+	skipsMissingParams();
+	placesEnvironments();
+	followsCaptures();
+	placesNamed();
+}
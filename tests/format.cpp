@@ -0,0 +1,43 @@
+#include <cassert>
+#include <stdexcept>
+
+#include "runtime/format.h"
+
+using namespace pint;
+
+static void writesCharacters() {
+	assert(format::format("%s", U'a').view() == "a");
+	assert(format::format("%s", U'é').view() == "é");
+	assert(format::format("[%s]", 'x').view() == "[x]");
+	assert(format::format("%d", U'a').view() == "97");
+}
+
+static void writesNumbers() {
+	assert(format::format("%s|%s|%f", 1.5, true, 7).view() == "1.5|true|7");
+	assert(format::format("%.2f%%", 3.14159).view() == "3.14%");
+	assert(format::format("%d", -42).view() == "-42");
+}
+
+static void matchesBuilder() {
+	String<8> path("/etc/app/config.jin");
+	auto built = format::Builder(8 + format::estimate(path, {'s'}) + format::estimate(U'a', {'s'}))
+		.text("at ").put(path, {'s'}).text(" ").put(U'a', {'s'}).done();
+
+	assert(built == format::format("at %s %s", path, U'a'));
+}
+
+static void rejects() {
+	for (auto pattern: {"%q", "%.2d", "%s %s", ""}) {
+		try {
+			format::format(pattern, 1);
+			assert(false);
+		} catch (const std::invalid_argument &) {}
+	}
+}
+
+int main() {
+	writesCharacters();
+	writesNumbers();
+	matchesBuilder();
+	rejects();
+}
@@ -0,0 +1,82 @@
+#include <cassert>
+#include <stdexcept>
+
+#include "generics.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<TypeNode> generic(std::string name, std::initializer_list<std::shared_ptr<Node>> arguments) {
+	auto type = nodes::type(name);
+
+	type->arguments = list(arguments);
+
+	return type;
+}
+
+static std::shared_ptr<ClassNode> form(std::string name, std::shared_ptr<ListNode> parameters, std::shared_ptr<ListNode> bases, std::shared_ptr<ListNode> body) {
+	return std::make_shared<ClassNode>(ClassNode::Kind::CLASS, identifier(name), parameters, bases, body);
+}
+
+/**
+ * `Repository<T of Entity>` with `find: function(id: integer): T` and a `List<T>` cache,
+ * `List<T>`, and `Nest<T>` holding a `Nest<List<T>>`, which recurses without end.
+ */
+static std::shared_ptr<ListNode> program(std::shared_ptr<ClassNode> &repository, std::shared_ptr<ClassNode> &sequence, std::shared_ptr<ClassNode> &nest, std::shared_ptr<TypeNode> &base, std::shared_ptr<VarNode> &people, std::shared_ptr<VarNode> &orders) {
+	auto find = var("find", nullptr, function(list({var("id", type("integer"))}), type("T"), list({})));
+
+	repository = form("Repository", list({var("T", type("Entity"))}), list({}), list({find, var("cache", generic("List", {type("T")}))}));
+	sequence   = form("List", list({var("T", nullptr)}), list({}), list({var("items", std::make_shared<TypeNode>(type("T"), 0))}));
+	nest       = form("Nest", list({var("T", nullptr)}), list({}), list({var("inner", generic("Nest", {generic("List", {type("T")})}))}));
+	base       = generic("Repository", {type("Person")});
+	people     = var("a", generic("Repository", {type("Person")}));
+	orders     = var("b", generic("Repository", {type("Order")}));
+
+	return list({repository, sequence, nest, form("People", list({}), list({base}), list({})), people, orders, var("n", generic("Nest", {type("integer")}))});
+}
+
+static void instantiates() {
+	std::shared_ptr<ClassNode> repository, sequence, nest;
+	std::shared_ptr<TypeNode> base;
+	std::shared_ptr<VarNode> people, orders;
+	auto root = program(repository, sequence, nest, base, people, orders);
+
+	Generics().run(root);
+
+	assert(repository->instances.size() == 2 && repository->instances[0].key == "Repository<Person>");
+	assert(repository->instances[0].uses == 2 && base->instance == 0);
+	assert(people->type->instance == 0 && orders->type->instance == 1);
+	assert(sequence->instances[0].key == "List<Person>" && sequence->instances[1].key == "List<Order>");
+	assert(nest->instances.size() == Generics::DEPTH + 1);
+	assert(nest->instances.back().boxed && !nest->instances[Generics::DEPTH - 1].boxed);
+}
+
+/**
+ * Past the budget the least used instances are boxed.
+ */
+static void boxes() {
+	std::shared_ptr<ClassNode> repository, sequence, nest;
+	std::shared_ptr<TypeNode> base;
+	std::shared_ptr<VarNode> people, orders;
+	auto root = program(repository, sequence, nest, base, people, orders);
+
+	Generics(1).run(root);
+
+	assert(!repository->instances[0].boxed && repository->instances[1].boxed);
+}
+
+static void rejects() {
+	auto repository = form("Repository", list({var("T", nullptr)}), list({}), list({}));
+
+	try {
+		Generics().run(list({repository, var("x", generic("Repository", {type("A"), type("B")}))}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+}
+
+int main() {
+	instantiates();
+	boxes();
+	rejects();
+}
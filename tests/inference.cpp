@@ -0,0 +1,102 @@
+#include <cassert>
+#include <stdexcept>
+
+#include "inference.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+/**
+ * `var <name>: ();`
+ */
+static std::shared_ptr<VarNode> fixed(std::string name, std::shared_ptr<Node> value = nullptr) {
+	auto type = std::make_shared<TypeNode>();
+
+	type->fixedType = true;
+	type->setSize(0);
+
+	return var(name, type, value);
+}
+
+/**
+ * `var <name>:;`
+ */
+static std::shared_ptr<VarNode> implicit(std::string name, std::shared_ptr<Node> value = nullptr) {
+	auto type = std::make_shared<TypeNode>();
+
+	type->fixedType = true;
+
+	return var(name, type, value);
+}
+
+static void infers() {
+	auto assigned = implicit("b");
+	auto text     = fixed("c", string("abc"));
+	auto widened  = implicit("d");
+	auto mixed    = implicit("e");
+	auto used     = implicit("f");
+	Inference inference;
+
+	assert(inference.run(list({
+		assigned, assign("b", integer("5")),
+		text, assign("c", string("xy")),
+		widened, assign("d", integer("5")), assign("d", integer("3000000000")),
+		mixed, assign("e", integer("5")), assign("e", string("x")),
+		used, var("g", type("integer", 8), identifier("f"))
+	})) == 1);
+
+	assert(assigned->type->name == "integer" && assigned->type->size == 32);
+	assert(text->type->name == "string" && text->type->fixedSize && text->type->size == 8);
+	assert(widened->type->name == "integer" && !widened->type->fixedSize && widened->type->size == 64);
+	assert(inference.getDynamic() == std::vector<VarNode *>({mixed.get()}));
+	assert(used->type->name == "integer" && used->type->size == 8);
+}
+
+/**
+ * An implicit fixed size is set on initialization, a wider value later does not fit.
+ */
+static void keepsFixedSizes() {
+	auto narrower = fixed("c", integer("3000000000"));
+
+	Inference().run(list({narrower, assign("c", integer("5"))}));
+
+	assert(narrower->type->name == "integer" && narrower->type->size == 64);
+
+	try {
+		Inference().run(list({fixed("c", integer("5")), assign("c", integer("3000000000"))}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+
+	try {
+		Inference().run(list({fixed("c"), assign("c", integer("5")), assign("c", integer("3000000000"))}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+}
+
+/**
+ * A string literal is a string whatever its length, and a char only given to a variable of chars.
+ */
+static void typesStrings() {
+	auto sep    = implicit("sep", string(","));
+	auto accent = implicit("accent", string("é"));
+	auto letter = implicit("letter");
+	auto narrow = implicit("narrow");
+	Inference inference;
+
+	assert(inference.run(list({
+		sep, assign("sep", string(", ")),
+		accent,
+		letter, var("l", type("char"), identifier("letter")), assign("letter", string("x")),
+		narrow, var("n", type("char", 8), identifier("narrow")), assign("narrow", string("é"))
+	})) == 1);
+
+	assert(sep->type->name == "string" && accent->type->name == "string" && letter->type->name == "char");
+	assert(inference.getDynamic() == std::vector<VarNode *>({narrow.get()}));
+}
+
+int main() {
+	infers();
+	keepsFixedSizes();
+	typesStrings();
+}
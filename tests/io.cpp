@@ -0,0 +1,73 @@
+#include <cassert>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "runtime/io.h"
+
+using namespace pint;
+
+/**
+ * Whatever has reached the read end of the pipe so far.
+ */
+static std::string drain(int fd) {
+	std::string result;
+	char chunk[4096];
+	ssize_t got;
+
+	while ((got = ::read(fd, chunk, sizeof(chunk))) > 0) {
+		result.append(chunk, got);
+	}
+
+	return result;
+}
+
+static void buffers(int in, int out) {
+	Output output(out, Output::Mode::FULL);
+	std::string_view parts[] = {"x is ", "42"};
+
+	output.writeLn(parts);
+	assert(drain(in).empty());
+
+	output.flush();
+	assert(drain(in) == "x is 42\n");
+}
+
+static void flushesLines(int in, int out) {
+	Output output(out, Output::Mode::LINE);
+	std::string_view parts[] = {"a", "b"};
+
+	output.write("partial ");
+	assert(drain(in).empty());
+
+	output.writeLn(parts, "\r\n");
+	assert(drain(in) == "partial ab\r\n");
+}
+
+static void coalesces(int in, int out) {
+	std::string big(20000, 'a');
+	std::string_view parts[] = {big, big};
+
+	{
+		Output output(out, Output::Mode::FULL, 100);
+
+		output.write("hi");
+		output.writeLn(parts);
+	}
+
+	assert(drain(in) == "hi" + big + big + "\n");
+}
+
+int main() {
+	int ends[2];
+
+	assert(::pipe(ends) == 0);
+	assert(::fcntl(ends[0], F_SETFL, O_NONBLOCK) == 0);
+	assert(::fcntl(ends[1], F_SETPIPE_SZ, 1 << 20) > 0);
+
+	buffers(ends[0], ends[1]);
+	flushesLines(ends[0], ends[1]);
+	coalesces(ends[0], ends[1]);
+}
@@ -0,0 +1,23 @@
+#include <cassert>
+#include <stdexcept>
+#include <string_view>
+
+#include "runtime/label.h"
+
+using namespace pint;
+
+static constexpr std::string_view NAMES[] = {"INFO", "WARNING", "ERROR", "FATAL", "PANIC", "CRITICAL"};
+static constexpr LabelFamily LEVEL = {"Logger.Level", NAMES};
+
+static_assert(LEVEL.span() == 6 && LEVEL.codeOf("PANIC") == 4);
+static_assert(sizeof(LabelCode<6>) == 1 && sizeof(LabelCode<300>) == 2);
+
+int main() {
+	assert(LEVEL.nameOf(5) == "CRITICAL");
+	assert(!LEVEL.codeOf("NOPE"));
+
+	try {
+		LEVEL.nameOf(6);
+		assert(false);
+	} catch (const std::out_of_range &) {}
+}
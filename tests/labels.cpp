@@ -0,0 +1,96 @@
+#include <cassert>
+#include <stdexcept>
+
+#include "labels.h"
+#include "nodes.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<LabelNode> label(std::string name, std::shared_ptr<ListNode> extends, std::shared_ptr<ListNode> values) {
+	return std::make_shared<LabelNode>(identifier(name), extends, values);
+}
+
+static std::shared_ptr<LabelValueNode> value(std::shared_ptr<Node> label, std::string value) {
+	return std::make_shared<LabelValueNode>(label, identifier(value));
+}
+
+static void numbersFamilies() {
+	auto level = label("Level", nullptr, list({identifier("INFO"), identifier("WARNING"), identifier("ERROR")}));
+	auto zed   = label("Zed", list({identifier("Level")}), list({identifier("CRITICAL")}));
+	auto alt   = label("Alt", list({identifier("Level")}), list({identifier("FATAL")}));
+	auto sub   = label("Sub", list({identifier("Alt")}), list({identifier("PANIC")}));
+
+	assert(Labels(true).run(list({sub, zed, level, alt})) == 1);
+	assert(level->span == 6 && alt->codes["FATAL"] == 3 && sub->codes["PANIC"] == 4 && zed->codes["CRITICAL"] == 5);
+	assert((*sub->names)[5] == "CRITICAL" && sub->family == level->family);
+}
+
+/**
+ * A unit's own Level extending Logger's, which keeps its values.  Values name the label of
+ * their own unit unless qualified.
+ */
+static void qualifiesNames() {
+	auto logged = label("Level", nullptr, list({identifier("INFO"), identifier("ERROR")}));
+	auto level  = label("Level", list({identifier("Logger.Level")}), list({identifier("CRITICAL")}));
+	auto own    = value(identifier("Level"), "CRITICAL");
+	auto other  = value(std::make_shared<MemberNode>(identifier("Logger"), identifier("Level")), "ERROR");
+	auto root   = list({
+		list({unit("Logger"), logged}),
+		list({unit("main"), level, own, other})
+	});
+
+	assert(Labels(true).run(root) == 1);
+	assert(logged->codes.size() == 2 && level->codes.size() == 3);
+	assert(own->family == "Logger.Level" && own->code == 2);
+	assert(other->family == "Logger.Level" && other->code == 1);
+
+	try {
+		Labels(true).run(list({
+			list({unit("Logger"), logged}),
+			list({unit("main"), level, value(std::make_shared<MemberNode>(identifier("Logger"), identifier("Level")), "CRITICAL")})
+		}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+}
+
+static void rejects() {
+	try {
+		Labels(true).run(list({
+			label("A", list({identifier("B")}), list({identifier("X")})),
+			label("B", list({identifier("A")}), list({identifier("Y")}))
+		}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+
+	auto far = label("C", list({identifier("Other.Unit")}), list({identifier("X")}));
+
+	assert(Labels(true).run(list({far, label("D", list({identifier("C")}), list({identifier("Y")}))})) == 0);
+	assert(far->family.empty());
+}
+
+/**
+ * Another compilation may extend Level, so its values keep no codes unless the tree is closed.
+ */
+static void staysOpen() {
+	auto level = label("Level", nullptr, list({identifier("INFO"), identifier("ERROR")}));
+	auto info  = value(identifier("Level"), "INFO");
+
+	assert(Labels().run(list({level, info})) == 0);
+	assert(level->family.empty() && level->codes.empty() && info->code == -1);
+
+	try {
+		Labels().run(list({
+			label("A", list({identifier("B")}), list({identifier("X")})),
+			label("B", list({identifier("A")}), list({identifier("Y")}))
+		}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+}
+
+int main() {
+	numbersFamilies();
+	qualifiesNames();
+	rejects();
+	staysOpen();
+}
@@ -0,0 +1,58 @@
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+
+#include "layout.h"
+#include "runtime/array.h"
+
+using namespace pint;
+
+static std::shared_ptr<TypeNode> sized(std::string name, std::size_t size) {
+	auto type = std::make_shared<TypeNode>(name);
+
+	type->setSize(size);
+
+	return type;
+}
+
+static void scalars() {
+	assert(Layout::bytes(*sized("integer", 8)) == 1);
+	assert(Layout::bytes(*sized("cardinal", 12)) == 2);
+	assert(Layout::bytes(*sized("real", 64)) == 8);
+	assert(Layout::bytes(*sized("char", 8)) == 1);
+	assert(Layout::bytes(*sized("char", 16)) == 2);
+	assert(Layout::bytes(*sized("char", 32)) == 4);
+	assert(Layout::bytes(TypeNode("integer")) == 0);
+}
+
+static void arrays() {
+	TypeNode fixed(sized("integer", 8), 5);
+	TypeNode dynamic(sized("integer", 8), 0);
+
+	assert(Layout::bytes(fixed) == 5 && Layout::storage(fixed) == Storage::INLINE);
+	assert(Layout::storage(dynamic) == Storage::HEAP);
+	assert(Layout::bytes(TypeNode(sized("boolean", 1), 100)) == 16);
+	assert(Layout::bytes(TypeNode(sized("char", 8), 5)) == 5);
+	assert(Layout::bytes(TypeNode(sized("char", 16), 5)) == 10);
+	assert(Layout::align(TypeNode(sized("char", 16), 5)) == 2);
+}
+
+static void storage() {
+	Array<int, 5> fixed;
+	Array<int> dynamic(3);
+
+	fixed.get<4>() = 3;
+
+	assert(fixed[4] == 3 && sizeof(fixed) == 5 * sizeof(int));
+
+	try {
+		dynamic.at(3);
+		assert(false);
+	} catch (const std::out_of_range &) {}
+}
+
+int main() {
+	scalars();
+	arrays();
+	storage();
+}
@@ -0,0 +1,95 @@
+#include <cassert>
+#include <string>
+
+#include "loops.h"
+#include "nodes.h"
+#include "runtime/object.h"
+#include "runtime/string.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<ForNode> loop(ForNode::Kind kind, std::string variable, std::shared_ptr<Node> subject, std::shared_ptr<ListNode> body = nullptr) {
+	return std::make_shared<ForNode>(kind, identifier(variable), subject, body ? body : list({}));
+}
+
+static void findsSubjects() {
+	std::vector<std::shared_ptr<ForNode>> loops = {
+		loop(ForNode::Kind::IN, "x", identifier("a")),
+		loop(ForNode::Kind::IN, "x", identifier("s")),
+		loop(ForNode::Kind::OF, "x", identifier("o")),
+		loop(ForNode::Kind::IN, "x", identifier("d")),
+		loop(ForNode::Kind::OF, "x", std::make_shared<ArrayNode>(list({}))),
+		loop(ForNode::Kind::IN, "x", string("héllo"))
+	};
+	auto root = list({
+		var("a", std::make_shared<TypeNode>(type("integer"), 0)),
+		var("s", type("string")),
+		var("o", type("object")),
+		var("d", nullptr)
+	});
+
+	root->list.insert(root->list.end(), loops.begin(), loops.end());
+
+	assert(Loops().run(root) == 5);
+	assert(loops[0]->over == ForNode::Over::ARRAY && loops[1]->over == ForNode::Over::STRING);
+	assert(loops[2]->over == ForNode::Over::OBJECT && loops[3]->over == ForNode::Over::UNKNOWN);
+	assert(loops[4]->over == ForNode::Over::ARRAY && loops[5]->over == ForNode::Over::STRING);
+}
+
+/**
+ * The loop variable and a function's own declarations hide the outer ones.
+ */
+static void scopes() {
+	auto shadowed = loop(ForNode::Kind::IN, "c", identifier("s"));
+	auto inner    = loop(ForNode::Kind::IN, "c", identifier("s"), list({shadowed}));
+	auto local    = loop(ForNode::Kind::IN, "c", identifier("s"));
+	auto after    = loop(ForNode::Kind::IN, "c", identifier("s"));
+	auto root     = list({
+		var("s", type("string")),
+		loop(ForNode::Kind::IN, "s", identifier("s"), list({inner})),
+		var("f", nullptr, function(nullptr, nullptr, list({var("s", nullptr), local}))),
+		after
+	});
+
+	Loops().run(root);
+
+	assert(inner->over == ForNode::Over::UNKNOWN && shadowed->over == ForNode::Over::UNKNOWN);
+	assert(local->over == ForNode::Over::UNKNOWN && after->over == ForNode::Over::STRING);
+}
+
+static void iterates() {
+	String<8> mixed(std::string_view("aé€😀bc"));
+	std::u32string codes;
+	int calls = 0;
+
+	mixed.each([&](char32_t code) {
+		codes += code;
+	});
+	mixed.each([&](char32_t) {
+		return ++calls < 3;
+	});
+
+	assert(codes == U"aé€😀bc" && calls == 3);
+
+	Object object;
+	long sum = 0;
+
+	for (int i = 0; i < 16; i++) {
+		object.set(Symbol::intern("k" + std::to_string(i)), Dynamic::fromInteger(i));
+	}
+
+	object.each([&](const Symbol *key, const Dynamic &value) {
+		assert(key->name == "k" + std::to_string(value.toInteger()));
+
+		sum += value.toInteger();
+	});
+
+	assert(sum == 120);
+}
+
+int main() {
+	findsSubjects();
+	scopes();
+	iterates();
+}
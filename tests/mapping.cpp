@@ -0,0 +1,107 @@
+#include <cassert>
+
+#include "mapping.h"
+#include "nodes.h"
+#include "runtime/map.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<CallNode> call(std::string name, std::shared_ptr<ListNode> args) {
+	return std::make_shared<CallNode>(identifier(name), args);
+}
+
+static std::shared_ptr<ReturnNode> result(std::shared_ptr<Node> value) {
+	return std::make_shared<ReturnNode>(value);
+}
+
+static std::shared_ptr<FunctionNode> named(std::string name, std::shared_ptr<FunctionNode> function) {
+	function->name = identifier(name);
+
+	return function;
+}
+
+static std::shared_ptr<Node> between(std::string low, std::string high) {
+	return binary("and", binary("<=", string(low), identifier("c")), binary("<=", identifier("c"), string(high)));
+}
+
+/**
+ * `register encode: function(c: char): char` rotating letters through a local `set shift`,
+ * and `register encode: function(msg: string): string = msg[encode]`.
+ */
+static void resolvesOverloads() {
+	auto shift = var("shift", nullptr, function(list({var("c", nullptr), var("basis", nullptr)}), nullptr, list({
+		result(binary("+", binary("%", binary("+", binary("-", identifier("c"), identifier("basis")), integer("13")), integer("26")), identifier("basis")))
+	})));
+	auto rotate = std::make_shared<IfNode>(between("a", "z"), list({result(call("shift", list({identifier("c"), string("a")})))}), list({
+		std::make_shared<IfNode>(between("A", "Z"), list({result(call("shift", list({identifier("c"), string("A")})))}), list({result(identifier("c"))}))
+	}));
+
+	shift->constant = true;
+
+	auto character = named("encode", function(list({var("c", type("char"))}), type("char"), list({shift, rotate})));
+	auto index     = std::make_shared<IndexNode>(identifier("msg"), identifier("encode"));
+	auto message   = named("encode", function(list({var("msg", type("string"))}), type("string"), list({result(index)})));
+
+	assert(Mapping().run(list({character, message})) == 1);
+	assert(index->mapper == character && character->pure);
+}
+
+static void judgesPurity() {
+	auto increment = function(list({var("x", nullptr)}), nullptr, list({result(binary("+", identifier("x"), integer("1")))}));
+	auto printing  = function(list({var("x", nullptr)}), nullptr, list({call("print", list({identifier("x")})), result(identifier("x"))}));
+	auto global    = function(list({var("x", nullptr)}), nullptr, list({assign("total", identifier("x")), result(identifier("x"))}));
+	auto pair      = function(list({var("x", nullptr), var("y", nullptr)}), nullptr, list({result(identifier("x"))}));
+	auto map       = [](std::shared_ptr<Node> function) {
+		return std::make_shared<CallNode>(std::make_shared<MemberNode>(identifier("xs"), identifier("map")), list({function}));
+	};
+	auto pure    = map(increment);
+	auto impure  = map(printing);
+	auto assigns = map(global);
+	auto arity   = map(pair);
+	auto element = std::make_shared<IndexNode>(identifier("xs"), identifier("i"));
+	auto root    = list({
+		var("total", type("integer")),
+		var("xs", std::make_shared<TypeNode>(type("integer"), 0)),
+		pure, impure, assigns, arity,
+		var("i", nullptr),
+		element
+	});
+
+	assert(Mapping().run(root) == 1);
+	assert(pure->mapper == increment && increment->pure);
+	assert(impure->mapper == printing && !printing->pure && assigns->mapper == global && !global->pure);
+	assert(!arity->mapper && !element->mapper);
+}
+
+static void mapsStrings() {
+	CharMap rot13([](char32_t c) -> char32_t {
+		auto shift = [](char32_t c, char32_t basis) {
+			return (c - basis + 13) % 26 + basis;
+		};
+
+		return 'a' <= c && c <= 'z' ? shift(c, 'a') : 'A' <= c && c <= 'Z' ? shift(c, 'A') : c;
+	});
+
+	assert(rot13(String<8>("Hello, World!")).view() == "Uryyb, Jbeyq!");
+	assert(rot13(String<8>("Grüße aus Köln")).view() == "Teüßr nhf Xöya");
+	assert(rot13(rot13(String<8>("Round trip 123"))).view() == "Round trip 123");
+
+	Array<int64_t> xs(5);
+
+	for (std::size_t i = 0; i < xs.span(); i++) {
+		xs[i] = i;
+	}
+
+	auto squares = map(xs, [](int64_t x) {
+		return x * x;
+	});
+
+	assert(squares.span() == 5 && squares[4] == 16);
+}
+
+int main() {
+	resolvesOverloads();
+	judgesPurity();
+	mapsStrings();
+}
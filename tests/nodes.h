@@ -0,0 +1,68 @@
+#ifndef __PINT_TESTS_NODES_H
+#define __PINT_TESTS_NODES_H
+
+#include <memory>
+#include <string>
+
+#include "tree.h"
+
+namespace pint::nodes {
+	/**
+	 * Shorthands for building the trees the parser would for the passes under test.
+	 */
+	inline std::shared_ptr<IdentifierNode> identifier(std::string name) {
+		return std::make_shared<IdentifierNode>(name);
+	}
+
+	inline std::shared_ptr<LiteralNode> integer(std::string text) {
+		return std::make_shared<LiteralNode>(LiteralNode::Kind::INTEGER, text);
+	}
+
+	inline std::shared_ptr<LiteralNode> string(std::string text) {
+		return std::make_shared<LiteralNode>(LiteralNode::Kind::STRING, text);
+	}
+
+	inline std::shared_ptr<TypeNode> type(std::string name, std::size_t size = 0) {
+		auto type = std::make_shared<TypeNode>(name);
+
+		if (size) {
+			type->setSize(size);
+		}
+
+		return type;
+	}
+
+	inline std::shared_ptr<ListNode> list(std::initializer_list<std::shared_ptr<Node>> items) {
+		auto list = std::make_shared<ListNode>();
+
+		list->list.assign(items);
+
+		return list;
+	}
+
+	inline std::shared_ptr<UnitNode> unit(std::string name) {
+		return std::make_shared<UnitNode>(list({identifier(name)}));
+	}
+
+	inline std::shared_ptr<VarNode> var(std::string name, std::shared_ptr<TypeNode> type, std::shared_ptr<Node> value = nullptr) {
+		auto var = std::make_shared<VarNode>(identifier(name), type ? type : std::make_shared<TypeNode>());
+
+		var->setValue(value);
+
+		return var;
+	}
+
+	inline std::shared_ptr<BinaryNode> binary(std::string op, std::shared_ptr<Node> left, std::shared_ptr<Node> right) {
+		return std::make_shared<BinaryNode>(op, left, right);
+	}
+
+	inline std::shared_ptr<AssignNode> assign(std::string target, std::shared_ptr<Node> value, std::string op = "=") {
+		return std::make_shared<AssignNode>(list({identifier(target)}), value, op);
+	}
+
+	inline std::shared_ptr<FunctionNode> function(std::shared_ptr<ListNode> params, std::shared_ptr<TypeNode> type, std::shared_ptr<ListNode> body) {
+		return std::make_shared<FunctionNode>(params ? params : list({}), type, body);
+	}
+}
+
+#endif
@@ -0,0 +1,45 @@
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+#include "runtime/numeric.h"
+
+using namespace pint;
+
+static_assert(std::is_same_v<Integer<8>, int8_t>);
+static_assert(std::is_same_v<Cardinal<12>, uint16_t>);
+static_assert(std::is_same_v<Real<32>, float>);
+static_assert(std::is_same_v<Real<>, double>);
+static_assert(std::is_same_v<Integer<>, BigInteger>);
+static_assert(nativeName(Base::INTEGER, 8) == "int8_t");
+static_assert(nativeName(Base::CARDINAL, 64) == "uint64_t");
+
+static void promotes() {
+	BigInteger max(INT64_MAX);
+	BigInteger above = max + 1;
+
+	assert(!above.isSmall());
+	assert(above.toString() == "9223372036854775808");
+	assert((above - 1).isSmall() && (above - 1).toSmall() == INT64_MAX);
+	assert((BigInteger(INT64_MIN) - 1).toString() == "-9223372036854775809");
+	assert((BigInteger(INT64_MIN) - 1 + 1).toSmall() == INT64_MIN);
+	assert((-BigInteger(INT64_MIN)).toString() == "9223372036854775808");
+}
+
+static void multiplies() {
+	BigInteger factorial(1);
+
+	for (int i = 1; i <= 25; i++) {
+		factorial = factorial * BigInteger(i);
+	}
+
+	assert(factorial.toString() == "15511210043330985984000000");
+	assert((-factorial).toString() == "-15511210043330985984000000");
+	assert((factorial - factorial).isSmall() && (factorial - factorial).toSmall() == 0);
+	assert(factorial * (-factorial) < BigInteger(0));
+}
+
+int main() {
+	promotes();
+	multiplies();
+}
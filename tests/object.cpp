@@ -0,0 +1,80 @@
+#include <cassert>
+#include <string>
+
+#include "runtime/object.h"
+
+using namespace pint;
+
+static void sharesShapes() {
+	auto left  = Symbol::intern("left");
+	auto right = Symbol::intern("right");
+	Object a, b, c;
+
+	assert(Symbol::intern("left") == left);
+
+	a.set(left, Dynamic::fromInteger(1));
+	a.set(right, Dynamic::fromInteger(2));
+	b.set(left, Dynamic::fromInteger(3));
+	b.set(right, Dynamic::fromInteger(4));
+	c.set(right, Dynamic::fromInteger(5));
+
+	assert(a.getShape() == b.getShape() && c.getShape() != a.getShape());
+	assert(b.get(right).toInteger() == 4 && a.get(Symbol::intern("x")).isVoid());
+}
+
+static void caches() {
+	auto left  = Symbol::intern("left");
+	auto right = Symbol::intern("right");
+	Object a, b, c;
+	InlineCache site(right);
+
+	a.set(left, Dynamic::fromInteger(1));
+	a.set(right, Dynamic::fromInteger(2));
+	b.set(left, Dynamic::fromInteger(3));
+	b.set(right, Dynamic::fromInteger(4));
+	c.set(right, Dynamic::fromInteger(5));
+
+	assert(site.get(a).toInteger() == 2 && site.get(b).toInteger() == 4 && site.isMonomorphic());
+	assert(site.get(c).toInteger() == 5 && !site.isMonomorphic());
+
+	InlineCache setter(Symbol::intern("z"));
+	Object d, e;
+
+	setter.set(d, Dynamic::fromInteger(9));
+	setter.set(e, Dynamic::fromInteger(8));
+
+	assert(d.getShape() == e.getShape() && e.get(Symbol::intern("z")).toInteger() == 8);
+}
+
+static void loadsAfterStores() {
+	auto key = Symbol::intern("count");
+	InlineCache site(key);
+	Object stored, empty;
+
+	site.set(stored, Dynamic::fromInteger(1));
+
+	assert(site.get(empty).isVoid());
+	assert(site.get(stored).toInteger() == 1);
+
+	site.set(stored, Dynamic::fromInteger(site.get(stored).toInteger() + 1));
+
+	assert(stored.get(key).toInteger() == 2 && site.get(empty).isVoid());
+}
+
+static void grows() {
+	Object object;
+
+	for (int i = 0; i < 20; i++) {
+		object.set(Symbol::intern("k" + std::to_string(i)), Dynamic::fromInteger(i));
+	}
+
+	assert(object.get(Symbol::intern("k3")).toInteger() == 3);
+	assert(object.getShape()->keys()[19] == Symbol::intern("k19"));
+}
+
+int main() {
+	sharesShapes();
+	caches();
+	loadsAfterStores();
+	grows();
+}
@@ -0,0 +1,57 @@
+#include <cassert>
+
+#include "parser.h"
+
+using namespace pint;
+
+static std::shared_ptr<FunctionNode> registered(const std::string &code) {
+	syntax::parser parser;
+	auto unit = as(ListNode, parser.parse(code));
+
+	return as(FunctionNode, unit->list.back());
+}
+
+static void parsesVariadics() {
+	auto function = registered("unit io;\n\nregister writeLn: function(fd: cardinal, ...parts: string): string = fd;\n");
+	auto fd       = as(VarNode, function->params->list[0]);
+	auto parts    = as(VarNode, function->params->list[1]);
+
+	assert(function->params->list.size() == 2);
+	assert(!fd->variadic && fd->name->name == "fd");
+	assert(parts->variadic && parts->name->name == "parts" && parts->type->name == "string");
+}
+
+static void parsesMembers() {
+	auto function = registered("unit main;\n\nregister f: function(): integer = io.EOL.size;\n");
+	auto body     = as(ReturnNode, function->body->list[0]);
+	auto member   = as(MemberNode, body->value);
+
+	assert(member && member->name->name == "size" && as(MemberNode, member->target));
+}
+
+static void parsesFunctionLiterals() {
+	auto function = registered(
+		"unit crypt;\n\n"
+		"register encode: function(c: char): char\n"
+		"begin\n"
+		"\tset shift: function(c, basis) = ((c - basis) + 13) + basis;\n"
+		"\tvar first = function() = c;\n"
+		"\treturn function(): char = first;\n"
+		"end\n"
+	);
+	auto shift    = as(VarNode, as(ListNode, function->body->list[0])->list[0]);
+	auto first    = as(VarNode, as(ListNode, function->body->list[1])->list[0]);
+	auto returned = as(ReturnNode, function->body->list[2]);
+	auto literal  = as(FunctionNode, shift->value);
+
+	assert(shift->constant && shift->type->name == "function");
+	assert(literal && literal->params->list.size() == 2 && as(ReturnNode, literal->body->list[0]));
+	assert(as(FunctionNode, first->value) && as(FunctionNode, first->value)->params->list.empty());
+	assert(as(FunctionNode, returned->value)->type->name == "char");
+}
+
+int main() {
+	parsesVariadics();
+	parsesMembers();
+	parsesFunctionLiterals();
+}
@@ -0,0 +1,124 @@
+#include <cassert>
+#include <cstdint>
+
+#include "nodes.h"
+#include "pipelines.h"
+#include "runtime/pipeline.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<CallNode> call(std::shared_ptr<Node> receiver, std::string name, std::shared_ptr<ListNode> args) {
+	return std::make_shared<CallNode>(std::make_shared<MemberNode>(receiver, identifier(name)), args);
+}
+
+static std::shared_ptr<CallNode> map(std::shared_ptr<Node> receiver) {
+	return call(receiver, "map", list({identifier("f")}));
+}
+
+static std::shared_ptr<TypeNode> integers() {
+	return std::make_shared<TypeNode>(type("integer"), 0);
+}
+
+static void fusesChains() {
+	auto first   = map(identifier("xs"));
+	auto second  = call(first, "filter", list({identifier("g")}));
+	auto stored  = map(second);
+	auto mapped  = map(identifier("xs"));
+	auto reduced = call(mapped, "reduce", list({identifier("g"), integer("0")}));
+	auto looped  = map(identifier("xs"));
+	auto loop    = std::make_shared<ForNode>(ForNode::Kind::IN, identifier("x"), looped, list({}));
+	auto counted = map(call(identifier("xs"), "filter", list({identifier("g")})));
+	auto indexes = std::make_shared<ForNode>(ForNode::Kind::OF, identifier("i"), counted, list({}));
+	auto escapes = map(identifier("xs"));
+	auto early   = call(identifier("xs"), "reduce", list({identifier("g"), integer("0")}));
+	auto late    = map(early);
+	auto dropped = map(string("héllo"));
+	auto root    = list({
+		var("xs", integers()),
+		var("ys", nullptr, stored),
+		reduced,
+		loop,
+		indexes,
+		std::make_shared<ReturnNode>(escapes),
+		var("zs", nullptr, late),
+		dropped
+	});
+
+	assert(Pipelines().run(root) == 6);
+	assert(stored->stages.size() == 3 && stored->materialize && !stored->drained);
+	assert(first->fused && second->fused && !stored->fused);
+	assert(reduced->stages.size() == 2 && !reduced->materialize && !reduced->drained && mapped->fused);
+	assert(looped->stages.size() == 1 && !looped->materialize && loop->over == ForNode::Over::PIPELINE);
+	assert(counted->stages.size() == 2 && counted->materialize && indexes->over != ForNode::Over::PIPELINE);
+	assert(escapes->stages.empty() && late->stages.empty());
+	assert(dropped->stages.size() == 1 && dropped->drained);
+}
+
+/**
+ * Receivers of unknown type, or of a type with methods of its own, keep their calls.
+ */
+static void checksReceivers() {
+	auto object   = map(identifier("o"));
+	auto unknown  = map(identifier("d"));
+	auto shadowed = map(identifier("xs"));
+	auto param    = map(identifier("xs"));
+	auto after    = map(identifier("xs"));
+	auto root     = list({
+		var("xs", integers()),
+		var("o", type("object")),
+		var("d", nullptr),
+		object,
+		unknown,
+		std::make_shared<ForNode>(ForNode::Kind::OF, identifier("xs"), identifier("xs"), list({shadowed})),
+		var("f", nullptr, function(list({var("xs", nullptr)}), nullptr, list({param}))),
+		after
+	});
+
+	assert(Pipelines().run(root) == 1);
+	assert(object->stages.empty() && unknown->stages.empty());
+	assert(shadowed->stages.empty() && param->stages.empty());
+	assert(after->stages.size() == 1 && after->drained);
+}
+
+static void runs() {
+	Array<int64_t> xs(1000);
+
+	for (std::size_t i = 0; i < xs.span(); i++) {
+		xs[i] = i;
+	}
+
+	auto triple = [](int64_t x) {
+		return x * 3;
+	};
+	auto even = [](int64_t x) {
+		return x % 2 == 0;
+	};
+	auto ys  = lazy(xs).map(triple).filter(even).map([](int64_t x) { return x + 1; }).collect();
+	auto sum = lazy(xs).map(triple).filter(even).reduce([](int64_t a, int64_t x) { return a + x; }, int64_t(0));
+	int64_t expected = 0;
+	int calls = 0;
+	int taken = 0;
+
+	for (int64_t i = 0; i < 1000; i += 2) {
+		expected += i * 3;
+	}
+
+	assert(ys.span() == 500 && ys[1] == 7 && sum == expected);
+
+	lazy(xs).map([&](int64_t x) { calls++; return x; }).each([](int64_t) {});
+	lazy(xs).filter([](int64_t x) { return x > 5; }).each([&](int64_t) { return ++taken < 3; });
+
+	assert(calls == 1000 && taken == 3);
+
+	String<8> greeting("Grüße");
+	auto wide = lazy(greeting).filter([](char32_t c) { return c >= 0x80; }).collect();
+
+	assert(wide.span() == 2 && wide[0] == U'ü' && wide[1] == U'ß');
+}
+
+int main() {
+	fusesChains();
+	checksReceivers();
+	runs();
+}
@@ -0,0 +1,42 @@
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+#include "runtime/record.h"
+
+using namespace pint;
+
+static RecordType entry = {"Logger.Entry", 16, 8, nullptr, [](std::byte *fields) {
+	new (fields) int64_t(42);
+	new (fields + 8) int8_t(3);
+}};
+
+static RecordType extended = {"main.Entry", 24, 8, &entry, [](std::byte *fields) {
+	entry.construct(fields);
+	new (fields + 16) char32_t(U'x');
+}};
+
+static void constructs() {
+	auto record = Record::make(extended);
+
+	record->retain();
+
+	assert(record->field<int64_t>(0) == 42 && record->field<int8_t>(8) == 3);
+	assert(record->field<char32_t>(16) == U'x');
+
+	record->release();
+}
+
+static void extends() {
+	Result<int> result = static_cast<const Boxed *>(Record::make(extended));
+	Result<int> base   = static_cast<const Boxed *>(Record::make(entry));
+
+	assert(result.getAlternative().kind() == Dynamic::Kind::BOXED);
+	assert(static_cast<const Boxed *>(result.getAlternative().toBoxed())->is(&entry));
+	assert(!static_cast<const Boxed *>(base.getAlternative().toBoxed())->is(&extended));
+}
+
+int main() {
+	constructs();
+	extends();
+}
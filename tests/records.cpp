@@ -0,0 +1,82 @@
+#include <cassert>
+#include <stdexcept>
+
+#include "nodes.h"
+#include "records.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static std::shared_ptr<RecordNode> record(std::string name, std::shared_ptr<ListNode> extends, std::shared_ptr<ListNode> fields) {
+	return std::make_shared<RecordNode>(identifier(name), extends, fields);
+}
+
+static std::size_t offset(const RecordNode &record, std::string name) {
+	for (auto &field: record.layout) {
+		if (field.var->name->name == name) {
+			return field.offset;
+		}
+	}
+
+	assert(false);
+
+	return 0;
+}
+
+static void laysOut() {
+	auto entry = record("Entry", nullptr, list({
+		var("flag", type("boolean", 1)),
+		var("when", type("integer", 64)),
+		var("level", type("integer", 8))
+	}));
+
+	assert(Records().run(list({entry})) == 1);
+	assert(entry->bytes == 16 && entry->align == 8);
+	assert(offset(*entry, "when") == 0 && offset(*entry, "flag") == 8 && offset(*entry, "level") == 9);
+	assert(entry->constructor->params->list.size() == 3);
+}
+
+/**
+ * A unit's own Entry extending Logger's, which keeps its layout.  The extension's fields go
+ * after the base's padding, never into it.
+ */
+static void qualifiesNames() {
+	auto logged = record("Entry", nullptr, list({
+		var("when", type("integer", 64)),
+		var("level", type("integer", 8))
+	}));
+	auto entry = record("Entry", list({identifier("Logger.Entry")}), list({
+		var("small", type("integer", 16))
+	}));
+	auto root = list({
+		list({unit("Logger"), logged}),
+		list({unit("main"), entry})
+	});
+
+	assert(Records().run(root) == 2);
+	assert(logged->layout.size() == 2 && logged->bytes == 16);
+	assert(entry->layout.size() == 3 && offset(*entry, "small") == 16 && entry->bytes == 24);
+}
+
+static void rejects() {
+	auto base = record("Base", nullptr, list({var("when", nullptr)}));
+	auto unknown = record("Unknown", list({identifier("Elsewhere.Thing")}), list({var("x", nullptr)}));
+
+	assert(Records().run(list({base, unknown})) == 1 && unknown->layout.empty());
+
+	try {
+		Records().run(list({base, record("Twice", list({identifier("Base")}), list({var("when", nullptr)}))}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+
+	try {
+		Records().run(list({record("Loop", list({identifier("Loop")}), list({}))}));
+		assert(false);
+	} catch (const std::runtime_error &) {}
+}
+
+int main() {
+	laysOut();
+	qualifiesNames();
+	rejects();
+}
@@ -0,0 +1,85 @@
+#include <cassert>
+
+#include "runtime/result.h"
+
+using namespace pint;
+
+/**
+ * A more specific kind of Error, as the io unit would declare.
+ */
+class IOError: public Error {
+	public:
+		static constexpr Type TYPE = {&Error::TYPE};
+
+		IOError(std::string message): Error(&TYPE, std::move(message), "", nullptr) {}
+};
+
+static Result<int> getConfig(int value) {
+	if (value < 0) {
+		return new Error("Could not open", "getConfig", new Error("inner"));
+	}
+
+	return value * 2;
+}
+
+static void succeeds() {
+	auto result = getConfig(2);
+
+	assert(result.ok() && result.get() == 4 && !result.is<Error>());
+}
+
+static void fails() {
+	auto result = getConfig(-1);
+	auto error  = result.is<Error>();
+
+	assert(!result.ok() && error);
+	assert(error->getMessage() == "Could not open" && error->getFunction() == "getConfig");
+	assert(error->getPrevious()->getMessage() == "inner" && !error->getPrevious()->getPrevious());
+
+	Result<int> copy = 5;
+
+	copy = result;
+
+	assert(copy.is<Error>() == error && error->references == 2);
+}
+
+static void sharesAlternatives() {
+	Result<int> first = new Error("shared");
+	auto error = first.is<Error>();
+
+	{
+		Result<int> second = first.getAlternative();
+
+		assert(second.is<Error>() == error && error->references == 2);
+	}
+
+	assert(error->references == 1 && error->getMessage() == "shared");
+}
+
+static void ignoresPointers() {
+	int pointee = 0;
+	Result<int> pointer = Dynamic::fromPointer(&pointee);
+	Result<int> integer = Dynamic::fromInteger(7);
+
+	assert(!pointer.ok() && !pointer.is<Error>());
+	assert(!integer.ok() && !integer.is<Error>() && integer.getAlternative().toInteger() == 7);
+}
+
+static void matchesParents() {
+	Result<int> result = new IOError("disk full");
+
+	assert(result.is<IOError>() && result.is<Error>());
+	assert(result.is<Error>()->getMessage() == "disk full");
+
+	Result<int> plain = new Error("plain");
+
+	assert(plain.is<Error>() && !plain.is<IOError>());
+}
+
+int main() {
+	succeeds();
+	fails();
+	sharesAlternatives();
+	ignoresPointers();
+	matchesParents();
+}
@@ -0,0 +1,59 @@
+#include <cassert>
+
+#include "runtime/rope.h"
+
+using namespace pint;
+
+static void concatenates() {
+	Rope<> rope("a");
+
+	for (int i = 0; i < 100000; i++) {
+		rope = rope + Rope<>("é");
+	}
+
+	assert(rope.units() == 200001);
+	assert(rope.span() == 100001 && rope.at(5) == U'é');
+}
+
+static void flattensDeep() {
+	Rope<> rope;
+
+	for (int i = 0; i < 1000000; i++) {
+		rope += Rope<>("x");
+	}
+
+	assert(rope.span() == 1000000);
+}
+
+static void dropsDeep() {
+	Rope<> rope;
+
+	for (int i = 0; i < 1000000; i++) {
+		rope += Rope<>("x");
+	}
+
+	rope = Rope<>("y");
+
+	assert(rope.span() == 1);
+}
+
+static void keepsShared() {
+	Rope<> shared;
+	Rope<> extended;
+
+	for (int i = 0; i < 1000; i++) {
+		shared += Rope<>("x");
+	}
+
+	extended = shared + Rope<>("y");
+	shared   = Rope<>();
+
+	assert(extended.span() == 1001 && extended.at(1000) == U'y');
+}
+
+int main() {
+	concatenates();
+	flattensDeep();
+	dropsDeep();
+	keepsShared();
+}
@@ -0,0 +1,28 @@
+#include <cassert>
+
+#include "nodes.h"
+#include "sites.h"
+
+using namespace pint;
+using namespace pint::nodes;
+
+static void numbersMembers() {
+	auto first  = std::make_shared<MemberNode>(identifier("context"), identifier("left"));
+	auto second = std::make_shared<MemberNode>(identifier("context"), identifier("right"));
+
+	assert(CacheSites().run(list({first, second})) == 2);
+	assert(first->cache == 0 && second->cache == 1);
+}
+
+static void numbersDynamicIdentifiers() {
+	auto name = identifier("x");
+
+	name->dynamic = true;
+
+	assert(CacheSites().run(list({name, identifier("y")})) == 1 && name->cache == 0);
+}
+
+int main() {
+	numbersMembers();
+	numbersDynamicIdentifiers();
+}
@@ -0,0 +1,52 @@
+#include <cassert>
+#include <stdexcept>
+#include <string_view>
+
+#include "runtime/string.h"
+
+using namespace pint;
+
+static void ascii() {
+	String<> text("string");
+
+	assert(text.span() == 6 && text.isAscii() && text.at(2) == 'r');
+	assert(text.pop(2).view() == "ng");
+	assert(text.view() == "stri" && text.span() == 4);
+}
+
+static void utf8() {
+	std::string_view source = "héllo wörld ✓ 𝄞 and some more ascii text to pass sixteen";
+	String<> text(source);
+
+	assert(!text.isAscii());
+	assert(text.span() == source.size() - 2 - 2 - 3);
+	assert(text.at(1) == U'é' && text.at(14) == U'𝄞');
+	assert(text.pop(45).span() == 45);
+
+	String<> joined = String<>("ab") + String<>("é");
+
+	assert(joined.span() == 3 && !joined.isAscii());
+}
+
+static void utf16() {
+	String<16> text(u"a𝄞b");
+
+	assert(text.span() == 3 && text.units() == 4);
+	assert(text.at(1) == U'𝄞' && text.at(2) == U'b');
+}
+
+static void invalid() {
+	for (auto bytes: {"\xC0\x80", "\xED\xA0\x80", "\xE2\x82"}) {
+		try {
+			String<> text(bytes);
+			assert(false);
+		} catch (const std::invalid_argument &) {}
+	}
+}
+
+int main() {
+	ascii();
+	utf8();
+	utf16();
+	invalid();
+}
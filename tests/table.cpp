@@ -0,0 +1,71 @@
+#include <cassert>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "runtime/object.h"
+
+using namespace pint;
+
+static std::size_t hash(int key) {
+	return std::hash<std::string>()(std::to_string(key));
+}
+
+static void finds() {
+	Table<int, int> table;
+	std::unordered_map<int, int> reference;
+
+	for (int i = 0; i < 100000; i++) {
+		table.insert(hash(i * 7), i * 7, i);
+		reference[i * 7] = i;
+	}
+
+	for (int i = 0; i < 700000; i++) {
+		auto found = table.find(hash(i), [&](int key) {
+			return key == i;
+		});
+
+		assert((found != nullptr) == reference.count(i));
+		assert(!found || *found == reference[i]);
+	}
+}
+
+static void internsNames() {
+	auto alpha = Symbol::intern("alpha");
+
+	assert(Symbol::intern(std::string("alp") + "ha") == alpha);
+	assert(Symbol::of(Dynamic::fromString("alpha")) == alpha);
+	assert(Symbol::of(Dynamic::fromBoxed(alpha)) == alpha);
+
+	try {
+		Symbol::of(Dynamic::fromInteger(1));
+		assert(false);
+	} catch (const std::invalid_argument &) {}
+}
+
+static void cachesDynamicNames() {
+	auto longer = Symbol::intern("a_much_longer_name");
+	Object object;
+	DynamicCache site;
+
+	for (int i = 0; i < 64; i++) {
+		object.set(Symbol::intern("p" + std::to_string(i)), Dynamic::fromInteger(i));
+	}
+
+	object.set(longer, Dynamic::fromInteger(99));
+
+	assert(site.get(object, Dynamic::fromString("p5")).toInteger() == 5);
+	assert(site.get(object, Dynamic::fromBoxed(longer)).toInteger() == 99);
+	assert(site.get(object, Dynamic::fromString("nope")).isVoid());
+
+	site.set(object, Dynamic::fromString("new"), Dynamic::fromInteger(7));
+
+	assert(object.get(Symbol::intern("new")).toInteger() == 7);
+}
+
+int main() {
+	finds();
+	internsNames();
+	cachesDynamicNames();
+}
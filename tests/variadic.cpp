@@ -0,0 +1,25 @@
+#include <cassert>
+#include <string_view>
+
+#include "runtime/variadic.h"
+
+using namespace pint;
+
+static std::size_t total(Variadic<std::string_view> parts) {
+	std::size_t units = 0;
+
+	for (auto &part: parts) {
+		units += part.size();
+	}
+
+	return units;
+}
+
+int main() {
+	assert(total({"x is ", "42"}) == 7);
+	assert(total({}) == 0);
+
+	auto escaped = Variadic<int>({1, 2, 3}).escape();
+
+	assert(escaped.span() == 3 && escaped[2] == 3);
+}